@@ -0,0 +1,231 @@
+/**
+ * @file adaptive_radix_tree.h
+ * @brief Adaptive radix tree: an ordered map from byte strings to values
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_ADAPTIVE_RADIX_TREE_H
+#define LEETCODE_STUDY_GUIDE_ADAPTIVE_RADIX_TREE_H
+
+#include "../common.h"
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Adaptive radix tree (ART) keyed on arbitrary byte strings
+ *
+ * Inner nodes consume one key byte each and come in four sizes: Node4 and
+ * Node16 keep sorted key arrays (Node16 is searched with one SSE2 compare
+ * when available), Node48 maps bytes to 48 child slots through a 256-byte
+ * index, and Node256 indexes children directly. Nodes grow and shrink
+ * between these sizes as children come and go, so sparse nodes stay small
+ * and dense nodes stay O(1). Unary chains are collapsed into a per-node
+ * prefix, and a key stops at a leaf as soon as it is unique (lazy
+ * expansion); leaves store the full key. A key that is a proper prefix of
+ * another key is stored as the terminal leaf of the inner node where it
+ * ends, so any byte, including '\0', may appear in keys.
+ *
+ * Iteration visits keys in lexicographic order of unsigned bytes, the same
+ * order as std::map<std::string, V>.
+ */
+template<typename V>
+class AdaptiveRadixTree {
+public:
+    /**
+     * @brief Default constructor
+     */
+    AdaptiveRadixTree();
+
+    /**
+     * @brief Destructor (iterative, safe for very deep trees)
+     */
+    ~AdaptiveRadixTree();
+
+    AdaptiveRadixTree(const AdaptiveRadixTree&) = delete;
+    AdaptiveRadixTree& operator=(const AdaptiveRadixTree&) = delete;
+
+    /**
+     * @brief Move constructor
+     */
+    AdaptiveRadixTree(AdaptiveRadixTree&& other) noexcept;
+
+    /**
+     * @brief Move assignment
+     */
+    AdaptiveRadixTree& operator=(AdaptiveRadixTree&& other) noexcept;
+
+    /**
+     * @brief Insert a key or assign to an existing one
+     * @param key Key bytes
+     * @param value Value to store
+     * @return True if the key was not present before
+     * Time Complexity: O(m) where m is key length
+     * Space Complexity: O(1) new nodes
+     */
+    bool insert(const std::string& key, const V& value);
+
+    /**
+     * @brief Look up a key
+     * @param key Key bytes
+     * @return Pointer to the stored value, or nullptr if absent
+     * Time Complexity: O(m) where m is key length
+     * Space Complexity: O(1)
+     */
+    V* find(const std::string& key);
+
+    /**
+     * @brief Look up a key
+     * @param key Key bytes
+     * @return Pointer to the stored value, or nullptr if absent
+     * Time Complexity: O(m) where m is key length
+     * Space Complexity: O(1)
+     */
+    const V* find(const std::string& key) const;
+
+    /**
+     * @brief Check whether a key is present
+     * @param key Key bytes
+     * @return True if present
+     */
+    bool contains(const std::string& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief Remove a key
+     * @param key Key bytes
+     * @return True if the key was removed
+     * Time Complexity: O(m) where m is key length
+     * Space Complexity: O(1)
+     */
+    bool erase(const std::string& key);
+
+    /**
+     * @brief Visit all entries in key order
+     * @param visit Callable taking (const std::string& key, const V& value)
+     * Time Complexity: O(n)
+     */
+    template<typename Visitor>
+    void for_each(Visitor&& visit) const;
+
+    /**
+     * @brief Visit entries whose key starts with prefix, in key order
+     * @param prefix Key prefix
+     * @param visit Callable taking (const std::string& key, const V& value)
+     * Time Complexity: O(p + r) where r is the number of matching entries
+     */
+    template<typename Visitor>
+    void for_each_prefix(const std::string& prefix, Visitor&& visit) const;
+
+    /**
+     * @brief Visit entries with lo <= key < hi, in key order
+     * @param lo Inclusive lower bound
+     * @param hi Exclusive upper bound
+     * @param visit Callable taking (const std::string& key, const V& value)
+     * Time Complexity: O(m + r) where r is the number of visited entries
+     */
+    template<typename Visitor>
+    void for_each_range(const std::string& lo, const std::string& hi, Visitor&& visit) const;
+
+    /**
+     * @brief Collect keys with given prefix
+     * @param prefix Key prefix
+     * @return Matching keys in order
+     */
+    std::vector<std::string> keys_with_prefix(const std::string& prefix) const;
+
+    /**
+     * @brief Get number of keys
+     * @return Number of keys
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Check if tree is empty
+     * @return True if empty
+     */
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * @brief Remove all keys
+     */
+    void clear();
+
+private:
+    enum class NodeType : unsigned char { Leaf, Node4, Node16, Node48, Node256 };
+
+    struct Node {
+        NodeType type;
+        explicit Node(NodeType node_type) : type(node_type) {}
+    };
+
+    struct Leaf : Node {
+        std::string key;  // Full key, so leaves can sit at any depth
+        V value;
+        Leaf(const std::string& leaf_key, const V& leaf_value)
+            : Node(NodeType::Leaf), key(leaf_key), value(leaf_value) {}
+    };
+
+    struct Inner : Node {
+        unsigned short num_children;
+        std::string prefix;  // Compressed path below the parent's key byte
+        Leaf* terminal;      // Key ending exactly at this node, if any
+        explicit Inner(NodeType node_type) : Node(node_type), num_children(0), terminal(nullptr) {}
+    };
+
+    struct Node4 : Inner {
+        unsigned char keys[4];
+        Node* children[4];
+        Node4() : Inner(NodeType::Node4), keys(), children() {}
+    };
+
+    struct Node16 : Inner {
+        unsigned char keys[16];
+        Node* children[16];
+        Node16() : Inner(NodeType::Node16), keys(), children() {}
+    };
+
+    struct Node48 : Inner {
+        unsigned char child_index[256];  // Slot + 1, or 0 when absent
+        Node* children[48];
+        Node48() : Inner(NodeType::Node48), child_index(), children() {}
+    };
+
+    struct Node256 : Inner {
+        Node* children[256];
+        Node256() : Inner(NodeType::Node256), children() {}
+    };
+
+    Node* root_;
+    size_t size_;
+
+    // Helper methods
+    static Node** find_child(const Inner* node, unsigned char byte);
+    static void add_child(Node*& ref, unsigned char byte, Node* child);
+    static void remove_child(Node*& ref, unsigned char byte);
+    static void attach_leaf(Node*& ref, Leaf* leaf, size_t depth);
+    static void collapse(Node*& ref);
+    static void free_node(Node* node);
+    static void destroy(Node* node);
+    bool insert_at(Node*& ref, const std::string& key, const V& value, size_t depth);
+    bool erase_at(Node*& ref, const std::string& key, size_t depth);
+
+    template<typename Visitor>
+    static void for_each_child(const Inner* node, Visitor&& visit);
+    template<typename Visitor>
+    static void visit_all(const Node* node, Visitor& visit);
+    template<typename Visitor>
+    static bool visit_range(const Node* node, std::string& path, const std::string& lo,
+                            const std::string& hi, Visitor& visit);
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "adaptive_radix_tree.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_ADAPTIVE_RADIX_TREE_H
@@ -0,0 +1,644 @@
+/**
+ * @file adaptive_radix_tree.tpp
+ * @brief Template implementation for AdaptiveRadixTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_ADAPTIVE_RADIX_TREE_TPP
+#define LEETCODE_STUDY_GUIDE_ADAPTIVE_RADIX_TREE_TPP
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// AdaptiveRadixTree Implementation
+
+template<typename V>
+AdaptiveRadixTree<V>::AdaptiveRadixTree() : root_(nullptr), size_(0) {}
+
+template<typename V>
+AdaptiveRadixTree<V>::~AdaptiveRadixTree() {
+    destroy(root_);
+}
+
+template<typename V>
+AdaptiveRadixTree<V>::AdaptiveRadixTree(AdaptiveRadixTree&& other) noexcept
+    : root_(other.root_), size_(other.size_) {
+    other.root_ = nullptr;
+    other.size_ = 0;
+}
+
+template<typename V>
+AdaptiveRadixTree<V>& AdaptiveRadixTree<V>::operator=(AdaptiveRadixTree&& other) noexcept {
+    if (this != &other) {
+        destroy(root_);
+        root_ = other.root_;
+        size_ = other.size_;
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+template<typename V>
+bool AdaptiveRadixTree<V>::insert(const std::string& key, const V& value) {
+    bool inserted = insert_at(root_, key, value, 0);
+    if (inserted) {
+        size_++;
+    }
+    return inserted;
+}
+
+template<typename V>
+V* AdaptiveRadixTree<V>::find(const std::string& key) {
+    return const_cast<V*>(static_cast<const AdaptiveRadixTree&>(*this).find(key));
+}
+
+template<typename V>
+const V* AdaptiveRadixTree<V>::find(const std::string& key) const {
+    const Node* node = root_;
+    size_t depth = 0;
+
+    while (node) {
+        if (node->type == NodeType::Leaf) {
+            const Leaf* leaf = static_cast<const Leaf*>(node);
+            return leaf->key == key ? &leaf->value : nullptr;
+        }
+
+        const Inner* inner = static_cast<const Inner*>(node);
+        if (key.compare(depth, inner->prefix.size(), inner->prefix) != 0) {
+            return nullptr;
+        }
+        depth += inner->prefix.size();
+
+        if (depth == key.size()) {
+            return inner->terminal ? &inner->terminal->value : nullptr;
+        }
+
+        Node** child = find_child(inner, static_cast<unsigned char>(key[depth]));
+        node = child ? *child : nullptr;
+        depth++;
+    }
+
+    return nullptr;
+}
+
+template<typename V>
+bool AdaptiveRadixTree<V>::erase(const std::string& key) {
+    bool erased = erase_at(root_, key, 0);
+    if (erased) {
+        size_--;
+    }
+    return erased;
+}
+
+template<typename V>
+template<typename Visitor>
+void AdaptiveRadixTree<V>::for_each(Visitor&& visit) const {
+    if (root_) {
+        visit_all(root_, visit);
+    }
+}
+
+template<typename V>
+template<typename Visitor>
+void AdaptiveRadixTree<V>::for_each_prefix(const std::string& prefix, Visitor&& visit) const {
+    const Node* node = root_;
+    size_t depth = 0;
+
+    while (node) {
+        if (node->type == NodeType::Leaf) {
+            const Leaf* leaf = static_cast<const Leaf*>(node);
+            if (leaf->key.compare(0, prefix.size(), prefix) == 0) {
+                visit(leaf->key, leaf->value);
+            }
+            return;
+        }
+
+        // The prefix may run out inside this node's compressed path
+        const Inner* inner = static_cast<const Inner*>(node);
+        size_t length = std::min(inner->prefix.size(), prefix.size() - depth);
+        if (prefix.compare(depth, length, inner->prefix, 0, length) != 0) {
+            return;
+        }
+        depth += inner->prefix.size();
+
+        if (depth >= prefix.size()) {
+            visit_all(node, visit);
+            return;
+        }
+
+        Node** child = find_child(inner, static_cast<unsigned char>(prefix[depth]));
+        node = child ? *child : nullptr;
+        depth++;
+    }
+}
+
+template<typename V>
+template<typename Visitor>
+void AdaptiveRadixTree<V>::for_each_range(const std::string& lo, const std::string& hi, Visitor&& visit) const {
+    if (root_ && lo < hi) {
+        std::string path;
+        visit_range(root_, path, lo, hi, visit);
+    }
+}
+
+template<typename V>
+std::vector<std::string> AdaptiveRadixTree<V>::keys_with_prefix(const std::string& prefix) const {
+    std::vector<std::string> keys;
+    for_each_prefix(prefix, [&keys](const std::string& key, const V&) {
+        keys.push_back(key);
+    });
+    return keys;
+}
+
+template<typename V>
+void AdaptiveRadixTree<V>::clear() {
+    destroy(root_);
+    root_ = nullptr;
+    size_ = 0;
+}
+
+// AdaptiveRadixTree Helper Methods
+
+template<typename V>
+typename AdaptiveRadixTree<V>::Node** AdaptiveRadixTree<V>::find_child(const Inner* node, unsigned char byte) {
+    switch (node->type) {
+        case NodeType::Node4: {
+            Node4* n = static_cast<Node4*>(const_cast<Inner*>(node));
+            for (unsigned i = 0; i < n->num_children; ++i) {
+                if (n->keys[i] == byte) return &n->children[i];
+            }
+            return nullptr;
+        }
+        case NodeType::Node16: {
+            Node16* n = static_cast<Node16*>(const_cast<Inner*>(node));
+#if defined(__SSE2__)
+            // Compare all 16 keys at once and keep only the occupied lanes
+            __m128i needle = _mm_set1_epi8(static_cast<char>(byte));
+            __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(needle, keys)));
+            mask &= (1u << n->num_children) - 1;
+            return mask ? &n->children[__builtin_ctz(mask)] : nullptr;
+#else
+            unsigned char* end = n->keys + n->num_children;
+            unsigned char* it = std::lower_bound(n->keys, end, byte);
+            return it != end && *it == byte ? &n->children[it - n->keys] : nullptr;
+#endif
+        }
+        case NodeType::Node48: {
+            Node48* n = static_cast<Node48*>(const_cast<Inner*>(node));
+            unsigned char slot = n->child_index[byte];
+            return slot ? &n->children[slot - 1] : nullptr;
+        }
+        case NodeType::Node256: {
+            Node256* n = static_cast<Node256*>(const_cast<Inner*>(node));
+            return n->children[byte] ? &n->children[byte] : nullptr;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+template<typename V>
+void AdaptiveRadixTree<V>::add_child(Node*& ref, unsigned char byte, Node* child) {
+    switch (ref->type) {
+        case NodeType::Node4: {
+            Node4* n = static_cast<Node4*>(ref);
+            if (n->num_children < 4) {
+                unsigned pos = 0;
+                while (pos < n->num_children && n->keys[pos] < byte) ++pos;
+                std::memmove(n->keys + pos + 1, n->keys + pos, n->num_children - pos);
+                std::memmove(n->children + pos + 1, n->children + pos, (n->num_children - pos) * sizeof(Node*));
+                n->keys[pos] = byte;
+                n->children[pos] = child;
+                n->num_children++;
+                return;
+            }
+            Node16* grown = new Node16();
+            std::memcpy(grown->keys, n->keys, 4);
+            std::memcpy(grown->children, n->children, 4 * sizeof(Node*));
+            grown->num_children = 4;
+            grown->prefix = std::move(n->prefix);
+            grown->terminal = n->terminal;
+            delete n;
+            ref = grown;
+            add_child(ref, byte, child);
+            return;
+        }
+        case NodeType::Node16: {
+            Node16* n = static_cast<Node16*>(ref);
+            if (n->num_children < 16) {
+                unsigned pos = static_cast<unsigned>(std::lower_bound(n->keys, n->keys + n->num_children, byte) - n->keys);
+                std::memmove(n->keys + pos + 1, n->keys + pos, n->num_children - pos);
+                std::memmove(n->children + pos + 1, n->children + pos, (n->num_children - pos) * sizeof(Node*));
+                n->keys[pos] = byte;
+                n->children[pos] = child;
+                n->num_children++;
+                return;
+            }
+            Node48* grown = new Node48();
+            for (unsigned i = 0; i < 16; ++i) {
+                grown->children[i] = n->children[i];
+                grown->child_index[n->keys[i]] = static_cast<unsigned char>(i + 1);
+            }
+            grown->num_children = 16;
+            grown->prefix = std::move(n->prefix);
+            grown->terminal = n->terminal;
+            delete n;
+            ref = grown;
+            add_child(ref, byte, child);
+            return;
+        }
+        case NodeType::Node48: {
+            Node48* n = static_cast<Node48*>(ref);
+            if (n->num_children < 48) {
+                unsigned slot = 0;
+                while (n->children[slot]) ++slot;
+                n->children[slot] = child;
+                n->child_index[byte] = static_cast<unsigned char>(slot + 1);
+                n->num_children++;
+                return;
+            }
+            Node256* grown = new Node256();
+            for (unsigned b = 0; b < 256; ++b) {
+                if (n->child_index[b]) grown->children[b] = n->children[n->child_index[b] - 1];
+            }
+            grown->num_children = 48;
+            grown->prefix = std::move(n->prefix);
+            grown->terminal = n->terminal;
+            delete n;
+            ref = grown;
+            add_child(ref, byte, child);
+            return;
+        }
+        case NodeType::Node256: {
+            Node256* n = static_cast<Node256*>(ref);
+            n->children[byte] = child;
+            n->num_children++;
+            return;
+        }
+        default:
+            return;
+    }
+}
+
+template<typename V>
+void AdaptiveRadixTree<V>::remove_child(Node*& ref, unsigned char byte) {
+    // Shrink thresholds sit below the grow points so alternating
+    // insert/erase at a boundary does not reallocate every time
+    switch (ref->type) {
+        case NodeType::Node4: {
+            Node4* n = static_cast<Node4*>(ref);
+            unsigned pos = 0;
+            while (n->keys[pos] != byte) ++pos;
+            std::memmove(n->keys + pos, n->keys + pos + 1, n->num_children - pos - 1);
+            std::memmove(n->children + pos, n->children + pos + 1, (n->num_children - pos - 1) * sizeof(Node*));
+            n->num_children--;
+            break;
+        }
+        case NodeType::Node16: {
+            Node16* n = static_cast<Node16*>(ref);
+            unsigned pos = static_cast<unsigned>(std::lower_bound(n->keys, n->keys + n->num_children, byte) - n->keys);
+            std::memmove(n->keys + pos, n->keys + pos + 1, n->num_children - pos - 1);
+            std::memmove(n->children + pos, n->children + pos + 1, (n->num_children - pos - 1) * sizeof(Node*));
+            n->num_children--;
+            if (n->num_children <= 3) {
+                Node4* shrunk = new Node4();
+                std::memcpy(shrunk->keys, n->keys, n->num_children);
+                std::memcpy(shrunk->children, n->children, n->num_children * sizeof(Node*));
+                shrunk->num_children = n->num_children;
+                shrunk->prefix = std::move(n->prefix);
+                shrunk->terminal = n->terminal;
+                delete n;
+                ref = shrunk;
+            }
+            break;
+        }
+        case NodeType::Node48: {
+            Node48* n = static_cast<Node48*>(ref);
+            n->children[n->child_index[byte] - 1] = nullptr;
+            n->child_index[byte] = 0;
+            n->num_children--;
+            if (n->num_children <= 12) {
+                Node16* shrunk = new Node16();
+                for (unsigned b = 0; b < 256; ++b) {
+                    if (n->child_index[b]) {
+                        shrunk->keys[shrunk->num_children] = static_cast<unsigned char>(b);
+                        shrunk->children[shrunk->num_children++] = n->children[n->child_index[b] - 1];
+                    }
+                }
+                shrunk->prefix = std::move(n->prefix);
+                shrunk->terminal = n->terminal;
+                delete n;
+                ref = shrunk;
+            }
+            break;
+        }
+        case NodeType::Node256: {
+            Node256* n = static_cast<Node256*>(ref);
+            n->children[byte] = nullptr;
+            n->num_children--;
+            if (n->num_children <= 37) {
+                Node48* shrunk = new Node48();
+                for (unsigned b = 0; b < 256; ++b) {
+                    if (n->children[b]) {
+                        shrunk->children[shrunk->num_children] = n->children[b];
+                        shrunk->child_index[b] = static_cast<unsigned char>(++shrunk->num_children);
+                    }
+                }
+                shrunk->prefix = std::move(n->prefix);
+                shrunk->terminal = n->terminal;
+                delete n;
+                ref = shrunk;
+            }
+            break;
+        }
+        default:
+            return;
+    }
+    collapse(ref);
+}
+
+template<typename V>
+void AdaptiveRadixTree<V>::attach_leaf(Node*& ref, Leaf* leaf, size_t depth) {
+    if (leaf->key.size() == depth) {
+        static_cast<Inner*>(ref)->terminal = leaf;
+    } else {
+        add_child(ref, static_cast<unsigned char>(leaf->key[depth]), leaf);
+    }
+}
+
+template<typename V>
+void AdaptiveRadixTree<V>::collapse(Node*& ref) {
+    Inner* n = static_cast<Inner*>(ref);
+    if (n->num_children > 1 || (n->num_children == 1 && n->terminal)) {
+        return;
+    }
+
+    if (n->num_children == 0) {
+        ref = n->terminal;  // Lone terminal leaf replaces the node (or nothing)
+    } else {
+        // Splice out a pass-through node: its only child absorbs the path
+        unsigned char byte = 0;
+        Node* child = nullptr;
+        for_each_child(n, [&](unsigned char b, Node* c) {
+            byte = b;
+            child = c;
+        });
+        if (child->type != NodeType::Leaf) {
+            Inner* inner = static_cast<Inner*>(child);
+            n->prefix.push_back(static_cast<char>(byte));
+            inner->prefix.insert(0, n->prefix);
+        }
+        ref = child;
+    }
+    free_node(n);
+}
+
+template<typename V>
+void AdaptiveRadixTree<V>::free_node(Node* node) {
+    switch (node->type) {
+        case NodeType::Leaf: delete static_cast<Leaf*>(node); break;
+        case NodeType::Node4: delete static_cast<Node4*>(node); break;
+        case NodeType::Node16: delete static_cast<Node16*>(node); break;
+        case NodeType::Node48: delete static_cast<Node48*>(node); break;
+        case NodeType::Node256: delete static_cast<Node256*>(node); break;
+    }
+}
+
+template<typename V>
+void AdaptiveRadixTree<V>::destroy(Node* node) {
+    if (!node) return;
+
+    // Explicit stack so that very long keys cannot overflow the call stack
+    std::vector<Node*> pending = {node};
+    while (!pending.empty()) {
+        Node* current = pending.back();
+        pending.pop_back();
+        if (current->type != NodeType::Leaf) {
+            Inner* inner = static_cast<Inner*>(current);
+            if (inner->terminal) pending.push_back(inner->terminal);
+            for_each_child(inner, [&pending](unsigned char, Node* child) {
+                pending.push_back(child);
+            });
+        }
+        free_node(current);
+    }
+}
+
+template<typename V>
+bool AdaptiveRadixTree<V>::insert_at(Node*& ref, const std::string& key, const V& value, size_t depth) {
+    if (!ref) {
+        ref = new Leaf(key, value);
+        return true;
+    }
+
+    if (ref->type == NodeType::Leaf) {
+        Leaf* leaf = static_cast<Leaf*>(ref);
+        if (leaf->key == key) {
+            leaf->value = value;
+            return false;
+        }
+
+        // Lazy expansion ends here: split on the first differing byte
+        size_t limit = std::min(leaf->key.size(), key.size());
+        size_t common = depth;
+        while (common < limit && leaf->key[common] == key[common]) ++common;
+
+        Node4* split = new Node4();
+        split->prefix = key.substr(depth, common - depth);
+        Node* split_ref = split;
+        attach_leaf(split_ref, leaf, common);
+        attach_leaf(split_ref, new Leaf(key, value), common);
+        ref = split_ref;
+        return true;
+    }
+
+    Inner* inner = static_cast<Inner*>(ref);
+    size_t matched = 0;
+    while (matched < inner->prefix.size() && depth + matched < key.size() &&
+           inner->prefix[matched] == key[depth + matched]) {
+        ++matched;
+    }
+
+    if (matched < inner->prefix.size()) {
+        // Key leaves the compressed path: a new parent takes the shared part
+        Node4* parent = new Node4();
+        parent->prefix = inner->prefix.substr(0, matched);
+        unsigned char byte = static_cast<unsigned char>(inner->prefix[matched]);
+        inner->prefix.erase(0, matched + 1);
+        Node* parent_ref = parent;
+        add_child(parent_ref, byte, inner);
+        attach_leaf(parent_ref, new Leaf(key, value), depth + matched);
+        ref = parent_ref;
+        return true;
+    }
+    depth += inner->prefix.size();
+
+    if (depth == key.size()) {
+        if (inner->terminal) {
+            inner->terminal->value = value;
+            return false;
+        }
+        inner->terminal = new Leaf(key, value);
+        return true;
+    }
+
+    Node** child = find_child(inner, static_cast<unsigned char>(key[depth]));
+    if (child) {
+        return insert_at(*child, key, value, depth + 1);
+    }
+
+    add_child(ref, static_cast<unsigned char>(key[depth]), new Leaf(key, value));
+    return true;
+}
+
+template<typename V>
+bool AdaptiveRadixTree<V>::erase_at(Node*& ref, const std::string& key, size_t depth) {
+    if (!ref) {
+        return false;
+    }
+
+    if (ref->type == NodeType::Leaf) {
+        if (static_cast<Leaf*>(ref)->key != key) {
+            return false;
+        }
+        free_node(ref);
+        ref = nullptr;
+        return true;
+    }
+
+    Inner* inner = static_cast<Inner*>(ref);
+    if (key.compare(depth, inner->prefix.size(), inner->prefix) != 0) {
+        return false;
+    }
+    depth += inner->prefix.size();
+
+    if (depth == key.size()) {
+        if (!inner->terminal) {
+            return false;
+        }
+        free_node(inner->terminal);
+        inner->terminal = nullptr;
+        collapse(ref);
+        return true;
+    }
+
+    unsigned char byte = static_cast<unsigned char>(key[depth]);
+    Node** child = find_child(inner, byte);
+    if (!child) {
+        return false;
+    }
+
+    if ((*child)->type == NodeType::Leaf) {
+        if (static_cast<Leaf*>(*child)->key != key) {
+            return false;
+        }
+        free_node(*child);
+        remove_child(ref, byte);
+        return true;
+    }
+
+    // Inner children keep at least one entry after an erase, so never vanish
+    return erase_at(*child, key, depth + 1);
+}
+
+template<typename V>
+template<typename Visitor>
+void AdaptiveRadixTree<V>::for_each_child(const Inner* node, Visitor&& visit) {
+    switch (node->type) {
+        case NodeType::Node4: {
+            const Node4* n = static_cast<const Node4*>(node);
+            for (unsigned i = 0; i < n->num_children; ++i) visit(n->keys[i], n->children[i]);
+            break;
+        }
+        case NodeType::Node16: {
+            const Node16* n = static_cast<const Node16*>(node);
+            for (unsigned i = 0; i < n->num_children; ++i) visit(n->keys[i], n->children[i]);
+            break;
+        }
+        case NodeType::Node48: {
+            const Node48* n = static_cast<const Node48*>(node);
+            for (unsigned b = 0; b < 256; ++b) {
+                if (n->child_index[b]) visit(static_cast<unsigned char>(b), n->children[n->child_index[b] - 1]);
+            }
+            break;
+        }
+        case NodeType::Node256: {
+            const Node256* n = static_cast<const Node256*>(node);
+            for (unsigned b = 0; b < 256; ++b) {
+                if (n->children[b]) visit(static_cast<unsigned char>(b), n->children[b]);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+template<typename V>
+template<typename Visitor>
+void AdaptiveRadixTree<V>::visit_all(const Node* node, Visitor& visit) {
+    if (node->type == NodeType::Leaf) {
+        const Leaf* leaf = static_cast<const Leaf*>(node);
+        visit(leaf->key, leaf->value);
+        return;
+    }
+
+    // A key ending here sorts before every longer key below it
+    const Inner* inner = static_cast<const Inner*>(node);
+    if (inner->terminal) {
+        visit(inner->terminal->key, inner->terminal->value);
+    }
+    for_each_child(inner, [&visit](unsigned char, const Node* child) {
+        visit_all(child, visit);
+    });
+}
+
+template<typename V>
+template<typename Visitor>
+bool AdaptiveRadixTree<V>::visit_range(const Node* node, std::string& path, const std::string& lo,
+                                       const std::string& hi, Visitor& visit) {
+    if (node->type == NodeType::Leaf) {
+        const Leaf* leaf = static_cast<const Leaf*>(node);
+        if (leaf->key >= hi) return false;
+        if (leaf->key >= lo) visit(leaf->key, leaf->value);
+        return true;
+    }
+
+    const Inner* inner = static_cast<const Inner*>(node);
+    size_t base = path.size();
+    path += inner->prefix;
+
+    // Every key below starts with path: stop past hi, skip wholly below lo
+    bool keep_going = true;
+    if (path >= hi) {
+        keep_going = false;
+    } else if (path >= lo || lo.compare(0, path.size(), path) == 0) {
+        if (inner->terminal && path >= lo) {
+            visit(inner->terminal->key, inner->terminal->value);
+        }
+        for_each_child(inner, [&](unsigned char byte, const Node* child) {
+            if (!keep_going) return;
+            path.push_back(static_cast<char>(byte));
+            keep_going = visit_range(child, path, lo, hi, visit);
+            path.pop_back();
+        });
+    }
+
+    path.resize(base);
+    return keep_going;
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_ADAPTIVE_RADIX_TREE_TPP
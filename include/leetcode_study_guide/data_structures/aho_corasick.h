@@ -0,0 +1,172 @@
+/**
+ * @file aho_corasick.h
+ * @brief Aho-Corasick multi-pattern matcher with a flat transition table
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_AHO_CORASICK_H
+#define LEETCODE_STUDY_GUIDE_AHO_CORASICK_H
+
+#include "heap.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Aho-Corasick automaton over byte strings
+ *
+ * The pattern trie is completed with failure links into a full DFA, so
+ * scanning costs exactly one table lookup per input byte no matter how
+ * many patterns there are. Bytes that occur in no pattern share one
+ * alphabet class, which keeps the state table at states * (distinct
+ * pattern bytes + 1) entries. Every state points at the patterns ending
+ * there and at the nearest suffix state that also ends a pattern
+ * (dictionary link), so reporting costs O(1) per match.
+ *
+ * The streaming scan() keeps the current state and the stream offset
+ * between calls, so matches that straddle chunk boundaries are found
+ * and reported with absolute offsets.
+ */
+class AhoCorasick {
+public:
+    /**
+     * @brief One occurrence of a pattern in the stream
+     */
+    struct Match {
+        size_t pattern_id;  // Index into the pattern list
+        uint64_t offset;    // Stream offset of the first byte of the match
+
+        bool operator==(const Match& other) const {
+            return pattern_id == other.pattern_id && offset == other.offset;
+        }
+    };
+
+    /**
+     * @brief Build the automaton from a pattern list
+     * @param patterns Patterns; ids are their indices (empty patterns never match)
+     * Time Complexity: O(L * a) where L is total pattern length, a the alphabet classes
+     * Space Complexity: O(L * a)
+     */
+    explicit AhoCorasick(const std::vector<std::string>& patterns);
+
+    /**
+     * @brief Build the automaton from the words of a Trie
+     * @param trie Source trie; ids follow get_all_words() order
+     */
+    explicit AhoCorasick(const Trie& trie);
+
+    /**
+     * @brief Feed the next chunk of the stream
+     * @param chunk Bytes following the previous chunk
+     * @return Matches that end inside this chunk, in order of their end
+     * Time Complexity: O(n + z) where n is chunk length, z is matches
+     * Space Complexity: O(z)
+     */
+    std::vector<Match> scan(const std::string& chunk);
+
+    /**
+     * @brief Feed the next chunk of the stream, reporting through a callback
+     * @param data Chunk bytes
+     * @param size Chunk length
+     * @param on_match Callable taking (const Match&)
+     * Time Complexity: O(n + z)
+     * Space Complexity: O(1)
+     */
+    template<typename Callback>
+    void scan(const char* data, size_t size, Callback&& on_match) {
+        state_ = run(state_, position_, data, size, on_match);
+        position_ += size;
+    }
+
+    /**
+     * @brief Find all matches in a standalone text (does not touch the stream state)
+     * @param text Text to search
+     * @return Matches in order of their end
+     */
+    std::vector<Match> find_all(const std::string& text) const;
+
+    /**
+     * @brief Check whether any pattern occurs in a text
+     * @param text Text to search
+     * @return True if at least one pattern occurs
+     * Time Complexity: O(n) with early exit on the first match
+     */
+    bool contains_any(const std::string& text) const;
+
+    /**
+     * @brief Restart the stream at offset 0
+     */
+    void reset();
+
+    /**
+     * @brief Get a pattern by id
+     * @param id Pattern id
+     * @return Pattern bytes
+     * @throws std::out_of_range if id is invalid
+     */
+    const std::string& pattern(size_t id) const { return patterns_.at(id); }
+
+    /**
+     * @brief Get number of patterns
+     * @return Pattern count
+     */
+    size_t pattern_count() const { return patterns_.size(); }
+
+    /**
+     * @brief Get number of automaton states
+     * @return State count (including the root)
+     */
+    size_t state_count() const { return output_begin_.size() - 1; }
+
+private:
+    std::vector<std::string> patterns_;
+    unsigned char byte_class_[256];     // Byte -> alphabet class (0 = unused byte)
+    size_t alphabet_size_;
+    std::vector<int32_t> transitions_;  // state * alphabet_size_ + class -> state
+    std::vector<uint32_t> output_begin_;  // Patterns ending at state s: output_ids_[begin[s], begin[s+1])
+    std::vector<uint32_t> output_ids_;
+    std::vector<int32_t> dict_link_;    // Nearest proper suffix state with output, or -1
+    std::vector<unsigned char> has_output_;  // State or any suffix state ends a pattern
+    int32_t state_;
+    uint64_t position_;
+
+    void build();
+
+    int32_t next(int32_t state, char byte) const {
+        return transitions_[static_cast<size_t>(state) * alphabet_size_ + byte_class_[static_cast<unsigned char>(byte)]];
+    }
+
+    template<typename Callback>
+    int32_t run(int32_t state, uint64_t position, const char* data, size_t size, Callback& on_match) const {
+        for (size_t i = 0; i < size; ++i) {
+            state = next(state, data[i]);
+            if (has_output_[state]) {
+                report(state, position + i + 1, on_match);
+            }
+        }
+        return state;
+    }
+
+    template<typename Callback>
+    void report(int32_t state, uint64_t end, Callback& on_match) const {
+        if (output_begin_[state] == output_begin_[state + 1]) {
+            state = dict_link_[state];
+        }
+        for (; state >= 0; state = dict_link_[state]) {
+            for (uint32_t i = output_begin_[state]; i < output_begin_[state + 1]; ++i) {
+                size_t id = output_ids_[i];
+                on_match(Match{id, end - patterns_[id].size()});
+            }
+        }
+    }
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_AHO_CORASICK_H
@@ -0,0 +1,182 @@
+/**
+ * @file concurrent_skip_list.h
+ * @brief Thread-safe ordered map based on a skip list
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_CONCURRENT_SKIP_LIST_H
+#define LEETCODE_STUDY_GUIDE_CONCURRENT_SKIP_LIST_H
+
+#include "../common.h"
+#include "epoch_reclaimer.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Ordered map that many threads can read and update at once
+ *
+ * This is the lazy skip list of Herlihy, Lev, Luchangco and Shavit. Each
+ * node is a tower of atomic next pointers whose height is drawn with
+ * probability 1/4 per extra level. Lookups, lower_bound and range scans
+ * never lock or write shared memory. insert and erase lock only the
+ * predecessor towers they relink (plus the victim for erase) and
+ * validate them before writing, so updates to different parts of the
+ * key space run in parallel. Locks are always taken in descending key
+ * order, which rules out deadlock.
+ *
+ * A key is present once its tower is fully linked and until it is marked
+ * for removal. Unlinked towers are handed to EpochReclaimer and freed
+ * once no reader can still be traversing them. Keys are compared with
+ * operator<, and values are immutable once inserted.
+ */
+template<typename K, typename V>
+class ConcurrentSkipList {
+public:
+    /**
+     * @brief Create an empty map
+     */
+    ConcurrentSkipList();
+
+    /**
+     * @brief Destructor (no other thread may use the map any more)
+     */
+    ~ConcurrentSkipList();
+
+    ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+    /**
+     * @brief Insert a key-value pair
+     * @param key Key to insert
+     * @param value Associated value
+     * @return True if inserted, false if the key was already present
+     * Time Complexity: O(log n) expected
+     * Space Complexity: O(1) expected (4/3 pointers per key)
+     */
+    bool insert(const K& key, const V& value);
+
+    /**
+     * @brief Remove a key
+     * @param key Key to remove
+     * @return True if removed, false if absent
+     * Time Complexity: O(log n) expected
+     */
+    bool erase(const K& key);
+
+    /**
+     * @brief Check whether a key is present (lock-free)
+     * @param key Key to look up
+     * @return True if present
+     * Time Complexity: O(log n) expected
+     */
+    bool contains(const K& key) const;
+
+    /**
+     * @brief Look up the value of a key (lock-free)
+     * @param key Key to look up
+     * @return Copy of the value, or nullopt if absent
+     * Time Complexity: O(log n) expected
+     */
+    std::optional<V> find(const K& key) const;
+
+    /**
+     * @brief Find the first entry whose key is not less than key (lock-free)
+     * @param key Lower bound
+     * @return Copy of the entry, or nullopt if every key is smaller
+     * Time Complexity: O(log n) expected
+     */
+    std::optional<std::pair<K, V>> lower_bound(const K& key) const;
+
+    /**
+     * @brief Visit the entries with lo <= key <= hi in ascending order (lock-free)
+     * @param lo Inclusive lower bound
+     * @param hi Inclusive upper bound
+     * @param visit Called as visit(key, value); should not block
+     * Entries inserted or erased during the scan may or may not be seen;
+     * every entry present for the whole scan is seen exactly once.
+     * Time Complexity: O(log n + k) expected for k visited entries
+     */
+    template<typename Visitor>
+    void for_each_in_range(const K& lo, const K& hi, Visitor&& visit) const;
+
+    /**
+     * @brief Collect the entries with lo <= key <= hi (lock-free)
+     * @param lo Inclusive lower bound
+     * @param hi Inclusive upper bound
+     * @return Entries in ascending key order
+     * Time Complexity: O(log n + k) expected
+     */
+    std::vector<std::pair<K, V>> range(const K& lo, const K& hi) const;
+
+    /**
+     * @brief Get number of entries
+     * @return Entry count (exact when no update is in flight)
+     */
+    size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Check if the map is empty
+     * @return True if empty
+     */
+    bool empty() const { return size() == 0; }
+
+private:
+    static constexpr int kMaxHeight = 16;
+
+    struct Node;
+
+    // Head sentinel and the link part of every node
+    struct Tower {
+        int height;
+        std::atomic<bool> marked;        // Logically removed
+        std::atomic<bool> fully_linked;  // Linked at every level
+        std::mutex mutex;
+        std::unique_ptr<std::atomic<Node*>[]> next;
+
+        explicit Tower(int levels);
+    };
+
+    struct Node : Tower {
+        const K key;
+        const V value;
+
+        Node(const K& k, const V& v, int levels) : Tower(levels), key(k), value(v) {}
+    };
+
+    // Locks distinct towers in the order given and unlocks them on scope exit
+    class TowerLocks {
+    public:
+        TowerLocks() : count_(0) {}
+        ~TowerLocks();
+        TowerLocks(const TowerLocks&) = delete;
+        TowerLocks& operator=(const TowerLocks&) = delete;
+        void lock(Tower* tower);
+
+    private:
+        Tower* locked_[kMaxHeight];
+        int count_;
+    };
+
+    mutable Tower head_;  // Readers only load its links; writers lock it like any node
+    std::atomic<size_t> size_;
+
+    int find(const K& key, Tower** preds, Node** succs) const;
+    const Node* first_not_less(const K& key) const;
+    static bool is_present(const Node* node);
+    static int random_height();
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "concurrent_skip_list.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_CONCURRENT_SKIP_LIST_H
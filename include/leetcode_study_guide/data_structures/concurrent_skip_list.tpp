@@ -0,0 +1,261 @@
+/**
+ * @file concurrent_skip_list.tpp
+ * @brief Template implementation for ConcurrentSkipList
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_CONCURRENT_SKIP_LIST_TPP
+#define LEETCODE_STUDY_GUIDE_CONCURRENT_SKIP_LIST_TPP
+
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// ConcurrentSkipList Implementation
+
+template<typename K, typename V>
+ConcurrentSkipList<K, V>::Tower::Tower(int levels)
+    : height(levels), marked(false), fully_linked(false), next(new std::atomic<Node*>[levels]) {
+    for (int level = 0; level < levels; ++level) {
+        next[level].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template<typename K, typename V>
+ConcurrentSkipList<K, V>::ConcurrentSkipList() : head_(kMaxHeight), size_(0) {
+    head_.fully_linked.store(true, std::memory_order_relaxed);
+}
+
+template<typename K, typename V>
+ConcurrentSkipList<K, V>::~ConcurrentSkipList() {
+    Node* node = head_.next[0].load(std::memory_order_relaxed);
+    while (node) {
+        Node* next = node->next[0].load(std::memory_order_relaxed);
+        delete node;
+        node = next;
+    }
+}
+
+template<typename K, typename V>
+bool ConcurrentSkipList<K, V>::insert(const K& key, const V& value) {
+    int height = random_height();
+    Tower* preds[kMaxHeight];
+    Node* succs[kMaxHeight];
+    EpochReclaimer::Guard guard;
+
+    while (true) {
+        int found = find(key, preds, succs);
+        if (found >= 0) {
+            Node* existing = succs[found];
+            if (!existing->marked.load(std::memory_order_acquire)) {
+                // Present (or about to be): wait until it is visible to everyone
+                while (!existing->fully_linked.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                return false;
+            }
+            continue;  // Being removed: retry once it is unlinked
+        }
+
+        // Lock the predecessors bottom-up and check nothing changed around them
+        TowerLocks locks;
+        bool valid = true;
+        for (int level = 0; valid && level < height; ++level) {
+            Tower* pred = preds[level];
+            Node* succ = succs[level];
+            locks.lock(pred);
+            valid = !pred->marked.load(std::memory_order_acquire) &&
+                    (!succ || !succ->marked.load(std::memory_order_acquire)) &&
+                    pred->next[level].load(std::memory_order_acquire) == succ;
+        }
+        if (!valid) continue;
+
+        Node* node = new Node(key, value, height);
+        for (int level = 0; level < height; ++level) {
+            node->next[level].store(succs[level], std::memory_order_relaxed);
+        }
+        for (int level = 0; level < height; ++level) {
+            preds[level]->next[level].store(node, std::memory_order_release);
+        }
+        node->fully_linked.store(true, std::memory_order_release);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+}
+
+template<typename K, typename V>
+bool ConcurrentSkipList<K, V>::erase(const K& key) {
+    Tower* preds[kMaxHeight];
+    Node* succs[kMaxHeight];
+    Node* victim = nullptr;
+    bool is_marked = false;
+    EpochReclaimer::Guard guard;
+
+    while (true) {
+        int found = find(key, preds, succs);
+        if (!is_marked) {
+            // Only a fully linked, unmarked tower found at its top level can be removed
+            if (found < 0) return false;
+            victim = succs[found];
+            if (found != victim->height - 1 || !victim->fully_linked.load(std::memory_order_acquire) ||
+                victim->marked.load(std::memory_order_acquire)) {
+                return false;
+            }
+            victim->mutex.lock();
+            if (victim->marked.load(std::memory_order_relaxed)) {
+                victim->mutex.unlock();
+                return false;  // Another thread won the race
+            }
+            victim->marked.store(true, std::memory_order_release);  // Logically removed from here on
+            is_marked = true;
+        }
+
+        TowerLocks locks;
+        bool valid = true;
+        for (int level = 0; valid && level < victim->height; ++level) {
+            Tower* pred = preds[level];
+            locks.lock(pred);
+            valid = !pred->marked.load(std::memory_order_acquire) &&
+                    pred->next[level].load(std::memory_order_acquire) == victim;
+        }
+        if (!valid) continue;
+
+        for (int level = victim->height - 1; level >= 0; --level) {
+            preds[level]->next[level].store(victim->next[level].load(std::memory_order_relaxed),
+                                            std::memory_order_release);
+        }
+        victim->mutex.unlock();
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        EpochReclaimer::instance().retire(victim);
+        return true;
+    }
+}
+
+template<typename K, typename V>
+bool ConcurrentSkipList<K, V>::contains(const K& key) const {
+    EpochReclaimer::Guard guard;
+    const Node* node = first_not_less(key);
+    return node && !(key < node->key);
+}
+
+template<typename K, typename V>
+std::optional<V> ConcurrentSkipList<K, V>::find(const K& key) const {
+    EpochReclaimer::Guard guard;
+    const Node* node = first_not_less(key);
+    if (!node || key < node->key) return std::nullopt;
+    return node->value;
+}
+
+template<typename K, typename V>
+std::optional<std::pair<K, V>> ConcurrentSkipList<K, V>::lower_bound(const K& key) const {
+    EpochReclaimer::Guard guard;
+    const Node* node = first_not_less(key);
+    if (!node) return std::nullopt;
+    return std::make_pair(node->key, node->value);
+}
+
+template<typename K, typename V>
+template<typename Visitor>
+void ConcurrentSkipList<K, V>::for_each_in_range(const K& lo, const K& hi, Visitor&& visit) const {
+    EpochReclaimer::Guard guard;
+    const Node* node = first_not_less(lo);
+    while (node && !(hi < node->key)) {
+        if (is_present(node)) {
+            visit(node->key, node->value);
+        }
+        node = node->next[0].load(std::memory_order_acquire);
+    }
+}
+
+template<typename K, typename V>
+std::vector<std::pair<K, V>> ConcurrentSkipList<K, V>::range(const K& lo, const K& hi) const {
+    std::vector<std::pair<K, V>> result;
+    for_each_in_range(lo, hi, [&result](const K& key, const V& value) { result.emplace_back(key, value); });
+    return result;
+}
+
+// ConcurrentSkipList Helper Methods
+
+template<typename K, typename V>
+int ConcurrentSkipList<K, V>::find(const K& key, Tower** preds, Node** succs) const {
+    // Records the last tower before key and its successor on every level;
+    // returns the highest level where key itself was found, or -1
+    int found = -1;
+    Tower* pred = &head_;
+    for (int level = kMaxHeight - 1; level >= 0; --level) {
+        Node* current = pred->next[level].load(std::memory_order_acquire);
+        while (current && current->key < key) {
+            pred = current;
+            current = pred->next[level].load(std::memory_order_acquire);
+        }
+        if (found < 0 && current && !(key < current->key)) {
+            found = level;
+        }
+        preds[level] = pred;
+        succs[level] = current;
+    }
+    return found;
+}
+
+template<typename K, typename V>
+const typename ConcurrentSkipList<K, V>::Node* ConcurrentSkipList<K, V>::first_not_less(const K& key) const {
+    const Tower* pred = &head_;
+    const Node* current = nullptr;
+    for (int level = kMaxHeight - 1; level >= 0; --level) {
+        current = pred->next[level].load(std::memory_order_acquire);
+        while (current && current->key < key) {
+            pred = current;
+            current = pred->next[level].load(std::memory_order_acquire);
+        }
+    }
+
+    // Skip towers that are being inserted or removed
+    while (current && !is_present(current)) {
+        current = current->next[0].load(std::memory_order_acquire);
+    }
+    return current;
+}
+
+template<typename K, typename V>
+bool ConcurrentSkipList<K, V>::is_present(const Node* node) {
+    return node->fully_linked.load(std::memory_order_acquire) && !node->marked.load(std::memory_order_acquire);
+}
+
+template<typename K, typename V>
+int ConcurrentSkipList<K, V>::random_height() {
+    // Per-thread xorshift; each extra level has probability 1/4
+    thread_local uint32_t state = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    int height = 1;
+    for (uint32_t bits = state; height < kMaxHeight && (bits & 3) == 0; bits >>= 2) {
+        ++height;
+    }
+    return height;
+}
+
+template<typename K, typename V>
+ConcurrentSkipList<K, V>::TowerLocks::~TowerLocks() {
+    for (int i = count_ - 1; i >= 0; --i) {
+        locked_[i]->mutex.unlock();
+    }
+}
+
+template<typename K, typename V>
+void ConcurrentSkipList<K, V>::TowerLocks::lock(Tower* tower) {
+    // Predecessors repeat across levels; each tower is locked once
+    if (count_ > 0 && locked_[count_ - 1] == tower) return;
+    tower->mutex.lock();
+    locked_[count_++] = tower;
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_CONCURRENT_SKIP_LIST_TPP
@@ -0,0 +1,148 @@
+/**
+ * @file concurrent_trie.h
+ * @brief Read-mostly radix trie with lock-free readers and copy-on-write writers
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_CONCURRENT_TRIE_H
+#define LEETCODE_STUDY_GUIDE_CONCURRENT_TRIE_H
+
+#include "../common.h"
+#include "epoch_reclaimer.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Thread-safe path-compressed trie for read-heavy workloads
+ *
+ * Published nodes are immutable. A writer copies the nodes on the path it
+ * changes, links the copies to the untouched subtrees, and publishes the
+ * new root with a single atomic store, so readers always see a complete
+ * snapshot and never take a lock or write to shared memory. Replaced
+ * nodes are handed to EpochReclaimer and freed once no reader can still
+ * be traversing them. Writers are serialized by a mutex, which suits the
+ * rare-update case this class is meant for.
+ */
+class ConcurrentTrie {
+public:
+    /**
+     * @brief Default constructor
+     */
+    ConcurrentTrie();
+
+    /**
+     * @brief Destructor (no other thread may use the trie any more)
+     */
+    ~ConcurrentTrie();
+
+    ConcurrentTrie(const ConcurrentTrie&) = delete;
+    ConcurrentTrie& operator=(const ConcurrentTrie&) = delete;
+
+    /**
+     * @brief Insert word into trie
+     * @param word Word to insert
+     * @return True if the word was not present before
+     * Time Complexity: O(m + d * c) where d is the number of nodes on the
+     * path and c their child count (copied nodes)
+     * Space Complexity: O(d) new nodes
+     */
+    bool insert(const std::string& word);
+
+    /**
+     * @brief Remove word from trie
+     * @param word Word to remove
+     * @return True if word was removed
+     * Time Complexity: O(m + d * c)
+     * Space Complexity: O(d) new nodes
+     */
+    bool remove(const std::string& word);
+
+    /**
+     * @brief Remove all words
+     */
+    void clear();
+
+    /**
+     * @brief Search for exact word (lock-free)
+     * @param word Word to search for
+     * @return True if word exists
+     * Time Complexity: O(m log c)
+     */
+    bool search(const std::string& word) const;
+
+    /**
+     * @brief Check if any word starts with given prefix (lock-free)
+     * @param prefix Prefix to check
+     * @return True if prefix exists
+     * Time Complexity: O(m log c)
+     */
+    bool starts_with(const std::string& prefix) const;
+
+    /**
+     * @brief Count words with given prefix (lock-free)
+     * @param prefix Prefix to count
+     * @return Number of words with the prefix
+     * Time Complexity: O(m log c)
+     */
+    int count_words_with_prefix(const std::string& prefix) const;
+
+    /**
+     * @brief Auto-complete suggestions in alphabetical order (lock-free)
+     * @param prefix Prefix to get suggestions for
+     * @param max_suggestions Maximum number of suggestions
+     * @return Completions from one consistent snapshot
+     * Time Complexity: O(p + k) where k is nodes visited
+     */
+    std::vector<std::string> auto_complete(const std::string& prefix, int max_suggestions = 10) const;
+
+    /**
+     * @brief Get number of words
+     * @return Number of words in the latest snapshot
+     */
+    int size() const;
+
+    /**
+     * @brief Check if trie is empty
+     * @return True if empty
+     */
+    bool empty() const { return size() == 0; }
+
+private:
+    struct Node {
+        std::string label;  // Edge label leading into this node (empty for root)
+        bool is_end_of_word;
+        int prefix_count;   // Number of words in this subtree
+        std::vector<std::pair<unsigned char, const Node*>> children;  // Sorted by key
+
+        explicit Node(std::string edge_label = std::string())
+            : label(std::move(edge_label)), is_end_of_word(false), prefix_count(0) {}
+    };
+
+    std::atomic<const Node*> root_;
+    std::mutex write_mutex_;
+
+    // Helper methods
+    static const Node* find_child(const Node* node, unsigned char key);
+    static const Node* find_node(const Node* root, const std::string& prefix, std::string* path);
+    static const Node* insert_path(const Node* node, const std::string& word, size_t pos,
+                                   std::vector<const Node*>& replaced);
+    static const Node* remove_path(const Node* node, const std::string& word, size_t pos, bool is_root,
+                                   std::vector<const Node*>& replaced, bool& removed);
+    static const Node* merge_with_only_child(const Node* node, std::vector<const Node*>& replaced);
+    static void collect_limited(const Node* node, std::string& prefix,
+                                std::vector<std::string>& words, int limit);
+    static void destroy_tree(const Node* root);
+    void publish(const Node* root, const std::vector<const Node*>& replaced);
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_CONCURRENT_TRIE_H
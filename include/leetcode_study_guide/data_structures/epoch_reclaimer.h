@@ -0,0 +1,136 @@
+/**
+ * @file epoch_reclaimer.h
+ * @brief Epoch-based memory reclamation for lock-free readers
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_EPOCH_RECLAIMER_H
+#define LEETCODE_STUDY_GUIDE_EPOCH_RECLAIMER_H
+
+#include "../common.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Process-wide epoch-based reclamation (EBR) domain
+ *
+ * Readers pin the current epoch for the duration of an operation; pinning
+ * is one store and one fence on a per-thread cache line, so readers never
+ * contend with each other. A writer that unlinks a node retires it instead
+ * of deleting it. The global epoch only advances once every pinned thread
+ * has observed it, so a node retired in epoch e can no longer be reachable
+ * by any reader once the epoch reaches e + 2, and is freed then.
+ *
+ * Retired nodes are buffered per thread and reclaimed in batches. A
+ * thread that exits hands its leftovers to a shared list that any thread
+ * may drain.
+ *
+ * Thread slots live in fixed-size chunks on a lock-free list that grows
+ * whenever every slot is taken, so any number of threads may register.
+ * A slot is returned for reuse when its thread exits; chunks are kept
+ * until process exit.
+ */
+class EpochReclaimer {
+public:
+    /**
+     * @brief RAII critical section; retired nodes stay alive while it exists
+     *
+     * Guards nest: only the outermost one on a thread pins and unpins.
+     */
+    class Guard {
+    public:
+        Guard();
+        ~Guard();
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+    
+    /**
+     * @brief Get the shared reclamation domain
+     * @return Process-wide instance
+     */
+    static EpochReclaimer& instance();
+    
+    /**
+     * @brief Defer deletion of an unlinked object
+     * @param object Object no longer reachable from the shared structure
+     * Time Complexity: O(1) amortized
+     */
+    template<typename T>
+    void retire(T* object) {
+        retire(static_cast<void*>(object), [](void* p) { delete static_cast<T*>(p); });
+    }
+    
+    /**
+     * @brief Defer a custom deleter call for an unlinked object
+     * @param object Object no longer reachable from the shared structure
+     * @param deleter Function that frees the object
+     */
+    void retire(void* object, void (*deleter)(void*));
+    
+    /**
+     * @brief Try to advance the epoch and free what has become safe
+     * @return Number of objects freed
+     */
+    size_t collect();
+    
+    /**
+     * @brief Get the current global epoch
+     * @return Epoch counter
+     */
+    uint64_t epoch() const { return global_epoch_.load(std::memory_order_acquire); }
+    
+    EpochReclaimer(const EpochReclaimer&) = delete;
+    EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+
+private:
+    struct Retired {
+        void* object;
+        void (*deleter)(void*);
+        uint64_t epoch;
+    };
+    
+    struct alignas(64) ThreadSlot {
+        std::atomic<uint64_t> epoch;  // Pinned epoch, 0 when quiescent
+        std::atomic<bool> in_use;
+    };
+    
+    static constexpr size_t kChunkSlots = 64;
+    
+    struct SlotChunk {
+        ThreadSlot slots[kChunkSlots];
+        std::atomic<SlotChunk*> next;  // Set once, never unlinked
+        
+        SlotChunk();
+    };
+    
+    struct ThreadState;
+    friend struct ThreadState;
+    
+    static constexpr size_t kCollectThreshold = 64;
+    
+    std::atomic<uint64_t> global_epoch_;
+    SlotChunk slots_;  // First chunk of the slot list
+    std::mutex orphan_mutex_;
+    std::vector<Retired> orphans_;  // Left behind by exited threads
+    
+    EpochReclaimer();
+    ~EpochReclaimer();
+    
+    static ThreadState& local();
+    ThreadSlot* acquire_slot();
+    bool try_advance();
+    static size_t free_safe(std::vector<Retired>& retired, uint64_t epoch);
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_EPOCH_RECLAIMER_H
@@ -0,0 +1,233 @@
+/**
+ * @file frozen_trie.h
+ * @brief Read-only succinct (LOUDS) trie built from a Trie, loadable with mmap
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_FROZEN_TRIE_H
+#define LEETCODE_STUDY_GUIDE_FROZEN_TRIE_H
+
+#include "heap.h"
+#include "mapped_file.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Bit vector view with rank and select support
+ *
+ * Does not own its storage. Cumulative popcounts are kept per 512-bit
+ * block, giving O(1) rank and O(log n) select0.
+ */
+class SuccinctBitVector {
+public:
+    static constexpr uint64_t kBlockBits = 512;
+    
+    SuccinctBitVector() : words_(nullptr), blocks_(nullptr), size_(0) {}
+    
+    /**
+     * @brief Constructor over existing storage
+     * @param words Bit storage, least significant bit first
+     * @param blocks Number of ones before each 512-bit block (blocks + 1 entries)
+     * @param size Number of valid bits
+     */
+    SuccinctBitVector(const uint64_t* words, const uint64_t* blocks, uint64_t size)
+        : words_(words), blocks_(blocks), size_(size) {}
+    
+    /**
+     * @brief Read one bit
+     * @param pos Bit position
+     * @return Bit value
+     */
+    bool get(uint64_t pos) const { return (words_[pos / 64] >> (pos % 64)) & 1; }
+    
+    /**
+     * @brief Count ones in [0, pos)
+     * @param pos Exclusive end position
+     * @return Number of set bits before pos
+     * Time Complexity: O(1)
+     */
+    uint64_t rank1(uint64_t pos) const;
+    
+    /**
+     * @brief Find position of the j-th zero (0-based)
+     * @param j Zero index
+     * @return Bit position
+     * @throws std::out_of_range if there are at most j zeros
+     * Time Complexity: O(log n)
+     */
+    uint64_t select0(uint64_t j) const;
+    
+    /**
+     * @brief Get number of bits
+     * @return Size in bits
+     */
+    uint64_t size() const { return size_; }
+    
+    /**
+     * @brief Number of 64-bit words needed for a bit count
+     */
+    static uint64_t word_count(uint64_t bits) { return bits / 64 + (bits % 64 != 0); }
+    
+    /**
+     * @brief Number of rank directory entries needed for a bit count
+     */
+    static uint64_t block_count(uint64_t bits) { return bits / kBlockBits + (bits % kBlockBits != 0) + 1; }
+    
+    /**
+     * @brief Fill the rank directory for a bit array
+     * @param words Bit storage
+     * @param bits Number of valid bits
+     * @param blocks Output directory with block_count(bits) entries
+     */
+    static void build_directory(const uint64_t* words, uint64_t bits, uint64_t* blocks);
+
+private:
+    const uint64_t* words_;
+    const uint64_t* blocks_;
+    uint64_t size_;
+};
+
+/**
+ * @brief Immutable LOUDS-encoded trie
+ *
+ * The character-level tree is stored in breadth-first order as a LOUDS bit
+ * string (each node's degree in unary), one label byte per node and one
+ * terminal bit per node: roughly 11 bits per character node plus small
+ * rank directories, instead of a heap-allocated node per edge. Children of
+ * a node are contiguous and sorted, and every subtree is a contiguous
+ * range on each level, so prefix counts need only rank queries.
+ *
+ * The in-memory layout is exactly the file layout, so save() writes one
+ * buffer and load() maps the file and uses it in place without parsing.
+ * Files use the host byte order.
+ */
+class FrozenTrie {
+public:
+    /**
+     * @brief Create an empty frozen trie
+     */
+    FrozenTrie();
+    
+    /**
+     * @brief Freeze the contents of a Trie
+     * @param trie Source trie
+     * Time Complexity: O(n) where n is the number of character nodes
+     * Space Complexity: O(n) bits
+     */
+    explicit FrozenTrie(const Trie& trie);
+    
+    /**
+     * @brief Map a file written by save()
+     *
+     * The header and section sizes are always checked. The bit vectors,
+     * rank directories and tree shape are only checked with verify, which
+     * reads the whole file; use it for files from untrusted sources.
+     * @param path File path
+     * @param verify Also check the encoded structure
+     * @return Frozen trie reading directly from the mapping
+     * @throws std::runtime_error if the file is missing or malformed
+     * Time Complexity: O(1), O(n) with verify
+     */
+    static FrozenTrie load(const std::string& path, bool verify = false);
+    
+    /**
+     * @brief View a buffer holding the save() format without copying
+     * @param data Start of the buffer (8-byte aligned, must outlive the result)
+     * @param size Buffer size in bytes
+     * @param verify Also check the encoded structure (see load())
+     * @return Frozen trie reading directly from the buffer
+     * @throws std::runtime_error if the buffer is malformed
+     * Time Complexity: O(1), O(n) with verify
+     */
+    static FrozenTrie from_buffer(const void* data, size_t size, bool verify = false);
+    
+    /**
+     * @brief Write the frozen trie to a file
+     * @param path Destination path
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save(const std::string& path) const;
+    
+    /**
+     * @brief Search for exact word
+     * @param word Word to search for
+     * @return True if word exists
+     * Time Complexity: O(m log n)
+     */
+    bool search(const std::string& word) const;
+    
+    /**
+     * @brief Check if any word starts with given prefix
+     * @param prefix Prefix to check
+     * @return True if prefix exists
+     * Time Complexity: O(m log n)
+     */
+    bool starts_with(const std::string& prefix) const;
+    
+    /**
+     * @brief Count words with given prefix
+     * @param prefix Prefix to count
+     * @return Number of words with the prefix
+     * Time Complexity: O((m + h) log n) where h is the subtree height
+     */
+    int count_words_with_prefix(const std::string& prefix) const;
+    
+    /**
+     * @brief Auto-complete suggestions in alphabetical order
+     * @param prefix Prefix to get suggestions for
+     * @param max_suggestions Maximum number of suggestions
+     * @return Vector of suggested completions
+     */
+    std::vector<std::string> auto_complete(const std::string& prefix, int max_suggestions = 10) const;
+    
+    /**
+     * @brief Check if trie holds no words
+     * @return True if empty
+     */
+    bool empty() const { return word_count_ == 0; }
+    
+    /**
+     * @brief Get number of words
+     * @return Number of words
+     */
+    int size() const { return static_cast<int>(word_count_); }
+    
+    /**
+     * @brief Get number of character nodes (including the root)
+     * @return Node count
+     */
+    size_t node_count() const { return static_cast<size_t>(node_count_); }
+    
+    /**
+     * @brief Get size of the encoded representation
+     * @return Number of bytes (equal to the file size)
+     */
+    size_t memory_usage() const { return bytes_; }
+
+private:
+    std::shared_ptr<const void> storage_;  // Keeps owned buffer or mapping alive
+    const unsigned char* base_;
+    size_t bytes_;
+    uint64_t node_count_;
+    uint64_t word_count_;
+    SuccinctBitVector louds_;
+    SuccinctBitVector terminal_;
+    const unsigned char* labels_;
+    
+    void attach(std::shared_ptr<const void> storage, const void* data, size_t size, bool verify);
+    bool find_node(const std::string& prefix, uint64_t& node) const;
+    uint64_t first_child(uint64_t node, uint64_t& degree) const;
+    void collect_limited(uint64_t node, std::string& prefix,
+                         std::vector<std::string>& words, int limit) const;
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_FROZEN_TRIE_H
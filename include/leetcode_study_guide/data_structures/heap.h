@@ -9,11 +9,17 @@
 #define LEETCODE_STUDY_GUIDE_HEAP_H
 
 #include "../common.h"
+#include "node_pool.h"
 #include <vector>
 #include <functional>
 #include <stdexcept>
 #include <algorithm>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <iterator>
+#include <unordered_map>
 
 namespace leetcode_study_guide {
 namespace data_structures {
@@ -46,6 +52,13 @@ public:
      */
     explicit Heap(const std::vector<T>& data, const Compare& comp = Compare());
     
+    /**
+     * @brief Constructor taking ownership of a vector (heapify in place)
+     * @param data Initial data to heapify, moved into the heap
+     * @param comp Comparator function for heap ordering
+     */
+    explicit Heap(std::vector<T>&& data, const Compare& comp = Compare());
+    
     /**
      * @brief Constructor from initializer list
      * @param init_list Initial values
@@ -63,6 +76,35 @@ public:
      */
     void push(const T& value);
     
+    /**
+     * @brief Insert element into heap by moving it
+     * @param value Value to insert
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    void push(T&& value);
+    
+    /**
+     * @brief Construct element in place and insert it
+     * @param args Arguments forwarded to the constructor of T
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    template<typename... Args>
+    void emplace(Args&&... args);
+    
+    /**
+     * @brief Insert a range of elements, heapifying once
+     *
+     * Large batches are appended and heapified in O(n + m); small batches
+     * relative to the heap are sifted up one by one in O(m log n).
+     *
+     * @param first Beginning of the range
+     * @param last End of the range
+     */
+    template<typename InputIt>
+    void push_range(InputIt first, InputIt last);
+    
     /**
      * @brief Remove and return top element
      * @return Top element (min for min-heap, max for max-heap)
@@ -72,6 +114,15 @@ public:
      */
     T pop();
     
+    /**
+     * @brief Remove top element, moving it into an existing object
+     * @param out Receives the top element
+     * @throws std::runtime_error if heap is empty
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    void pop(T& out);
+    
     /**
      * @brief Get top element without removing
      * @return Reference to top element
@@ -104,6 +155,12 @@ public:
      */
     void clear() { data_.clear(); }
     
+    /**
+     * @brief Reserve storage for at least capacity elements
+     * @param capacity Number of elements to reserve room for
+     */
+    void reserve(size_t capacity) { data_.reserve(capacity); }
+    
     // Heap Property Operations
     
     /**
@@ -132,13 +189,21 @@ public:
     // Heap Sort Implementation
     
     /**
-     * @brief Sort elements using heap sort (in-place)
-     * @return Sorted vector of elements
+     * @brief Sort elements using heap sort, leaving the heap intact
+     * @return Sorted vector of elements (in comparator order)
      * Time Complexity: O(n log n)
-     * Space Complexity: O(1)
+     * Space Complexity: O(n) for the returned copy
      */
     std::vector<T> heap_sort();
     
+    /**
+     * @brief Sort elements in place and move them out, emptying the heap
+     * @return Sorted vector of elements (in comparator order)
+     * Time Complexity: O(n log n)
+     * Space Complexity: O(1)
+     */
+    std::vector<T> drain_sorted();
+    
     /**
      * @brief Sort given vector using heap sort
      * @param arr Vector to sort
@@ -159,6 +224,15 @@ public:
      */
     T replace_top(const T& new_value);
     
+    /**
+     * @brief Replace top element by moving in a new value
+     * @param new_value New value to replace top
+     * @return Old top value
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T replace_top(T&& new_value);
+    
     /**
      * @brief Remove element at specific index
      * @param index Index of element to remove
@@ -239,6 +313,8 @@ private:
     void heapify_down(size_t index);
     void build_heap();
     bool is_heap_helper(size_t index) const;
+    static void sift_down(std::vector<T>& arr, size_t index, size_t size, const Compare& comp);
+    static void sort_heap_in_place(std::vector<T>& arr, const Compare& comp);
 };
 
 /**
@@ -253,28 +329,351 @@ using MinHeap = Heap<T, std::less<T>>;
 template<typename T>
 using MaxHeap = Heap<T, std::greater<T>>;
 
+/**
+ * @brief Min-Max (double-ended) heap
+ *
+ * Stores elements in a single array where even levels are ordered like a
+ * min-heap and odd levels like a max-heap, so both the minimum and the
+ * maximum are available in O(1) and either end can be removed in O(log n).
+ * This replaces keeping a MinHeap and a MaxHeap over the same data, and
+ * push_bounded() turns it into a "keep best N, evict worst" buffer.
+ */
+template<typename T, typename Compare = std::less<T>>
+class MinMaxHeap {
+public:
+    /**
+     * @brief Default constructor (creates empty heap)
+     */
+    MinMaxHeap() = default;
+    
+    /**
+     * @brief Constructor with custom comparator
+     * @param comp Comparator defining which end is the minimum
+     */
+    explicit MinMaxHeap(const Compare& comp) : compare_(comp) {}
+    
+    /**
+     * @brief Constructor from vector (bulk build)
+     * @param data Initial data
+     * @param comp Comparator defining which end is the minimum
+     * Time Complexity: O(n)
+     */
+    explicit MinMaxHeap(const std::vector<T>& data, const Compare& comp = Compare());
+    
+    /**
+     * @brief Constructor from initializer list
+     * @param init_list Initial values
+     * @param comp Comparator defining which end is the minimum
+     */
+    MinMaxHeap(std::initializer_list<T> init_list, const Compare& comp = Compare());
+    
+    // Basic Operations
+    
+    /**
+     * @brief Insert element into heap
+     * @param value Value to insert
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    void push(const T& value);
+    
+    /**
+     * @brief Get minimum element
+     * @return Reference to the minimum
+     * @throws std::runtime_error if heap is empty
+     * Time Complexity: O(1)
+     */
+    const T& min() const;
+    
+    /**
+     * @brief Get maximum element
+     * @return Reference to the maximum
+     * @throws std::runtime_error if heap is empty
+     * Time Complexity: O(1)
+     */
+    const T& max() const;
+    
+    /**
+     * @brief Remove and return minimum element
+     * @return Minimum element
+     * @throws std::runtime_error if heap is empty
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T pop_min();
+    
+    /**
+     * @brief Remove and return maximum element
+     * @return Maximum element
+     * @throws std::runtime_error if heap is empty
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T pop_max();
+    
+    /**
+     * @brief Replace minimum element with new value
+     * @param new_value New value
+     * @return Old minimum
+     * @throws std::runtime_error if heap is empty
+     * Time Complexity: O(log n)
+     */
+    T replace_min(const T& new_value);
+    
+    /**
+     * @brief Replace maximum element with new value
+     * @param new_value New value
+     * @return Old maximum
+     * @throws std::runtime_error if heap is empty
+     * Time Complexity: O(log n)
+     */
+    T replace_max(const T& new_value);
+    
+    /**
+     * @brief Insert into a buffer holding at most capacity elements
+     *
+     * When the buffer is full the maximum is evicted if value is smaller,
+     * otherwise value is discarded.
+     *
+     * @param value Value to insert
+     * @param capacity Maximum number of elements to keep
+     * @return True if value was kept
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    bool push_bounded(const T& value, size_t capacity);
+    
+    /**
+     * @brief Check if heap is empty
+     * @return True if heap is empty
+     */
+    bool empty() const { return data_.empty(); }
+    
+    /**
+     * @brief Get size of heap
+     * @return Number of elements in heap
+     */
+    size_t size() const { return data_.size(); }
+    
+    /**
+     * @brief Clear all elements from heap
+     */
+    void clear() { data_.clear(); }
+    
+    /**
+     * @brief Rebuild min-max order over current data
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
+     */
+    void heapify();
+    
+    /**
+     * @brief Check if current data satisfies the min-max heap property
+     * @return True if property holds
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
+     */
+    bool is_heap() const;
+    
+    /**
+     * @brief Get underlying data (for testing/debugging)
+     * @return Reference to internal vector
+     */
+    const std::vector<T>& data() const { return data_; }
+
+private:
+    std::vector<T> data_;
+    Compare compare_;
+    
+    // Helper methods
+    static bool is_min_level(size_t index);
+    size_t max_index() const;
+    void push_up(size_t index);
+    template<bool MinLevel> void push_up_level(size_t index);
+    void push_down(size_t index);
+    template<bool MinLevel> void push_down_level(size_t index);
+    template<bool MinLevel> bool ordered(const T& a, const T& b) const;
+};
+
+class FrozenTrie;
+template<typename T, typename Compare> class TopKAccumulator;
+
 /**
  * @brief Trie (Prefix Tree) implementation for string operations
  * 
  * This class provides a comprehensive implementation of Trie operations
  * commonly used in LeetCode problems, including word search, prefix matching,
  * and autocomplete functionality.
+ *
+ * Internally this is a path-compressed radix trie over bytes: each node
+ * stores the whole edge label leading into it, so unary chains collapse
+ * into a single node, and children live in an adaptive container that
+ * starts as a small inline array and grows to a 256-way table only for
+ * nodes that actually fan out that far.
  */
 class Trie {
 public:
+    struct TrieNode;
+    
+    /**
+     * @brief Adaptive child container keyed by the first byte of each edge
+     *
+     * Up to 4 children are stored inline in sorted arrays, up to 16 in a
+     * sorted block, and beyond that in a direct 256-entry table. Both
+     * out-of-line blocks come from the owning trie's Blocks pools, so the
+     * container is trivially destructible and is dropped with them. The
+     * container does not own the child nodes.
+     */
+    class ChildMap {
+        static constexpr size_t kInlineCapacity = 4;
+        static constexpr size_t kSortedCapacity = 16;
+        
+        enum class Kind : unsigned char { Inline, Sorted, Direct };
+        
+        struct Inline {
+            unsigned char keys[kInlineCapacity];
+            TrieNode* nodes[kInlineCapacity];
+        };
+        struct Sorted {
+            unsigned char keys[kSortedCapacity];
+            TrieNode* nodes[kSortedCapacity];
+        };
+        struct Direct {
+            TrieNode* nodes[256];
+        };
+        
+    public:
+        /**
+         * @brief Pools holding the out-of-line blocks of one trie's containers
+         */
+        struct Blocks {
+            NodePool<Sorted> sorted;
+            NodePool<Direct> direct;
+        };
+        
+        ChildMap() : inline_(), size_(0), kind_(Kind::Inline) {}
+        ChildMap(const ChildMap&) = delete;
+        ChildMap& operator=(const ChildMap&) = delete;
+        
+        /**
+         * @brief Find child whose edge starts with key
+         * @param key First byte of the edge label
+         * @return Child node or nullptr
+         * Time Complexity: O(1)
+         */
+        TrieNode* find(unsigned char key) const;
+        
+        /**
+         * @brief Add a child under a key that is not present yet
+         * @param key First byte of the child's edge label
+         * @param child Child node
+         * @param blocks Pools to take a larger block from
+         */
+        void insert(unsigned char key, TrieNode* child, Blocks& blocks);
+        
+        /**
+         * @brief Replace the child stored under an existing key
+         * @param key First byte of the edge label
+         * @param child New child node
+         */
+        void replace(unsigned char key, TrieNode* child);
+        
+        /**
+         * @brief Remove the child stored under key
+         * @param key First byte of the edge label
+         * @param blocks Pools to return a block to when shrinking
+         */
+        void erase(unsigned char key, Blocks& blocks);
+        
+        /**
+         * @brief Drop all children and return any out-of-line block
+         * @param blocks Pools the block came from
+         */
+        void reset(Blocks& blocks);
+        
+        /**
+         * @brief Get number of children
+         * @return Number of children
+         */
+        size_t size() const { return size_; }
+        
+        /**
+         * @brief Check if node has no children
+         * @return True if empty
+         */
+        bool empty() const { return size_ == 0; }
+        
+        /**
+         * @brief Visit children in ascending key order
+         * @param visit Callable taking (unsigned char key, TrieNode* child)
+         */
+        template<typename Visitor>
+        void for_each(Visitor&& visit) const {
+            switch (kind_) {
+                case Kind::Inline:
+                    for (size_t i = 0; i < size_; ++i) visit(inline_.keys[i], inline_.nodes[i]);
+                    break;
+                case Kind::Sorted:
+                    for (size_t i = 0; i < size_; ++i) visit(sorted_->keys[i], sorted_->nodes[i]);
+                    break;
+                case Kind::Direct:
+                    for (size_t i = 0; i < 256; ++i) {
+                        if (direct_->nodes[i]) visit(static_cast<unsigned char>(i), direct_->nodes[i]);
+                    }
+                    break;
+            }
+        }
+        
+    private:
+        union {
+            Inline inline_;
+            Sorted* sorted_;
+            Direct* direct_;
+        };
+        unsigned short size_;
+        Kind kind_;
+        
+        TrieNode** slot(unsigned char key) const;
+    };
+    
+    /**
+     * @brief Word with its ranking score
+     */
+    struct Completion {
+        std::string word;
+        int score;
+    };
+    
+    /**
+     * @brief Word found by fuzzy_search with its edit distance to the query
+     */
+    struct FuzzyMatch {
+        std::string word;
+        int distance;
+    };
+    
     /**
      * @brief Trie Node structure
+     *
+     * Trivially destructible: the edge label is a slice of the trie's label
+     * arena and child blocks come from its pools, so clear() can drop every
+     * node without visiting it.
      */
     struct TrieNode {
-        std::vector<std::unique_ptr<TrieNode>> children;
+        size_t label_offset;  // Edge label leading into this node, in the trie's label arena
+        size_t label_length;  // (empty for root)
+        ChildMap children;
         bool is_end_of_word;
-        int word_count;  // Number of words ending at this node
-        int prefix_count; // Number of words with this prefix
+        int word_count;   // Number of times the word ending at this node was inserted
+        int prefix_count; // Number of distinct words in this subtree
         
         /**
          * @brief Constructor for TrieNode
+         * @param offset Start of the edge label in the label arena
+         * @param length Length of the edge label
          */
-        TrieNode() : children(26), is_end_of_word(false), word_count(0), prefix_count(0) {}
+        TrieNode(size_t offset, size_t length)
+            : label_offset(offset), label_length(length), is_end_of_word(false), word_count(0), prefix_count(0) {}
     };
     
     /**
@@ -283,20 +682,43 @@ public:
     Trie();
     
     /**
-     * @brief Destructor
+     * @brief Destructor (drops the node, child block and label arenas wholesale)
      */
     ~Trie() = default;
     
+    Trie(const Trie&) = delete;
+    Trie& operator=(const Trie&) = delete;
+    
+    /**
+     * @brief Move constructor
+     */
+    Trie(Trie&& other) noexcept;
+    
+    /**
+     * @brief Move assignment
+     */
+    Trie& operator=(Trie&& other) noexcept;
+    
     // Basic Trie Operations
     
     /**
      * @brief Insert word into trie
      * @param word Word to insert
      * Time Complexity: O(m) where m is word length
-     * Space Complexity: O(m) in worst case
+     * Space Complexity: O(1) new nodes (at most one split and one leaf)
      */
     void insert(const std::string& word);
     
+    /**
+     * @brief Insert word with a ranking score
+     * @param word Word to insert
+     * @param score Score used by top_completions (replaces any previous score)
+     * Time Complexity: O(m) without the top-k cache, O(m + d * k) with it
+     * where d is the number of nodes on the path
+     * Space Complexity: O(1) new nodes
+     */
+    void insert(const std::string& word, int score);
+    
     /**
      * @brief Search for exact word in trie
      * @param word Word to search for
@@ -320,7 +742,7 @@ public:
      * @param word Word to remove
      * @return True if word was removed
      * Time Complexity: O(m) where m is word length
-     * Space Complexity: O(m) for recursion
+     * Space Complexity: O(d) where d is the number of nodes on the path
      */
     bool remove(const std::string& word);
     
@@ -370,6 +792,21 @@ public:
      */
     std::vector<std::string> auto_complete(const std::string& prefix, int max_suggestions = 10) const;
     
+    /**
+     * @brief Find words within an edit distance of a query ("did you mean")
+     * @param query Query string
+     * @param max_distance Maximum Levenshtein distance
+     * @param max_results Maximum number of matches to return
+     * @return Matches ordered by distance, ties alphabetically
+     *
+     * Walks the trie with one banded DP row per character and prunes a
+     * subtree as soon as every cell of its row exceeds max_distance, so the
+     * cost depends on the explored frontier rather than the word count.
+     * Time Complexity: O(v * d) where v is the number of visited characters
+     * Space Complexity: O(h * m) where h is the deepest visited path, m the query length
+     */
+    std::vector<FuzzyMatch> fuzzy_search(const std::string& query, int max_distance, int max_results = 10) const;
+    
     /**
      * @brief Find shortest unique prefix for each word
      * @param words Vector of words
@@ -379,6 +816,52 @@ public:
      */
     static std::vector<std::string> shortest_unique_prefixes(const std::vector<std::string>& words);
     
+    /**
+     * @brief Highest scoring words with given prefix
+     * @param prefix Prefix to get suggestions for
+     * @param max_suggestions Maximum number of suggestions
+     * @return Completions ordered by descending score, ties alphabetically
+     * Time Complexity: O(p + k) when served from the top-k cache,
+     * otherwise O(p + n log k) where n is number of nodes in subtree
+     * Space Complexity: O(k)
+     */
+    std::vector<Completion> top_completions(const std::string& prefix, int max_suggestions = 10) const;
+    
+    /**
+     * @brief Keep the best k completions precomputed at every node
+     * @param k Cache depth (0 disables the cache and frees it)
+     *
+     * Once enabled the cache is maintained by insert and remove, and
+     * top_completions answers requests for up to k suggestions without
+     * visiting the subtree.
+     * Time Complexity: O(n * k) where n is number of nodes
+     * Space Complexity: O(n * k)
+     */
+    void enable_top_k_cache(int k);
+    
+    /**
+     * @brief Get depth of the top-k cache
+     * @return Cache depth (0 when disabled)
+     */
+    int top_k_cache_size() const { return static_cast<int>(cache_k_); }
+    
+    /**
+     * @brief Build a trie from words in ascending order in one pass
+     * @param first Iterator to the first word
+     * @param last Iterator past the last word
+     * @return Trie holding the words (duplicates raise word counts)
+     * @throws std::invalid_argument if the words are not sorted
+     *
+     * Each word only differs from its predecessor below their common
+     * prefix, so the builder keeps the path of the previous word and
+     * attaches the new suffix where the paths diverge, without searching
+     * from the root or splitting more than one edge.
+     * Time Complexity: O(n) where n is total number of characters
+     * Space Complexity: O(h) beyond the trie, h is the longest word
+     */
+    template<typename InputIt>
+    static Trie from_sorted(InputIt first, InputIt last);
+    
     // Utility Methods
     
     /**
@@ -393,8 +876,18 @@ public:
      */
     int size() const;
     
+    /**
+     * @brief Get number of allocated nodes (including the root)
+     * @return Node count
+     */
+    size_t node_count() const { return node_count_; }
+    
     /**
      * @brief Clear all words from trie
+     *
+     * Returns the node, child block and label arenas at once without
+     * visiting any node.
+     * Time Complexity: O(b + s) where b is the number of arena blocks, s the number of scored words
      */
     void clear();
     
@@ -402,18 +895,240 @@ public:
      * @brief Print all words in trie (for debugging)
      */
     void print_words() const;
+    
+    /**
+     * @brief Build a compact read-only copy of this trie
+     * @return LOUDS-encoded FrozenTrie (see frozen_trie.h)
+     * Time Complexity: O(n) where n is the number of characters stored
+     * Space Complexity: O(n) bits
+     */
+    FrozenTrie freeze() const;
 
 private:
-    std::unique_ptr<TrieNode> root_;
+    friend class FrozenTrie;
+    
+    NodePool<TrieNode> nodes_;  // Arena holding every node of this trie
+    ChildMap::Blocks child_blocks_;  // Out-of-line child containers of those nodes
+    std::string labels_;  // Label arena; bytes orphaned by remove are reclaimed by clear()
+    TrieNode* root_;
     int total_words_;
+    size_t node_count_;
+    size_t cache_k_;
+    
+    // Scores and cached completions live beside the nodes, so tries that
+    // use neither pay nothing per node
+    std::unordered_map<const TrieNode*, int> scores_;  // Non-zero scores of word nodes
+    std::unordered_map<const TrieNode*, std::vector<Completion>> top_;  // Non-empty lists, only while cache_k_ > 0
+    
+    using Spine = std::vector<std::pair<TrieNode*, size_t>>;  // Node and depth below it
+    
+    struct CompletionOrder {
+        bool operator()(const Completion& a, const Completion& b) const {
+            return a.score > b.score || (a.score == b.score && a.word < b.word);
+        }
+    };
     
     // Helper methods
-    TrieNode* find_node(const std::string& prefix) const;
-    void collect_words(TrieNode* node, const std::string& prefix, std::vector<std::string>& words) const;
-    void collect_words_limited(TrieNode* node, const std::string& prefix, 
+    TrieNode* insert_path(const std::string& word, std::vector<TrieNode*>& path, bool& inserted);
+    void append_sorted(const std::string& word, Spine& spine, std::string& previous);
+    void offer_completion(const std::vector<TrieNode*>& path, const std::string& word, int score);
+    void refresh_completions(const std::vector<TrieNode*>& path, const std::string& word);
+    void rebuild_completions(TrieNode* node, std::string& prefix);
+    void merge_child_completions(TrieNode* node, const std::string& prefix);
+    int score_of(const TrieNode* node) const;
+    void set_score(const TrieNode* node, int score);
+    const std::vector<Completion>& cached_top(const TrieNode* node) const;
+    void fuzzy_collect(const TrieNode* node, std::string& prefix, const std::string& query,
+                       int max_distance, std::vector<int>& rows, std::vector<FuzzyMatch>& matches) const;
+    void collect_top(const TrieNode* node, std::string& prefix,
+                     TopKAccumulator<Completion, CompletionOrder>& best) const;
+    std::string_view label(const TrieNode* node) const {
+        return std::string_view(labels_.data() + node->label_offset, node->label_length);
+    }
+    size_t store_label(const std::string& text, size_t pos);
+    TrieNode* new_node(size_t label_offset, size_t label_length);
+    TrieNode* split_edge(TrieNode* child, size_t cut);
+    void free_node(TrieNode* node);
+    TrieNode* find_node(const std::string& prefix, std::string* path = nullptr) const;
+    void collect_words(const TrieNode* node, std::string& prefix, std::vector<std::string>& words) const;
+    void collect_words_limited(const TrieNode* node, std::string& prefix, 
                               std::vector<std::string>& words, int& count, int limit) const;
-    bool remove_helper(TrieNode* node, const std::string& word, int index);
-    void print_words_helper(TrieNode* node, const std::string& prefix) const;
+    void merge_with_only_child(TrieNode* parent, TrieNode* node);
+    void print_words_helper(const TrieNode* node, std::string& prefix) const;
+};
+
+/**
+ * @brief Tournament (loser) tree over k sorted runs
+ *
+ * Each internal node stores the source index that lost the match played
+ * there, and the overall winner is kept separately. Advancing the winner
+ * replays only its leaf-to-root path, so every output element costs about
+ * log2(k) comparisons against the 2*log2(k) of a binary heap, and no
+ * (value, array, index) tuples are moved around. Ties are broken by source
+ * index, which makes the merge stable.
+ */
+template<typename T, typename Compare = std::less<T>>
+class LoserTree {
+public:
+    using Run = std::pair<const T*, const T*>;
+
+    /**
+     * @brief Build the tournament over the given runs
+     * @param runs Half-open [begin, end) ranges, each sorted by comp
+     * @param comp Comparator defining the merge order
+     * Time Complexity: O(k)
+     * Space Complexity: O(k)
+     */
+    explicit LoserTree(const std::vector<Run>& runs, const Compare& comp = Compare());
+
+    /**
+     * @brief Check if all runs are exhausted
+     * @return True if no elements remain
+     * Time Complexity: O(1)
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the current smallest element across all runs
+     * @return Reference to the winning element
+     * @throws std::runtime_error if tree is empty
+     * Time Complexity: O(1)
+     */
+    const T& top() const;
+
+    /**
+     * @brief Get the run index the current winner comes from
+     * @return Index into the runs passed at construction
+     */
+    size_t top_source() const { return tree_[0]; }
+
+    /**
+     * @brief Advance the winning run and replay its path
+     * @throws std::runtime_error if tree is empty
+     * Time Complexity: O(log k)
+     * Space Complexity: O(1)
+     */
+    void pop();
+
+    /**
+     * @brief Drain all remaining elements in merged order
+     * @param out Destination with room for every remaining element
+     * @return Pointer one past the last element written
+     * Time Complexity: O(n log k)
+     * Space Complexity: O(1)
+     */
+    T* merge_into(T* out);
+
+private:
+    std::vector<Run> runs_;
+    std::vector<size_t> tree_;  // tree_[0] = winner, tree_[1..k-1] = losers
+    size_t k_;
+    Compare compare_;
+
+    bool beats(size_t a, size_t b) const;
+    void replay();
+};
+
+/**
+ * @brief Streaming bounded-memory top-k accumulator
+ *
+ * Keeps only the k best values seen so far in a heap whose root is the worst
+ * retained value (the threshold). Once full, a candidate that does not beat
+ * the threshold is rejected with a single comparison and never touches the
+ * heap, which is the common case on long scans. Accumulators filled by
+ * different threads can be combined with merge().
+ *
+ * Compare(a, b) returns true if a ranks ahead of b: std::greater keeps the
+ * k largest values, std::less the k smallest.
+ */
+template<typename T, typename Compare = std::greater<T>>
+class TopKAccumulator {
+public:
+    /**
+     * @brief Constructor
+     * @param k Number of values to keep
+     * @param comp Ranking comparator
+     */
+    explicit TopKAccumulator(size_t k, const Compare& comp = Compare());
+    
+    /**
+     * @brief Offer a value to the accumulator
+     * @param value Candidate value
+     * @return True if the value was kept
+     * Time Complexity: O(1) when rejected, O(log k) otherwise
+     * Space Complexity: O(1)
+     */
+    bool push(const T& value);
+    
+    /**
+     * @brief Offer a batch of values
+     * @param first Beginning of the batch
+     * @param last End of the batch
+     * Time Complexity: O(n) plus O(log k) per kept value
+     * Space Complexity: O(1)
+     */
+    template<typename InputIt>
+    void push_range(InputIt first, InputIt last);
+    
+    /**
+     * @brief Fold another accumulator into this one
+     * @param other Accumulator built over a disjoint part of the input
+     * Time Complexity: O(k log k)
+     * Space Complexity: O(1)
+     */
+    void merge(const TopKAccumulator& other);
+    
+    /**
+     * @brief Get the worst value currently kept
+     * @return Reference to the threshold value
+     * @throws std::runtime_error if accumulator is empty
+     * Time Complexity: O(1)
+     */
+    const T& threshold() const;
+    
+    /**
+     * @brief Get the kept values, best first
+     * @return Sorted vector of at most k values
+     * Time Complexity: O(k log k)
+     * Space Complexity: O(k)
+     */
+    std::vector<T> result() const;
+    
+    /**
+     * @brief Check if k values have been kept
+     * @return True once the accumulator is full
+     */
+    bool full() const { return heap_.size() >= k_; }
+    
+    /**
+     * @brief Check if no values are kept
+     * @return True if empty
+     */
+    bool empty() const { return heap_.empty(); }
+    
+    /**
+     * @brief Get number of kept values
+     * @return Current size (at most k)
+     */
+    size_t size() const { return heap_.size(); }
+    
+    /**
+     * @brief Get the configured k
+     * @return Maximum number of kept values
+     */
+    size_t capacity() const { return k_; }
+    
+    /**
+     * @brief Drop all kept values
+     */
+    void clear() { heap_.clear(); }
+
+private:
+    std::vector<T> heap_;  // Heap ordered by compare_, root is the worst kept value
+    size_t k_;
+    Compare compare_;
+    
+    void replace_threshold(const T& value);
 };
 
 // Heap Utility Functions
@@ -462,15 +1177,81 @@ template<typename T>
 T find_kth_smallest(const std::vector<T>& arr, int k);
 
 /**
- * @brief Merge k sorted arrays using heap
+ * @brief Merge k sorted arrays (delegates to loser_tree_merge)
  * @param arrays Vector of sorted arrays
  * @return Merged sorted array
  * Time Complexity: O(n log k) where n is total elements, k is number of arrays
- * Space Complexity: O(k)
+ * Space Complexity: O(k) besides the output
  */
 template<typename T>
 std::vector<T> merge_k_sorted_arrays(const std::vector<std::vector<T>>& arrays);
 
+/**
+ * @brief Compute top-k over a range with per-thread accumulators
+ * @param first Beginning of the input
+ * @param last End of the input
+ * @param k Number of values to keep
+ * @param num_threads Number of workers (0 uses hardware concurrency)
+ * @param comp Ranking comparator
+ * @return Accumulator holding the k best values of the whole range
+ * Time Complexity: O(n / p + p * k log k)
+ * Space Complexity: O(p * k)
+ */
+template<typename RandomIt, typename Compare = std::greater<typename std::iterator_traits<RandomIt>::value_type>>
+TopKAccumulator<typename std::iterator_traits<RandomIt>::value_type, Compare>
+parallel_top_k(RandomIt first, RandomIt last, size_t k, size_t num_threads = 0,
+               const Compare& comp = Compare());
+
+/**
+ * @brief Merge k sorted arrays using a loser tree
+ * @param arrays Vector of arrays, each sorted by comp
+ * @param comp Comparator defining the merge order
+ * @return Merged sorted array (stable: equal elements keep array order)
+ * Time Complexity: O(n log k) with one comparison per tree level
+ * Space Complexity: O(k) besides the output
+ */
+template<typename T, typename Compare = std::less<T>>
+std::vector<T> loser_tree_merge(const std::vector<std::vector<T>>& arrays,
+                                const Compare& comp = Compare());
+
+/**
+ * @brief Find split positions of the element with a given global rank
+ *
+ * Multisequence selection: returns one position per array such that the
+ * positions sum to rank and every element before a split precedes every
+ * element after any split in the stable merged order.
+ *
+ * @param arrays Vector of arrays, each sorted by comp
+ * @param rank Number of elements that should fall before the splits
+ * @param comp Comparator defining the merge order
+ * @return Split position for each array
+ * @throws std::out_of_range if rank exceeds the total element count
+ * Time Complexity: O(k log k log n)
+ * Space Complexity: O(k)
+ */
+template<typename T, typename Compare = std::less<T>>
+std::vector<size_t> multisequence_select(const std::vector<std::vector<T>>& arrays,
+                                         size_t rank, const Compare& comp = Compare());
+
+/**
+ * @brief Merge k sorted arrays in parallel
+ *
+ * The output is cut into num_threads equal slices; each worker locates its
+ * slice boundaries with multisequence_select and merges its own part of
+ * every input with a loser tree, so no synchronisation is needed.
+ *
+ * @param arrays Vector of arrays, each sorted by comp
+ * @param num_threads Number of workers (0 uses hardware concurrency)
+ * @param comp Comparator defining the merge order
+ * @return Merged sorted array, identical to loser_tree_merge
+ * Time Complexity: O((n / p) log k + k log k log n) per worker
+ * Space Complexity: O(p * k) besides the output
+ */
+template<typename T, typename Compare = std::less<T>>
+std::vector<T> parallel_loser_tree_merge(const std::vector<std::vector<T>>& arrays,
+                                         size_t num_threads = 0,
+                                         const Compare& comp = Compare());
+
 } // namespace data_structures
 } // namespace leetcode_study_guide
 
@@ -8,9 +8,11 @@
 #ifndef LEETCODE_STUDY_GUIDE_HEAP_TPP
 #define LEETCODE_STUDY_GUIDE_HEAP_TPP
 
+#include "slice_runner.h"
 #include <iostream>
 #include <queue>
 #include <algorithm>
+#include <thread>
 
 namespace leetcode_study_guide {
 namespace data_structures {
@@ -23,6 +25,12 @@ Heap<T, Compare>::Heap(const std::vector<T>& data, const Compare& comp)
     build_heap();
 }
 
+template<typename T, typename Compare>
+Heap<T, Compare>::Heap(std::vector<T>&& data, const Compare& comp) 
+    : data_(std::move(data)), compare_(comp) {
+    build_heap();
+}
+
 template<typename T, typename Compare>
 Heap<T, Compare>::Heap(std::initializer_list<T> init_list, const Compare& comp) 
     : data_(init_list), compare_(comp) {
@@ -35,14 +43,46 @@ void Heap<T, Compare>::push(const T& value) {
     heapify_up(data_.size() - 1);
 }
 
+template<typename T, typename Compare>
+void Heap<T, Compare>::push(T&& value) {
+    data_.push_back(std::move(value));
+    heapify_up(data_.size() - 1);
+}
+
+template<typename T, typename Compare>
+template<typename... Args>
+void Heap<T, Compare>::emplace(Args&&... args) {
+    data_.emplace_back(std::forward<Args>(args)...);
+    heapify_up(data_.size() - 1);
+}
+
+template<typename T, typename Compare>
+template<typename InputIt>
+void Heap<T, Compare>::push_range(InputIt first, InputIt last) {
+    size_t old_size = data_.size();
+    data_.insert(data_.end(), first, last);
+    size_t added = data_.size() - old_size;
+    
+    // Rebuilding costs O(n + m); sifting each new element costs O(m log n)
+    if (added > old_size / 8) {
+        build_heap();
+    } else {
+        for (size_t i = old_size; i < data_.size(); ++i) {
+            heapify_up(i);
+        }
+    }
+}
+
 template<typename T, typename Compare>
 T Heap<T, Compare>::pop() {
     if (empty()) {
         throw std::runtime_error("Heap is empty");
     }
     
-    T result = data_[0];
-    data_[0] = data_.back();
+    T result = std::move(data_[0]);
+    if (data_.size() > 1) {
+        data_[0] = std::move(data_.back());
+    }
     data_.pop_back();
     
     if (!empty()) {
@@ -52,6 +92,23 @@ T Heap<T, Compare>::pop() {
     return result;
 }
 
+template<typename T, typename Compare>
+void Heap<T, Compare>::pop(T& out) {
+    if (empty()) {
+        throw std::runtime_error("Heap is empty");
+    }
+    
+    out = std::move(data_[0]);
+    if (data_.size() > 1) {
+        data_[0] = std::move(data_.back());
+    }
+    data_.pop_back();
+    
+    if (!empty()) {
+        heapify_down(0);
+    }
+}
+
 template<typename T, typename Compare>
 const T& Heap<T, Compare>::top() const {
     if (empty()) {
@@ -78,35 +135,34 @@ void Heap<T, Compare>::merge(const Heap& other) {
 
 template<typename T, typename Compare>
 std::vector<T> Heap<T, Compare>::heap_sort() {
+    // data_ already satisfies the heap property, so the copy can be sorted directly
     std::vector<T> result = data_;
-    
-    // Create a new heap with the same data and comparator
-    Heap<T, Compare> heap_copy(data_, compare_);
-    
-    // Extract elements in heap order
-    for (int i = result.size() - 1; i >= 0; --i) {
-        result[i] = heap_copy.pop();
-    }
-    
-    // Always reverse for min heap to get descending order as expected by tests
+    sort_heap_in_place(result, compare_);
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+template<typename T, typename Compare>
+std::vector<T> Heap<T, Compare>::drain_sorted() {
+    std::vector<T> result = std::move(data_);
+    data_.clear();
+    sort_heap_in_place(result, compare_);
     std::reverse(result.begin(), result.end());
-    
     return result;
 }
 
 template<typename T, typename Compare>
 void Heap<T, Compare>::heap_sort_array(std::vector<T>& arr, const Compare& comp) {
-    // Build heap
-    Heap<T, Compare> heap(arr, comp);
-    
-    // Extract elements in heap order
-    for (int i = arr.size() - 1; i >= 0; --i) {
-        arr[i] = heap.pop();
+    // Build heap in place
+    for (size_t i = arr.size() / 2; i-- > 0;) {
+        sift_down(arr, i, arr.size(), comp);
     }
     
-    // For min heap (std::less), pop() gives smallest first, so we get ascending order
-    // But the test expects descending order for min heap, so we reverse
-    // For max heap (std::greater), pop() gives largest first, so we get descending order
+    // Moving each top to the end leaves arr in reverse comparator order
+    sort_heap_in_place(arr, comp);
+    
+    // For min heap (std::less) that is descending, so reverse to ascending
+    // For max heap (std::greater) that is already ascending
     if (std::is_same_v<Compare, std::less<T>>) {
         std::reverse(arr.begin(), arr.end());
     }
@@ -114,12 +170,17 @@ void Heap<T, Compare>::heap_sort_array(std::vector<T>& arr, const Compare& comp)
 
 template<typename T, typename Compare>
 T Heap<T, Compare>::replace_top(const T& new_value) {
+    return replace_top(T(new_value));
+}
+
+template<typename T, typename Compare>
+T Heap<T, Compare>::replace_top(T&& new_value) {
     if (empty()) {
         throw std::runtime_error("Heap is empty");
     }
     
-    T old_value = data_[0];
-    data_[0] = new_value;
+    T old_value = std::move(data_[0]);
+    data_[0] = std::move(new_value);
     heapify_down(0);
     return old_value;
 }
@@ -130,7 +191,9 @@ void Heap<T, Compare>::remove_at(size_t index) {
         throw std::out_of_range("Index out of range");
     }
     
-    data_[index] = data_.back();
+    if (index + 1 < data_.size()) {
+        data_[index] = std::move(data_.back());
+    }
     data_.pop_back();
     
     if (index < data_.size()) {
@@ -150,11 +213,11 @@ void Heap<T, Compare>::update_at(size_t index, const T& new_value) {
         throw std::out_of_range("Index out of range");
     }
     
-    T old_value = data_[index];
+    // Determine direction to heapify
+    bool moves_up = compare_(new_value, data_[index]);
     data_[index] = new_value;
     
-    // Determine direction to heapify
-    if (compare_(new_value, old_value)) {
+    if (moves_up) {
         heapify_up(index);
     } else {
         heapify_down(index);
@@ -165,52 +228,18 @@ template<typename T, typename Compare>
 std::vector<T> Heap<T, Compare>::find_k_largest(int k) const {
     if (k <= 0) return {};
     
-    // Use min heap to find k largest
-    std::priority_queue<T, std::vector<T>, std::greater<T>> min_heap;
-    
-    for (const T& element : data_) {
-        if (min_heap.size() < static_cast<size_t>(k)) {
-            min_heap.push(element);
-        } else if (element > min_heap.top()) {
-            min_heap.pop();
-            min_heap.push(element);
-        }
-    }
-    
-    std::vector<T> result;
-    while (!min_heap.empty()) {
-        result.push_back(min_heap.top());
-        min_heap.pop();
-    }
-    
-    std::reverse(result.begin(), result.end());
-    return result;
+    TopKAccumulator<T, std::greater<T>> top_k(static_cast<size_t>(k));
+    top_k.push_range(data_.begin(), data_.end());
+    return top_k.result();
 }
 
 template<typename T, typename Compare>
 std::vector<T> Heap<T, Compare>::find_k_smallest(int k) const {
     if (k <= 0) return {};
     
-    // Use max heap to find k smallest
-    std::priority_queue<T> max_heap;
-    
-    for (const T& element : data_) {
-        if (max_heap.size() < static_cast<size_t>(k)) {
-            max_heap.push(element);
-        } else if (element < max_heap.top()) {
-            max_heap.pop();
-            max_heap.push(element);
-        }
-    }
-    
-    std::vector<T> result;
-    while (!max_heap.empty()) {
-        result.push_back(max_heap.top());
-        max_heap.pop();
-    }
-    
-    std::reverse(result.begin(), result.end());
-    return result;
+    TopKAccumulator<T, std::less<T>> top_k(static_cast<size_t>(k));
+    top_k.push_range(data_.begin(), data_.end());
+    return top_k.result();
 }
 
 template<typename T, typename Compare>
@@ -247,38 +276,54 @@ void Heap<T, Compare>::print_heap() const {
 
 template<typename T, typename Compare>
 void Heap<T, Compare>::heapify_up(size_t index) {
+    // Move parents down into a hole instead of swapping at every level
+    if (index == 0 || !compare_(data_[index], data_[parent(index)])) {
+        return;
+    }
+    
+    T value = std::move(data_[index]);
     while (index > 0) {
         size_t parent_idx = parent(index);
-        if (!compare_(data_[index], data_[parent_idx])) {
+        if (!compare_(value, data_[parent_idx])) {
             break;
         }
         
-        std::swap(data_[index], data_[parent_idx]);
+        data_[index] = std::move(data_[parent_idx]);
         index = parent_idx;
     }
+    data_[index] = std::move(value);
 }
 
 template<typename T, typename Compare>
 void Heap<T, Compare>::heapify_down(size_t index) {
-    while (left_child(index) < data_.size()) {
-        size_t left_idx = left_child(index);
-        size_t right_idx = right_child(index);
-        size_t target_idx = index;
-        
-        if (compare_(data_[left_idx], data_[target_idx])) {
-            target_idx = left_idx;
-        }
-        
-        if (right_idx < data_.size() && compare_(data_[right_idx], data_[target_idx])) {
-            target_idx = right_idx;
-        }
-        
-        if (target_idx == index) {
-            break;
-        }
-        
-        std::swap(data_[index], data_[target_idx]);
-        index = target_idx;
+    sift_down(data_, index, data_.size(), compare_);
+}
+
+template<typename T, typename Compare>
+void Heap<T, Compare>::sift_down(std::vector<T>& arr, size_t index, size_t size, const Compare& comp) {
+    size_t child = left_child(index);
+    if (child >= size) return;
+    if (child + 1 < size && comp(arr[child + 1], arr[child])) ++child;
+    if (!comp(arr[child], arr[index])) return;
+    
+    // Move children up into a hole instead of swapping at every level
+    T value = std::move(arr[index]);
+    do {
+        arr[index] = std::move(arr[child]);
+        index = child;
+        child = left_child(index);
+        if (child >= size) break;
+        if (child + 1 < size && comp(arr[child + 1], arr[child])) ++child;
+    } while (comp(arr[child], value));
+    arr[index] = std::move(value);
+}
+
+template<typename T, typename Compare>
+void Heap<T, Compare>::sort_heap_in_place(std::vector<T>& arr, const Compare& comp) {
+    // Repeatedly swap the top behind the shrinking heap
+    for (size_t end = arr.size(); end > 1; --end) {
+        std::swap(arr[0], arr[end - 1]);
+        sift_down(arr, 0, end - 1, comp);
     }
 }
 
@@ -320,6 +365,429 @@ bool Heap<T, Compare>::is_heap_helper(size_t index) const {
     return true;
 }
 
+// MinMaxHeap Implementation
+
+template<typename T, typename Compare>
+MinMaxHeap<T, Compare>::MinMaxHeap(const std::vector<T>& data, const Compare& comp)
+    : data_(data), compare_(comp) {
+    heapify();
+}
+
+template<typename T, typename Compare>
+MinMaxHeap<T, Compare>::MinMaxHeap(std::initializer_list<T> init_list, const Compare& comp)
+    : data_(init_list), compare_(comp) {
+    heapify();
+}
+
+template<typename T, typename Compare>
+void MinMaxHeap<T, Compare>::push(const T& value) {
+    data_.push_back(value);
+    push_up(data_.size() - 1);
+}
+
+template<typename T, typename Compare>
+const T& MinMaxHeap<T, Compare>::min() const {
+    if (empty()) {
+        throw std::runtime_error("Heap is empty");
+    }
+    return data_[0];
+}
+
+template<typename T, typename Compare>
+const T& MinMaxHeap<T, Compare>::max() const {
+    if (empty()) {
+        throw std::runtime_error("Heap is empty");
+    }
+    return data_[max_index()];
+}
+
+template<typename T, typename Compare>
+T MinMaxHeap<T, Compare>::pop_min() {
+    if (empty()) {
+        throw std::runtime_error("Heap is empty");
+    }
+    
+    T result = std::move(data_[0]);
+    if (data_.size() > 1) {
+        data_[0] = std::move(data_.back());
+    }
+    data_.pop_back();
+    
+    if (!empty()) {
+        push_down(0);
+    }
+    return result;
+}
+
+template<typename T, typename Compare>
+T MinMaxHeap<T, Compare>::pop_max() {
+    if (empty()) {
+        throw std::runtime_error("Heap is empty");
+    }
+    
+    size_t index = max_index();
+    T result = std::move(data_[index]);
+    if (index + 1 < data_.size()) {
+        data_[index] = std::move(data_.back());
+    }
+    data_.pop_back();
+    
+    if (index < data_.size()) {
+        push_down(index);
+    }
+    return result;
+}
+
+template<typename T, typename Compare>
+T MinMaxHeap<T, Compare>::replace_min(const T& new_value) {
+    if (empty()) {
+        throw std::runtime_error("Heap is empty");
+    }
+    
+    T old_value = std::move(data_[0]);
+    data_[0] = new_value;
+    push_down(0);
+    return old_value;
+}
+
+template<typename T, typename Compare>
+T MinMaxHeap<T, Compare>::replace_max(const T& new_value) {
+    if (empty()) {
+        throw std::runtime_error("Heap is empty");
+    }
+    
+    size_t index = max_index();
+    T old_value = std::move(data_[index]);
+    data_[index] = new_value;
+    
+    // A max-level slot may now hold something below the root minimum
+    if (index > 0 && compare_(data_[index], data_[0])) {
+        std::swap(data_[index], data_[0]);
+    }
+    push_down(index);
+    return old_value;
+}
+
+template<typename T, typename Compare>
+bool MinMaxHeap<T, Compare>::push_bounded(const T& value, size_t capacity) {
+    if (data_.size() < capacity) {
+        push(value);
+        return true;
+    }
+    if (empty() || !compare_(value, data_[max_index()])) {
+        return false;
+    }
+    
+    replace_max(value);
+    return true;
+}
+
+template<typename T, typename Compare>
+void MinMaxHeap<T, Compare>::heapify() {
+    for (size_t i = data_.size() / 2; i-- > 0;) {
+        push_down(i);
+    }
+}
+
+template<typename T, typename Compare>
+bool MinMaxHeap<T, Compare>::is_heap() const {
+    // Checking children and grandchildren is enough: the property is transitive
+    for (size_t i = 0; i < data_.size(); ++i) {
+        bool min_level = is_min_level(i);
+        for (size_t j = 2 * i + 1; j <= 2 * i + 2 && j < data_.size(); ++j) {
+            const T& descendant = data_[j];
+            if (min_level ? compare_(descendant, data_[i]) : compare_(data_[i], descendant)) {
+                return false;
+            }
+            for (size_t g = 2 * j + 1; g <= 2 * j + 2 && g < data_.size(); ++g) {
+                if (min_level ? compare_(data_[g], data_[i]) : compare_(data_[i], data_[g])) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T, typename Compare>
+bool MinMaxHeap<T, Compare>::is_min_level(size_t index) {
+    // Level of index i is floor(log2(i + 1)); even levels hold minima
+    size_t level = 0;
+    for (size_t n = index + 1; n > 1; n >>= 1) {
+        ++level;
+    }
+    return level % 2 == 0;
+}
+
+template<typename T, typename Compare>
+size_t MinMaxHeap<T, Compare>::max_index() const {
+    if (data_.size() <= 2) {
+        return data_.size() - 1;
+    }
+    return compare_(data_[1], data_[2]) ? 2 : 1;
+}
+
+template<typename T, typename Compare>
+template<bool MinLevel>
+bool MinMaxHeap<T, Compare>::ordered(const T& a, const T& b) const {
+    // True if a belongs above b on a level of the given kind
+    return MinLevel ? compare_(a, b) : compare_(b, a);
+}
+
+template<typename T, typename Compare>
+void MinMaxHeap<T, Compare>::push_up(size_t index) {
+    if (index == 0) return;
+    
+    size_t parent_idx = (index - 1) / 2;
+    if (is_min_level(index)) {
+        if (compare_(data_[parent_idx], data_[index])) {
+            std::swap(data_[index], data_[parent_idx]);
+            push_up_level<false>(parent_idx);
+        } else {
+            push_up_level<true>(index);
+        }
+    } else {
+        if (compare_(data_[index], data_[parent_idx])) {
+            std::swap(data_[index], data_[parent_idx]);
+            push_up_level<true>(parent_idx);
+        } else {
+            push_up_level<false>(index);
+        }
+    }
+}
+
+template<typename T, typename Compare>
+template<bool MinLevel>
+void MinMaxHeap<T, Compare>::push_up_level(size_t index) {
+    // Climb two levels at a time, staying on levels of the same kind
+    while (index >= 3) {
+        size_t grandparent = ((index - 1) / 2 - 1) / 2;
+        if (!ordered<MinLevel>(data_[index], data_[grandparent])) {
+            break;
+        }
+        std::swap(data_[index], data_[grandparent]);
+        index = grandparent;
+    }
+}
+
+template<typename T, typename Compare>
+void MinMaxHeap<T, Compare>::push_down(size_t index) {
+    if (is_min_level(index)) {
+        push_down_level<true>(index);
+    } else {
+        push_down_level<false>(index);
+    }
+}
+
+template<typename T, typename Compare>
+template<bool MinLevel>
+void MinMaxHeap<T, Compare>::push_down_level(size_t index) {
+    const size_t n = data_.size();
+    
+    while (2 * index + 1 < n) {
+        // Find the most extreme element among children and grandchildren
+        size_t best = 2 * index + 1;
+        size_t last = std::min(4 * index + 6, n - 1);
+        for (size_t j = 2 * index + 2; j <= 2 * index + 2 && j < n; ++j) {
+            if (ordered<MinLevel>(data_[j], data_[best])) best = j;
+        }
+        for (size_t j = 4 * index + 3; j <= last; ++j) {
+            if (ordered<MinLevel>(data_[j], data_[best])) best = j;
+        }
+        
+        if (!ordered<MinLevel>(data_[best], data_[index])) {
+            return;
+        }
+        
+        std::swap(data_[best], data_[index]);
+        if (best <= 2 * index + 2) {
+            return;  // Child of the opposite kind: nothing below it to fix
+        }
+        
+        size_t parent_idx = (best - 1) / 2;
+        if (ordered<MinLevel>(data_[parent_idx], data_[best])) {
+            std::swap(data_[best], data_[parent_idx]);
+        }
+        index = best;
+    }
+}
+
+// LoserTree Implementation
+
+template<typename T, typename Compare>
+LoserTree<T, Compare>::LoserTree(const std::vector<Run>& runs, const Compare& comp)
+    : runs_(runs), tree_(std::max<size_t>(runs.size(), 1), 0), k_(runs.size()), compare_(comp) {
+    if (k_ <= 1) return;
+
+    // Play the initial tournament bottom-up; leaves live at positions k..2k-1
+    std::vector<size_t> winners(2 * k_);
+    for (size_t i = 0; i < k_; ++i) {
+        winners[k_ + i] = i;
+    }
+    for (size_t node = k_ - 1; node > 0; --node) {
+        size_t left = winners[2 * node];
+        size_t right = winners[2 * node + 1];
+        if (beats(left, right)) {
+            winners[node] = left;
+            tree_[node] = right;
+        } else {
+            winners[node] = right;
+            tree_[node] = left;
+        }
+    }
+    tree_[0] = winners[1];
+}
+
+template<typename T, typename Compare>
+bool LoserTree<T, Compare>::empty() const {
+    return k_ == 0 || runs_[tree_[0]].first == runs_[tree_[0]].second;
+}
+
+template<typename T, typename Compare>
+const T& LoserTree<T, Compare>::top() const {
+    if (empty()) {
+        throw std::runtime_error("Loser tree is empty");
+    }
+    return *runs_[tree_[0]].first;
+}
+
+template<typename T, typename Compare>
+void LoserTree<T, Compare>::pop() {
+    if (empty()) {
+        throw std::runtime_error("Loser tree is empty");
+    }
+
+    ++runs_[tree_[0]].first;
+    replay();
+}
+
+template<typename T, typename Compare>
+T* LoserTree<T, Compare>::merge_into(T* out) {
+    while (!empty()) {
+        *out++ = *runs_[tree_[0]].first++;
+        replay();
+    }
+    return out;
+}
+
+template<typename T, typename Compare>
+void LoserTree<T, Compare>::replay() {
+    size_t winner = tree_[0];
+
+    // Walk from the winner's leaf to the root; each stored loser challenges it
+    for (size_t node = (winner + k_) / 2; node > 0; node /= 2) {
+        if (beats(tree_[node], winner)) {
+            std::swap(tree_[node], winner);
+        }
+    }
+    tree_[0] = winner;
+}
+
+template<typename T, typename Compare>
+bool LoserTree<T, Compare>::beats(size_t a, size_t b) const {
+    // Exhausted runs act as +infinity
+    if (runs_[a].first == runs_[a].second) return false;
+    if (runs_[b].first == runs_[b].second) return true;
+
+    // One comparison per match: ties go to the lower run index, which
+    // keeps the merge stable
+    if (a < b) return !compare_(*runs_[b].first, *runs_[a].first);
+    return compare_(*runs_[a].first, *runs_[b].first);
+}
+
+// TopKAccumulator Implementation
+
+template<typename T, typename Compare>
+TopKAccumulator<T, Compare>::TopKAccumulator(size_t k, const Compare& comp)
+    : k_(k), compare_(comp) {
+    heap_.reserve(k);
+}
+
+template<typename T, typename Compare>
+bool TopKAccumulator<T, Compare>::push(const T& value) {
+    if (k_ == 0) {
+        return false;
+    }
+    if (heap_.size() < k_) {
+        heap_.push_back(value);
+        std::push_heap(heap_.begin(), heap_.end(), compare_);
+        return true;
+    }
+    
+    // Fast path: anything not ranking ahead of the threshold is discarded
+    if (!compare_(value, heap_.front())) {
+        return false;
+    }
+    
+    replace_threshold(value);
+    return true;
+}
+
+template<typename T, typename Compare>
+template<typename InputIt>
+void TopKAccumulator<T, Compare>::push_range(InputIt first, InputIt last) {
+    if (k_ == 0) {
+        return;  // Keeps nothing, and there is no threshold to compare against
+    }
+    
+    // Fill up with a single O(k) heapify instead of k sift-ups
+    if (heap_.size() < k_ && first != last) {
+        while (heap_.size() < k_ && first != last) {
+            heap_.push_back(*first);
+            ++first;
+        }
+        std::make_heap(heap_.begin(), heap_.end(), compare_);
+    }
+    
+    for (; first != last; ++first) {
+        if (compare_(*first, heap_.front())) {
+            replace_threshold(*first);
+        }
+    }
+}
+
+template<typename T, typename Compare>
+void TopKAccumulator<T, Compare>::merge(const TopKAccumulator& other) {
+    if (k_ == 0) {
+        return;
+    }
+    push_range(other.heap_.begin(), other.heap_.end());
+}
+
+template<typename T, typename Compare>
+const T& TopKAccumulator<T, Compare>::threshold() const {
+    if (heap_.empty()) {
+        throw std::runtime_error("Accumulator is empty");
+    }
+    return heap_.front();
+}
+
+template<typename T, typename Compare>
+std::vector<T> TopKAccumulator<T, Compare>::result() const {
+    std::vector<T> sorted = heap_;
+    std::sort_heap(sorted.begin(), sorted.end(), compare_);
+    return sorted;
+}
+
+template<typename T, typename Compare>
+void TopKAccumulator<T, Compare>::replace_threshold(const T& value) {
+    // Sift the new value down from the root, moving children up into the hole
+    size_t size = heap_.size();
+    size_t index = 0;
+    while (2 * index + 1 < size) {
+        size_t child = 2 * index + 1;
+        if (child + 1 < size && compare_(heap_[child], heap_[child + 1])) {
+            ++child;
+        }
+        if (!compare_(value, heap_[child])) {
+            break;
+        }
+        heap_[index] = std::move(heap_[child]);
+        index = child;
+    }
+    heap_[index] = value;
+}
+
 // Standalone utility functions implementation
 
 template<typename T, typename Compare>
@@ -355,18 +823,9 @@ T find_kth_largest(const std::vector<T>& arr, int k) {
         throw std::out_of_range("k is out of range");
     }
     
-    MinHeap<T> min_heap;
-    
-    for (const T& element : arr) {
-        if (min_heap.size() < static_cast<size_t>(k)) {
-            min_heap.push(element);
-        } else if (element > min_heap.top()) {
-            min_heap.pop();
-            min_heap.push(element);
-        }
-    }
-    
-    return min_heap.top();
+    TopKAccumulator<T, std::greater<T>> top_k(static_cast<size_t>(k));
+    top_k.push_range(arr.begin(), arr.end());
+    return top_k.threshold();
 }
 
 template<typename T>
@@ -375,54 +834,193 @@ T find_kth_smallest(const std::vector<T>& arr, int k) {
         throw std::out_of_range("k is out of range");
     }
     
-    MaxHeap<T> max_heap;
-    
-    for (const T& element : arr) {
-        if (max_heap.size() < static_cast<size_t>(k)) {
-            max_heap.push(element);
-        } else if (element < max_heap.top()) {
-            max_heap.pop();
-            max_heap.push(element);
-        }
-    }
-    
-    return max_heap.top();
+    TopKAccumulator<T, std::less<T>> top_k(static_cast<size_t>(k));
+    top_k.push_range(arr.begin(), arr.end());
+    return top_k.threshold();
 }
 
 template<typename T>
 std::vector<T> merge_k_sorted_arrays(const std::vector<std::vector<T>>& arrays) {
-    std::vector<T> result;
+    // One comparison per tree level instead of a heap's two, and no
+    // (value, array, index) copies per element
+    return loser_tree_merge(arrays, std::less<T>());
+}
+
+template<typename RandomIt, typename Compare>
+TopKAccumulator<typename std::iterator_traits<RandomIt>::value_type, Compare>
+parallel_top_k(RandomIt first, RandomIt last, size_t k, size_t num_threads, const Compare& comp) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    const size_t min_elements_per_thread = 1 << 16;
+    
+    size_t total = static_cast<size_t>(last - first);
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    num_threads = std::min(num_threads, std::max<size_t>(1, total / min_elements_per_thread));
     
-    // Min heap to store {value, array_index, element_index}
-    using HeapElement = std::tuple<T, size_t, size_t>;
-    auto comp = [](const HeapElement& a, const HeapElement& b) {
-        return std::get<0>(a) > std::get<0>(b);
+    // One thread-local accumulator per slice, reduced at the end
+    std::vector<TopKAccumulator<T, Compare>> partials(num_threads, TopKAccumulator<T, Compare>(k, comp));
+    auto scan_slice = [&](size_t slice) {
+        RandomIt begin = first + static_cast<std::ptrdiff_t>(total * slice / num_threads);
+        RandomIt end = first + static_cast<std::ptrdiff_t>(total * (slice + 1) / num_threads);
+        partials[slice].push_range(begin, end);
     };
     
-    std::priority_queue<HeapElement, std::vector<HeapElement>, decltype(comp)> min_heap(comp);
+    detail::run_slices(num_threads, scan_slice);
     
-    // Initialize heap with first element from each array
-    for (size_t i = 0; i < arrays.size(); ++i) {
-        if (!arrays[i].empty()) {
-            min_heap.push(std::make_tuple(arrays[i][0], i, 0));
-        }
+    for (size_t slice = 1; slice < num_threads; ++slice) {
+        partials[0].merge(partials[slice]);
+    }
+    return partials[0];
+}
+
+template<typename T, typename Compare>
+std::vector<T> loser_tree_merge(const std::vector<std::vector<T>>& arrays, const Compare& comp) {
+    using Run = typename LoserTree<T, Compare>::Run;
+    
+    std::vector<Run> runs;
+    runs.reserve(arrays.size());
+    size_t total = 0;
+    for (const auto& array : arrays) {
+        runs.emplace_back(array.data(), array.data() + array.size());
+        total += array.size();
     }
     
-    while (!min_heap.empty()) {
-        auto [value, array_idx, elem_idx] = min_heap.top();
-        min_heap.pop();
+    std::vector<T> result(total);
+    LoserTree<T, Compare> tree(runs, comp);
+    tree.merge_into(result.data());
+    return result;
+}
+
+template<typename T, typename Compare>
+std::vector<size_t> multisequence_select(const std::vector<std::vector<T>>& arrays,
+                                         size_t rank, const Compare& comp) {
+    const size_t k = arrays.size();
+    std::vector<size_t> lo(k, 0), hi(k), lower(k), upper(k);
+    size_t total = 0;
+    for (size_t i = 0; i < k; ++i) {
+        hi[i] = arrays[i].size();
+        total += hi[i];
+    }
+    
+    if (rank > total) {
+        throw std::out_of_range("rank is out of range");
+    }
+    if (rank == 0) return lo;
+    if (rank == total) return hi;
+    
+    // Elements left of lo[i] are known to precede the target and elements from
+    // hi[i] on are known to follow it, so only the windows need searching.
+    std::vector<std::pair<const T*, size_t>> candidates;
+    while (true) {
+        // Pivot on the weighted median of the window midpoints; every round then
+        // discards at least a quarter of the remaining window elements.
+        candidates.clear();
+        size_t total_weight = 0;
+        for (size_t i = 0; i < k; ++i) {
+            if (lo[i] < hi[i]) {
+                candidates.emplace_back(&arrays[i][lo[i] + (hi[i] - lo[i]) / 2], hi[i] - lo[i]);
+                total_weight += hi[i] - lo[i];
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(),
+                  [&comp](const auto& a, const auto& b) { return comp(*a.first, *b.first); });
+        
+        const T* pivot = candidates.back().first;
+        size_t weight = 0;
+        for (const auto& candidate : candidates) {
+            weight += candidate.second;
+            if (2 * weight >= total_weight) {
+                pivot = candidate.first;
+                break;
+            }
+        }
         
-        result.push_back(value);
+        size_t less = 0, less_equal = 0;
+        for (size_t i = 0; i < k; ++i) {
+            auto first = arrays[i].begin();
+            lower[i] = std::lower_bound(first + lo[i], first + hi[i], *pivot, comp) - first;
+            upper[i] = std::upper_bound(first + lower[i], first + hi[i], *pivot, comp) - first;
+            less += lower[i];
+            less_equal += upper[i];
+        }
         
-        // Add next element from the same array
-        if (elem_idx + 1 < arrays[array_idx].size()) {
-            min_heap.push(std::make_tuple(arrays[array_idx][elem_idx + 1], array_idx, elem_idx + 1));
+        if (less_equal < rank) {
+            lo = upper;
+        } else if (less > rank) {
+            hi = lower;
+        } else {
+            // Split inside the run of elements equal to the pivot, giving them
+            // out in array order to stay consistent with the stable merge.
+            size_t needed = rank - less;
+            for (size_t i = 0; i < k; ++i) {
+                size_t take = std::min(needed, upper[i] - lower[i]);
+                lower[i] += take;
+                needed -= take;
+            }
+            return lower;
         }
     }
+}
+
+template<typename T, typename Compare>
+std::vector<T> parallel_loser_tree_merge(const std::vector<std::vector<T>>& arrays,
+                                         size_t num_threads, const Compare& comp) {
+    // Below this many elements per worker the split cost is not worth it
+    const size_t min_elements_per_thread = 1 << 16;
+    
+    size_t total = 0;
+    for (const auto& array : arrays) {
+        total += array.size();
+    }
+    
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    num_threads = std::min(num_threads, std::max<size_t>(1, total / min_elements_per_thread));
+    if (num_threads <= 1 || arrays.size() <= 1) {
+        return loser_tree_merge(arrays, comp);
+    }
     
+    using Run = typename LoserTree<T, Compare>::Run;
+    std::vector<T> result(total);
+    
+    auto merge_slice = [&](size_t slice) {
+        size_t begin_rank = total / num_threads * slice + std::min(slice, total % num_threads);
+        size_t end_rank = begin_rank + total / num_threads + (slice < total % num_threads ? 1 : 0);
+        
+        std::vector<size_t> begin_split = multisequence_select(arrays, begin_rank, comp);
+        std::vector<size_t> end_split = multisequence_select(arrays, end_rank, comp);
+        
+        std::vector<Run> runs;
+        runs.reserve(arrays.size());
+        for (size_t i = 0; i < arrays.size(); ++i) {
+            if (begin_split[i] < end_split[i]) {
+                runs.emplace_back(arrays[i].data() + begin_split[i], arrays[i].data() + end_split[i]);
+            }
+        }
+        
+        LoserTree<T, Compare> tree(runs, comp);
+        tree.merge_into(result.data() + begin_rank);
+    };
+    
+    detail::run_slices(num_threads, merge_slice);
     return result;
 }
 
+// Trie Bulk Construction
+
+template<typename InputIt>
+Trie Trie::from_sorted(InputIt first, InputIt last) {
+    Trie trie;
+    Spine spine;
+    std::string previous;
+    for (; first != last; ++first) {
+        trie.append_sorted(*first, spine, previous);
+    }
+    return trie;
+}
+
 } // namespace data_structures
 } // namespace leetcode_study_guide
 
@@ -0,0 +1,179 @@
+/**
+ * @file lca_index.h
+ * @brief Preprocessed lowest-common-ancestor queries over a fixed BinaryTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_LCA_INDEX_H
+#define LEETCODE_STUDY_GUIDE_LCA_INDEX_H
+
+#include "tree.h"
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Constant-time LCA and ancestor-path queries for a tree that does not change
+ *
+ * Building the index numbers the nodes 0..n-1 in preorder, so every
+ * subtree is a contiguous id range, and records each node's parent and
+ * depth. For ids u < v that are not equal, the LCA is the parent with the
+ * smallest id among the nodes u+1..v (the child of the LCA on the way to v
+ * is in that range, and every other node in it lies below the LCA). A
+ * sparse table of range minima over the parent ids answers that in two
+ * lookups. Preprocessing is O(n log n) time and memory (about 4 log2(n)
+ * bytes per node), and rebuild() reuses the buffers when the tree changes.
+ *
+ * Values are mapped to the first node holding them in preorder. Queries
+ * only read the index, so any number of threads may query concurrently.
+ */
+template<typename T, typename Node = TreeNode<T>>
+class LcaIndex {
+public:
+    using NodePtr = std::shared_ptr<Node>;
+    using NodeId = uint32_t;
+    static constexpr NodeId kNoNode = std::numeric_limits<NodeId>::max();
+
+    /**
+     * @brief Create an empty index
+     */
+    LcaIndex() = default;
+
+    /**
+     * @brief Build the index for a tree
+     * @param tree Tree to index
+     * Time Complexity: O(n log n)
+     * Space Complexity: O(n log n)
+     */
+    explicit LcaIndex(const BinaryTree<T, Node>& tree) { rebuild(tree); }
+
+    /**
+     * @brief Re-index after the tree was modified or replaced
+     * @param tree Tree to index
+     * Time Complexity: O(n log n)
+     * Space Complexity: O(n log n), reusing existing buffers
+     */
+    void rebuild(const BinaryTree<T, Node>& tree);
+
+    /**
+     * @brief Look up the dense id of a value
+     * @param value Value to look up
+     * @return Id of the first node in preorder holding value, or kNoNode
+     * Time Complexity: O(1) expected
+     */
+    NodeId id_of(const T& value) const;
+
+    /**
+     * @brief Get the node with a given id
+     * @param id Node id
+     * @return Node pointer
+     * @throws std::out_of_range if id is invalid
+     */
+    NodePtr node(NodeId id) const { return nodes_.at(id); }
+
+    /**
+     * @brief Get the depth of a node (root has depth 0)
+     * @param id Node id
+     * @return Depth in edges
+     * @throws std::out_of_range if id is invalid
+     */
+    uint32_t depth(NodeId id) const { return depth_.at(id); }
+
+    /**
+     * @brief Lowest common ancestor of two nodes by id
+     * @param a First node id
+     * @param b Second node id
+     * @return Id of the LCA
+     * @throws std::out_of_range if an id is invalid
+     * Time Complexity: O(1)
+     * Space Complexity: O(1)
+     */
+    NodeId lca(NodeId a, NodeId b) const;
+
+    /**
+     * @brief Lowest common ancestor of two values
+     * @param val1 First value
+     * @param val2 Second value
+     * @return LCA node, nullptr if either value is absent
+     * Time Complexity: O(1) expected
+     * Space Complexity: O(1)
+     */
+    NodePtr lowest_common_ancestor(const T& val1, const T& val2) const;
+
+    /**
+     * @brief Number of edges between two nodes
+     * @param a First node id
+     * @param b Second node id
+     * @return Path length in edges
+     * @throws std::out_of_range if an id is invalid
+     * Time Complexity: O(1)
+     */
+    uint32_t distance(NodeId a, NodeId b) const;
+
+    /**
+     * @brief Path from the root to a value, following parent links
+     * @param target Target value
+     * @return Values from root to target, empty if target is absent
+     * Time Complexity: O(d) where d is the depth of target
+     * Space Complexity: O(d)
+     */
+    std::vector<T> find_path(const T& target) const;
+
+    /**
+     * @brief Answer many id queries, optionally in parallel
+     * @param queries Pairs of node ids
+     * @param threads Worker threads (0 = hardware concurrency)
+     * @return LCA id for each query, in query order
+     * @throws std::out_of_range if an id is invalid
+     * Time Complexity: O(q / threads)
+     * Space Complexity: O(q)
+     */
+    std::vector<NodeId> lca_batch(const std::vector<std::pair<NodeId, NodeId>>& queries,
+                                  unsigned threads = 0) const;
+
+    /**
+     * @brief Answer many value queries, optionally in parallel
+     * @param queries Pairs of values
+     * @param threads Worker threads (0 = hardware concurrency)
+     * @return LCA node for each query (nullptr if a value is absent)
+     * Time Complexity: O(q / threads) expected
+     * Space Complexity: O(q)
+     */
+    std::vector<NodePtr> lowest_common_ancestors(const std::vector<std::pair<T, T>>& queries,
+                                                 unsigned threads = 0) const;
+
+    /**
+     * @brief Get number of indexed nodes
+     * @return Node count
+     */
+    size_t size() const { return nodes_.size(); }
+
+    /**
+     * @brief Check if the index is empty
+     * @return True if no nodes are indexed
+     */
+    bool empty() const { return nodes_.empty(); }
+
+private:
+    std::vector<NodePtr> nodes_;        // Indexed by preorder id
+    std::vector<NodeId> parent_;        // kNoNode for the root
+    std::vector<uint32_t> depth_;
+    std::vector<std::vector<NodeId>> min_parent_;  // Level k: min parent id over [i, i + 2^k)
+    std::unordered_map<T, NodeId> ids_;
+
+    template<typename Function>
+    static void parallel_for(size_t count, unsigned threads, Function&& body);
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "lca_index.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_LCA_INDEX_H
@@ -0,0 +1,171 @@
+/**
+ * @file lca_index.tpp
+ * @brief Template implementation for LcaIndex
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_LCA_INDEX_TPP
+#define LEETCODE_STUDY_GUIDE_LCA_INDEX_TPP
+
+#include "slice_runner.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// LcaIndex Implementation
+
+template<typename T, typename Node>
+void LcaIndex<T, Node>::rebuild(const BinaryTree<T, Node>& tree) {
+    nodes_.clear();
+    parent_.clear();
+    depth_.clear();
+    ids_.clear();
+
+    // Iterative preorder numbering (safe for degenerate trees)
+    std::vector<std::pair<NodePtr, NodeId>> stack;
+    if (tree.get_root()) {
+        stack.emplace_back(tree.get_root(), kNoNode);
+    }
+    while (!stack.empty()) {
+        NodePtr current = std::move(stack.back().first);
+        NodeId parent = stack.back().second;
+        stack.pop_back();
+
+        if (nodes_.size() >= kNoNode) {
+            throw std::length_error("Tree is too large to index");
+        }
+        NodeId id = static_cast<NodeId>(nodes_.size());
+        nodes_.push_back(current);
+        parent_.push_back(parent);
+        depth_.push_back(parent == kNoNode ? 0 : depth_[parent] + 1);
+        ids_.emplace(current->data, id);  // Keeps the first occurrence
+
+        if (current->right) stack.emplace_back(current->right, id);
+        if (current->left) stack.emplace_back(current->left, id);
+    }
+
+    // Sparse table of minimum parent id; level 0 is the parent array itself
+    size_t n = nodes_.size();
+    size_t levels = 1;
+    while ((size_t(1) << levels) <= n) ++levels;
+    min_parent_.resize(levels);
+    min_parent_[0].assign(parent_.begin(), parent_.end());
+    for (size_t k = 1; k < levels; ++k) {
+        size_t half = size_t(1) << (k - 1);
+        const std::vector<NodeId>& previous = min_parent_[k - 1];
+        std::vector<NodeId>& row = min_parent_[k];
+        row.resize(n - (size_t(1) << k) + 1);
+        for (size_t i = 0; i < row.size(); ++i) {
+            row[i] = std::min(previous[i], previous[i + half]);
+        }
+    }
+}
+
+template<typename T, typename Node>
+typename LcaIndex<T, Node>::NodeId LcaIndex<T, Node>::id_of(const T& value) const {
+    auto it = ids_.find(value);
+    return it == ids_.end() ? kNoNode : it->second;
+}
+
+template<typename T, typename Node>
+typename LcaIndex<T, Node>::NodeId LcaIndex<T, Node>::lca(NodeId a, NodeId b) const {
+    if (a >= nodes_.size() || b >= nodes_.size()) {
+        throw std::out_of_range("Node id is out of range");
+    }
+    if (a == b) return a;
+    if (a > b) std::swap(a, b);
+
+    // Minimum parent id over ids [a + 1, b]
+    unsigned long long length = b - a;
+#if defined(__GNUC__) || defined(__clang__)
+    size_t level = 63 - __builtin_clzll(length);
+#else
+    size_t level = 0;
+    while ((2ull << level) <= length) ++level;
+#endif
+    const std::vector<NodeId>& row = min_parent_[level];
+    return std::min(row[a + 1], row[b + 1 - (size_t(1) << level)]);
+}
+
+template<typename T, typename Node>
+typename LcaIndex<T, Node>::NodePtr LcaIndex<T, Node>::lowest_common_ancestor(const T& val1, const T& val2) const {
+    NodeId a = id_of(val1);
+    NodeId b = id_of(val2);
+    if (a == kNoNode || b == kNoNode) return nullptr;
+    return nodes_[lca(a, b)];
+}
+
+template<typename T, typename Node>
+uint32_t LcaIndex<T, Node>::distance(NodeId a, NodeId b) const {
+    NodeId ancestor = lca(a, b);
+    return depth_[a] + depth_[b] - 2 * depth_[ancestor];
+}
+
+template<typename T, typename Node>
+std::vector<T> LcaIndex<T, Node>::find_path(const T& target) const {
+    std::vector<T> path;
+    for (NodeId id = id_of(target); id != kNoNode; id = parent_[id]) {
+        path.push_back(nodes_[id]->data);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+template<typename T, typename Node>
+std::vector<typename LcaIndex<T, Node>::NodeId> LcaIndex<T, Node>::lca_batch(
+    const std::vector<std::pair<NodeId, NodeId>>& queries, unsigned threads) const {
+    for (const auto& query : queries) {
+        if (query.first >= nodes_.size() || query.second >= nodes_.size()) {
+            throw std::out_of_range("Node id is out of range");
+        }
+    }
+
+    std::vector<NodeId> results(queries.size());
+    parallel_for(queries.size(), threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = lca(queries[i].first, queries[i].second);
+        }
+    });
+    return results;
+}
+
+template<typename T, typename Node>
+std::vector<typename LcaIndex<T, Node>::NodePtr> LcaIndex<T, Node>::lowest_common_ancestors(
+    const std::vector<std::pair<T, T>>& queries, unsigned threads) const {
+    std::vector<NodePtr> results(queries.size());
+    parallel_for(queries.size(), threads, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = lowest_common_ancestor(queries[i].first, queries[i].second);
+        }
+    });
+    return results;
+}
+
+template<typename T, typename Node>
+template<typename Function>
+void LcaIndex<T, Node>::parallel_for(size_t count, unsigned threads, Function&& body) {
+    // Small batches are not worth a thread start
+    const size_t min_chunk = 4096;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t workers = std::min<size_t>(threads, (count + min_chunk - 1) / min_chunk);
+    if (workers <= 1) {
+        body(size_t(0), count);
+        return;
+    }
+
+    size_t chunk = (count + workers - 1) / workers;
+    detail::run_slices((count + chunk - 1) / chunk, [&body, chunk, count](size_t slice) {
+        body(slice * chunk, std::min(count, slice * chunk + chunk));
+    });
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_LCA_INDEX_TPP
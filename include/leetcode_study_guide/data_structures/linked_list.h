@@ -74,9 +74,22 @@ public:
     SinglyLinkedList(const std::vector<T>& values);
 
     /**
-     * @brief Destructor
+     * @brief Copy constructor (shallow: the copy shares the nodes)
+     * @param other List to copy
      */
-    ~SinglyLinkedList() = default;
+    SinglyLinkedList(const SinglyLinkedList& other) = default;
+
+    /**
+     * @brief Copy assignment (releases this list's nodes first)
+     * @param other List to copy
+     * @return Reference to this list
+     */
+    SinglyLinkedList& operator=(const SinglyLinkedList& other);
+
+    /**
+     * @brief Destructor (iterative, see clear())
+     */
+    ~SinglyLinkedList() { clear(); }
 
     // Basic Operations
 
@@ -237,6 +250,12 @@ public:
 
     /**
      * @brief Clear all elements from list
+     *
+     * Nodes are unlinked one at a time, so no shared_ptr destructor
+     * recurses down the list; nodes still shared with a copy or a handle
+     * stay alive.
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
      */
     void clear();
 
@@ -295,9 +314,22 @@ public:
     DoublyLinkedList(const std::vector<T>& values);
 
     /**
-     * @brief Destructor
+     * @brief Copy constructor (shallow: the copy shares the nodes)
+     * @param other List to copy
+     */
+    DoublyLinkedList(const DoublyLinkedList& other) = default;
+
+    /**
+     * @brief Copy assignment (releases this list's nodes first)
+     * @param other List to copy
+     * @return Reference to this list
+     */
+    DoublyLinkedList& operator=(const DoublyLinkedList& other);
+
+    /**
+     * @brief Destructor (iterative, see clear())
      */
-    ~DoublyLinkedList() = default;
+    ~DoublyLinkedList() { clear(); }
 
     // Basic Operations
 
@@ -394,6 +426,12 @@ public:
 
     /**
      * @brief Clear all elements from list
+     *
+     * Nodes are unlinked one at a time, so no shared_ptr destructor
+     * recurses down the list; nodes still shared with a copy or a handle
+     * stay alive.
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
      */
     void clear();
 
@@ -457,9 +495,22 @@ public:
     CircularLinkedList(std::initializer_list<T> init_list);
 
     /**
-     * @brief Destructor
+     * @brief Copy constructor (shallow: the copy shares the nodes)
+     * @param other List to copy
+     */
+    CircularLinkedList(const CircularLinkedList& other) = default;
+
+    /**
+     * @brief Copy assignment (releases this list's nodes first)
+     * @param other List to copy
+     * @return Reference to this list
+     */
+    CircularLinkedList& operator=(const CircularLinkedList& other);
+
+    /**
+     * @brief Destructor (iterative, see clear())
      */
-    ~CircularLinkedList() = default;
+    ~CircularLinkedList() { clear(); }
 
     // Basic Operations
 
@@ -509,6 +560,12 @@ public:
 
     /**
      * @brief Clear all elements from list
+     *
+     * Nodes are unlinked one at a time, so no shared_ptr destructor
+     * recurses down the list; nodes still shared with a copy or a handle
+     * stay alive.
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
      */
     void clear();
 
@@ -8,10 +8,26 @@
 #include <stdexcept>
 #include <iostream>
 #include <queue>
+#include <utility>
 
 namespace leetcode_study_guide {
 namespace data_structures {
 
+namespace linked_list_detail {
+
+// Destroys a chain of nodes front to back, detaching each node's successor
+// before the node dies so no destructor recurses. Stops at a node that is
+// still shared; its other owner keeps the rest of the chain
+template<typename Node>
+void release_chain(std::shared_ptr<Node> node) {
+    while (node && node.use_count() == 1) {
+        std::shared_ptr<Node> next = std::move(node->next);
+        node = std::move(next);
+    }
+}
+
+} // namespace linked_list_detail
+
 // SinglyLinkedList Implementation
 
 template<typename T>
@@ -376,8 +392,19 @@ bool SinglyLinkedList<T>::is_palindrome() const {
     return is_palindrome;
 }
 
+template<typename T>
+SinglyLinkedList<T>& SinglyLinkedList<T>::operator=(const SinglyLinkedList& other) {
+    if (this != &other) {
+        clear();
+        head_ = other.head_;
+        size_ = other.size_;
+    }
+    return *this;
+}
+
 template<typename T>
 void SinglyLinkedList<T>::clear() {
+    linked_list_detail::release_chain(std::move(head_));
     head_ = nullptr;
     size_ = 0;
 }
@@ -608,9 +635,22 @@ void DoublyLinkedList<T>::reverse() {
     std::swap(head_, tail_);
 }
 
+template<typename T>
+DoublyLinkedList<T>& DoublyLinkedList<T>::operator=(const DoublyLinkedList& other) {
+    if (this != &other) {
+        clear();
+        head_ = other.head_;
+        tail_ = other.tail_;
+        size_ = other.size_;
+    }
+    return *this;
+}
+
 template<typename T>
 void DoublyLinkedList<T>::clear() {
-    head_ = tail_ = nullptr;
+    tail_ = nullptr;  // prev links are weak, so head_ now owns the chain alone
+    linked_list_detail::release_chain(std::move(head_));
+    head_ = nullptr;
     size_ = 0;
 }
 
@@ -769,17 +809,26 @@ void CircularLinkedList<T>::pop_back() {
     size_--;
 }
 
+template<typename T>
+CircularLinkedList<T>& CircularLinkedList<T>::operator=(const CircularLinkedList& other) {
+    if (this != &other) {
+        clear();
+        head_ = other.head_;
+        size_ = other.size_;
+    }
+    return *this;
+}
+
 template<typename T>
 void CircularLinkedList<T>::clear() {
-    if (head_) {
-        // Break the circular link first
-        auto last = head_;
-        while (last->next != head_) {
-            last = last->next;
-        }
-        last->next = nullptr;
+    if (head_ && head_.use_count() <= 2) {
+        // Only this list and the last node hold the head (a copy would keep
+        // the cycle). Break the cycle at the head; the last node then owns
+        // the head, so releasing from the second node frees every node in order
+        auto rest = std::move(head_->next);
+        head_ = nullptr;
+        linked_list_detail::release_chain(std::move(rest));
     }
-    
     head_ = nullptr;
     size_ = 0;
 }
@@ -0,0 +1,73 @@
+/**
+ * @file mapped_file.h
+ * @brief Read-only memory-mapped file for zero-copy loading of frozen structures
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_MAPPED_FILE_H
+#define LEETCODE_STUDY_GUIDE_MAPPED_FILE_H
+
+#include "../common.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief RAII wrapper around a read-only file mapping
+ *
+ * On POSIX systems the file is mapped with mmap, so opening is O(1) and
+ * pages are loaded lazily by the OS. Elsewhere the file is read into an
+ * aligned heap buffer so callers can use the same code path.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map the whole file read-only
+     * @param path Path of the file to map
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+    
+    /**
+     * @brief Destructor (unmaps the file)
+     */
+    ~MappedFile();
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    /**
+     * @brief Get start of the mapped bytes
+     * @return Pointer to the first byte (page aligned when mmap is used)
+     */
+    const void* data() const { return data_; }
+    
+    /**
+     * @brief Get size of the mapping
+     * @return Number of bytes
+     */
+    size_t size() const { return size_; }
+    
+    /**
+     * @brief Write a byte buffer to a file
+     * @param path Destination path (truncated if it exists)
+     * @param data Bytes to write
+     * @param size Number of bytes
+     * @throws std::runtime_error if the file cannot be written
+     */
+    static void write(const std::string& path, const void* data, size_t size);
+
+private:
+    const void* data_;
+    size_t size_;
+    std::vector<unsigned long long> fallback_;  // Used when mmap is unavailable
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_MAPPED_FILE_H
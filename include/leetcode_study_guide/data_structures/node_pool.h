@@ -0,0 +1,113 @@
+/**
+ * @file node_pool.h
+ * @brief Block arena with a free list for fixed-size node allocation
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_NODE_POOL_H
+#define LEETCODE_STUDY_GUIDE_NODE_POOL_H
+
+#include "../common.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Arena of T-sized slots carved from geometrically growing blocks
+ *
+ * Nodes are placed contiguously in blocks of 16 up to 4096 slots, so a
+ * container pays one allocator call per block instead of one per node,
+ * and nodes built together stay together in memory. Destroyed objects
+ * go onto an intrusive free list and are reused first. release() hands
+ * every block back at once; the pool never runs destructors on its own.
+ */
+template<typename T>
+class NodePool {
+public:
+    /**
+     * @brief Default constructor (allocates nothing until first use)
+     */
+    NodePool();
+    
+    /**
+     * @brief Destructor (frees the blocks, not the objects in them)
+     */
+    ~NodePool() = default;
+    
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+    
+    /**
+     * @brief Move constructor (objects keep their addresses)
+     */
+    NodePool(NodePool&& other) noexcept;
+    
+    /**
+     * @brief Move assignment (releases this pool's blocks first)
+     */
+    NodePool& operator=(NodePool&& other) noexcept;
+    
+    /**
+     * @brief Construct an object in a free slot
+     * @param args Constructor arguments
+     * @return Pointer to the new object
+     * Time Complexity: O(1) amortized
+     */
+    template<typename... Args>
+    T* create(Args&&... args);
+    
+    /**
+     * @brief Destroy an object and recycle its slot
+     * @param object Object created by this pool
+     * Time Complexity: O(1)
+     */
+    void destroy(T* object);
+    
+    /**
+     * @brief Free all blocks at once
+     *
+     * Every object must already be destroyed (or be trivially destructible).
+     */
+    void release();
+    
+    /**
+     * @brief Get number of live objects
+     * @return Objects created and not yet destroyed
+     */
+    size_t size() const { return live_; }
+    
+    /**
+     * @brief Get number of slots in all blocks
+     * @return Slot capacity
+     */
+    size_t capacity() const { return capacity_; }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+    
+    static constexpr size_t kFirstBlockSlots = 16;
+    static constexpr size_t kMaxBlockSlots = 4096;
+    
+    std::vector<std::unique_ptr<Slot[]>> blocks_;
+    Slot* free_list_;
+    size_t block_used_;   // Slots handed out from the newest block
+    size_t block_size_;   // Slot count of the newest block
+    size_t capacity_;
+    size_t live_;
+    
+    Slot* acquire();
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "node_pool.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_NODE_POOL_H
@@ -0,0 +1,111 @@
+/**
+ * @file node_pool.tpp
+ * @brief Template implementation for NodePool
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_NODE_POOL_TPP
+#define LEETCODE_STUDY_GUIDE_NODE_POOL_TPP
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// NodePool Implementation
+
+template<typename T>
+NodePool<T>::NodePool()
+    : free_list_(nullptr), block_used_(0), block_size_(0), capacity_(0), live_(0) {}
+
+template<typename T>
+NodePool<T>::NodePool(NodePool&& other) noexcept
+    : blocks_(std::move(other.blocks_)), free_list_(other.free_list_), block_used_(other.block_used_),
+      block_size_(other.block_size_), capacity_(other.capacity_), live_(other.live_) {
+    other.blocks_.clear();
+    other.free_list_ = nullptr;
+    other.block_used_ = 0;
+    other.block_size_ = 0;
+    other.capacity_ = 0;
+    other.live_ = 0;
+}
+
+template<typename T>
+NodePool<T>& NodePool<T>::operator=(NodePool&& other) noexcept {
+    if (this != &other) {
+        blocks_ = std::move(other.blocks_);
+        free_list_ = other.free_list_;
+        block_used_ = other.block_used_;
+        block_size_ = other.block_size_;
+        capacity_ = other.capacity_;
+        live_ = other.live_;
+        other.blocks_.clear();
+        other.free_list_ = nullptr;
+        other.block_used_ = 0;
+        other.block_size_ = 0;
+        other.capacity_ = 0;
+        other.live_ = 0;
+    }
+    return *this;
+}
+
+template<typename T>
+template<typename... Args>
+T* NodePool<T>::create(Args&&... args) {
+    Slot* slot = acquire();
+    try {
+        T* object = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+        ++live_;
+        return object;
+    } catch (...) {
+        slot->next = free_list_;
+        free_list_ = slot;
+        throw;
+    }
+}
+
+template<typename T>
+void NodePool<T>::destroy(T* object) {
+    object->~T();
+    Slot* slot = reinterpret_cast<Slot*>(object);
+    slot->next = free_list_;
+    free_list_ = slot;
+    --live_;
+}
+
+template<typename T>
+void NodePool<T>::release() {
+    blocks_.clear();
+    free_list_ = nullptr;
+    block_used_ = 0;
+    block_size_ = 0;
+    capacity_ = 0;
+    live_ = 0;
+}
+
+// NodePool Helper Methods
+
+template<typename T>
+typename NodePool<T>::Slot* NodePool<T>::acquire() {
+    if (free_list_) {
+        Slot* slot = free_list_;
+        free_list_ = slot->next;
+        return slot;
+    }
+    
+    if (block_used_ == block_size_) {
+        block_size_ = block_size_ == 0 ? kFirstBlockSlots : std::min(block_size_ * 2, kMaxBlockSlots);
+        blocks_.emplace_back(new Slot[block_size_]);
+        block_used_ = 0;
+        capacity_ += block_size_;
+    }
+    return &blocks_.back()[block_used_++];
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_NODE_POOL_TPP
@@ -0,0 +1,110 @@
+/**
+ * @file parallel_tree.h
+ * @brief Parallel fork-join versions of the whole-tree BinaryTree algorithms
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_PARALLEL_TREE_H
+#define LEETCODE_STUDY_GUIDE_PARALLEL_TREE_H
+
+#include "tree.h"
+#include "work_stealing_pool.h"
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * Each function forks the right subtree as a pool task and descends into
+ * the left one itself, down to fork_depth levels below the root, then
+ * finishes each subtree with an iterative (explicit stack) traversal, so
+ * no recursion goes deeper than fork_depth whatever the tree shape.
+ * BinaryTree nodes do not know their subtree sizes, so the cutoff is a
+ * depth: the default, fork_depth < 0, forks log2(workers) + 4 levels,
+ * about 16 tasks per worker, which lets work stealing even out uneven
+ * subtrees. A degenerate tree just runs sequentially.
+ *
+ * Results equal the sequential BinaryTree methods and free functions. The
+ * trees must not be modified while a call is running.
+ */
+
+/**
+ * @brief Calculate tree height in parallel
+ * @param tree Tree to analyze
+ * @param pool Pool running the subtree tasks
+ * @param fork_depth Levels to fork (negative picks a default for the pool size)
+ * @return Height in nodes (0 for an empty tree), as BinaryTree::height()
+ * Time Complexity: O(n / workers) on balanced trees
+ * Space Complexity: O(h) per task
+ */
+template<typename T, typename Node>
+int parallel_height(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth = -1);
+
+/**
+ * @brief Count nodes in parallel
+ * @param tree Tree to analyze
+ * @param pool Pool running the subtree tasks
+ * @param fork_depth Levels to fork (negative picks a default for the pool size)
+ * @return Number of nodes, as BinaryTree::count_nodes()
+ * Time Complexity: O(n / workers) on balanced trees
+ * Space Complexity: O(h) per task
+ */
+template<typename T, typename Node>
+size_t parallel_count_nodes(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth = -1);
+
+/**
+ * @brief Check height balance in parallel
+ * @param tree Tree to analyze
+ * @param pool Pool running the subtree tasks
+ * @param fork_depth Levels to fork (negative picks a default for the pool size)
+ * @return True if every node's subtree heights differ by at most one
+ * Time Complexity: O(n / workers) on balanced trees
+ * Space Complexity: O(h) per task
+ */
+template<typename T, typename Node>
+bool parallel_is_balanced(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth = -1);
+
+/**
+ * @brief Check mirror symmetry in parallel
+ * @param tree Tree to analyze
+ * @param pool Pool running the subtree tasks
+ * @param fork_depth Levels to fork (negative picks a default for the pool size)
+ * @return True if the tree is a mirror of itself; stops early on a mismatch
+ * Time Complexity: O(n / workers) on balanced trees
+ * Space Complexity: O(h) per task
+ */
+template<typename T, typename Node>
+bool parallel_is_symmetric(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth = -1);
+
+/**
+ * @brief Find the diameter in parallel
+ * @param tree Tree to analyze
+ * @param pool Pool running the subtree tasks
+ * @param fork_depth Levels to fork (negative picks a default for the pool size)
+ * @return Length of the longest path in edges, as tree_diameter()
+ * Time Complexity: O(n / workers) on balanced trees
+ * Space Complexity: O(h) per task
+ */
+template<typename T, typename Node>
+int parallel_tree_diameter(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth = -1);
+
+/**
+ * @brief Compare two trees in parallel
+ * @param tree1 First tree
+ * @param tree2 Second tree
+ * @param pool Pool running the subtree tasks
+ * @param fork_depth Levels to fork (negative picks a default for the pool size)
+ * @return True if the trees have the same shape and values; stops early on a mismatch
+ * Time Complexity: O(min(n1, n2) / workers) on balanced trees
+ * Space Complexity: O(h) per task
+ */
+template<typename T, typename Node1, typename Node2>
+bool parallel_are_identical(const BinaryTree<T, Node1>& tree1, const BinaryTree<T, Node2>& tree2,
+                            WorkStealingPool& pool, int fork_depth = -1);
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "parallel_tree.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_PARALLEL_TREE_H
@@ -0,0 +1,193 @@
+/**
+ * @file parallel_tree.tpp
+ * @brief Template implementation for the parallel tree algorithms
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_PARALLEL_TREE_TPP
+#define LEETCODE_STUDY_GUIDE_PARALLEL_TREE_TPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+namespace parallel_tree_detail {
+
+inline int resolve_fork_depth(const WorkStealingPool& pool, int fork_depth) {
+    if (fork_depth >= 0) return fork_depth;
+    int depth = 4;
+    for (unsigned workers = pool.size(); workers > 1; workers /= 2) ++depth;
+    return depth;
+}
+
+// Postorder fold without recursion: combine(node, left, right) per node,
+// with empty standing in for missing children
+template<typename Node, typename Result, typename Combine>
+Result fold_sequential(const Node* root, const Result& empty, const Combine& combine) {
+    if (!root) return empty;
+
+    std::vector<std::pair<const Node*, bool>> stack;  // (node, children pushed)
+    std::vector<Result> results;
+    stack.emplace_back(root, false);
+    while (!stack.empty()) {
+        const Node* node = stack.back().first;
+        if (!stack.back().second) {
+            stack.back().second = true;
+            if (node->right) stack.emplace_back(node->right.get(), false);
+            if (node->left) stack.emplace_back(node->left.get(), false);
+            continue;
+        }
+        stack.pop_back();
+
+        Result right = empty;
+        if (node->right) {
+            right = std::move(results.back());
+            results.pop_back();
+        }
+        Result left = empty;
+        if (node->left) {
+            left = std::move(results.back());
+            results.pop_back();
+        }
+        results.push_back(combine(node, left, right));
+    }
+    return results.back();
+}
+
+template<typename Node, typename Result, typename Combine>
+Result fold_parallel(const Node* node, const Result& empty, const Combine& combine,
+                     WorkStealingPool& pool, int depth) {
+    if (!node) return empty;
+    if (depth == 0 || (!node->left && !node->right)) {
+        return fold_sequential(node, empty, combine);
+    }
+    if (!node->left || !node->right) {
+        // Nothing to fork here; the only child may still fork below
+        const Node* child = node->left ? node->left.get() : node->right.get();
+        Result only = fold_parallel(child, empty, combine, pool, depth - 1);
+        return node->left ? combine(node, only, empty) : combine(node, empty, only);
+    }
+
+    Result right = empty;
+    WorkStealingPool::TaskGroup group(pool);
+    group.spawn([&] { right = fold_parallel(node->right.get(), empty, combine, pool, depth - 1); });
+    Result left = fold_parallel(node->left.get(), empty, combine, pool, depth - 1);
+    group.wait();
+    return combine(node, left, right);
+}
+
+// Pairwise comparison of two subtrees; mirrored pairs a's left with b's right
+template<typename NodeA, typename NodeB>
+bool match_sequential(const NodeA* a, const NodeB* b, bool mirrored,
+                      const std::atomic<bool>& mismatch) {
+    std::vector<std::pair<const NodeA*, const NodeB*>> stack;
+    stack.emplace_back(a, b);
+    while (!stack.empty()) {
+        if (mismatch.load(std::memory_order_relaxed)) return false;
+        const NodeA* x = stack.back().first;
+        const NodeB* y = stack.back().second;
+        stack.pop_back();
+
+        if (!x && !y) continue;
+        if (!x || !y || !(x->data == y->data)) return false;
+        if (mirrored) {
+            stack.emplace_back(x->left.get(), y->right.get());
+            stack.emplace_back(x->right.get(), y->left.get());
+        } else {
+            stack.emplace_back(x->left.get(), y->left.get());
+            stack.emplace_back(x->right.get(), y->right.get());
+        }
+    }
+    return true;
+}
+
+template<typename NodeA, typename NodeB>
+bool match_parallel(const NodeA* a, const NodeB* b, bool mirrored,
+                    std::atomic<bool>& mismatch, WorkStealingPool& pool, int depth) {
+    if (!a || !b || depth == 0) {
+        bool matched = match_sequential(a, b, mirrored, mismatch);
+        if (!matched) mismatch.store(true, std::memory_order_relaxed);
+        return matched;
+    }
+    if (!(a->data == b->data)) {
+        mismatch.store(true, std::memory_order_relaxed);
+        return false;
+    }
+
+    const NodeA* second_a = a->right.get();
+    const NodeB* second_b = mirrored ? b->left.get() : b->right.get();
+    bool second = true;
+    WorkStealingPool::TaskGroup group(pool);
+    group.spawn([&] { second = match_parallel(second_a, second_b, mirrored, mismatch, pool, depth - 1); });
+    bool first = match_parallel(a->left.get(), mirrored ? b->right.get() : b->left.get(),
+                                mirrored, mismatch, pool, depth - 1);
+    group.wait();
+    return first && second;
+}
+
+} // namespace parallel_tree_detail
+
+template<typename T, typename Node>
+int parallel_height(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth) {
+    auto combine = [](const Node*, int left, int right) { return 1 + std::max(left, right); };
+    return parallel_tree_detail::fold_parallel(tree.get_root().get(), 0, combine, pool,
+                                               parallel_tree_detail::resolve_fork_depth(pool, fork_depth));
+}
+
+template<typename T, typename Node>
+size_t parallel_count_nodes(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth) {
+    auto combine = [](const Node*, size_t left, size_t right) { return 1 + left + right; };
+    return parallel_tree_detail::fold_parallel(tree.get_root().get(), size_t(0), combine, pool,
+                                               parallel_tree_detail::resolve_fork_depth(pool, fork_depth));
+}
+
+template<typename T, typename Node>
+bool parallel_is_balanced(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth) {
+    // Height of a balanced subtree, or -1 once any subtree is unbalanced
+    auto combine = [](const Node*, int left, int right) {
+        if (left < 0 || right < 0 || std::abs(left - right) > 1) return -1;
+        return 1 + std::max(left, right);
+    };
+    return parallel_tree_detail::fold_parallel(tree.get_root().get(), 0, combine, pool,
+                                               parallel_tree_detail::resolve_fork_depth(pool, fork_depth)) >= 0;
+}
+
+template<typename T, typename Node>
+bool parallel_is_symmetric(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth) {
+    const Node* root = tree.get_root().get();
+    if (!root) return true;
+    std::atomic<bool> mismatch(false);
+    return parallel_tree_detail::match_parallel(root->left.get(), root->right.get(), true, mismatch, pool,
+                                                parallel_tree_detail::resolve_fork_depth(pool, fork_depth));
+}
+
+template<typename T, typename Node>
+int parallel_tree_diameter(const BinaryTree<T, Node>& tree, WorkStealingPool& pool, int fork_depth) {
+    // (height, diameter) of each subtree
+    using HeightAndDiameter = std::pair<int, int>;
+    auto combine = [](const Node*, const HeightAndDiameter& left, const HeightAndDiameter& right) {
+        int diameter = std::max({left.second, right.second, left.first + right.first});
+        return HeightAndDiameter(1 + std::max(left.first, right.first), diameter);
+    };
+    return parallel_tree_detail::fold_parallel(tree.get_root().get(), HeightAndDiameter(0, 0), combine, pool,
+                                               parallel_tree_detail::resolve_fork_depth(pool, fork_depth)).second;
+}
+
+template<typename T, typename Node1, typename Node2>
+bool parallel_are_identical(const BinaryTree<T, Node1>& tree1, const BinaryTree<T, Node2>& tree2,
+                            WorkStealingPool& pool, int fork_depth) {
+    std::atomic<bool> mismatch(false);
+    return parallel_tree_detail::match_parallel(tree1.get_root().get(), tree2.get_root().get(), false, mismatch,
+                                                pool, parallel_tree_detail::resolve_fork_depth(pool, fork_depth));
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_PARALLEL_TREE_TPP
@@ -0,0 +1,260 @@
+/**
+ * @file persistent_tree.h
+ * @brief Persistent (path-copying) binary search tree with O(1) snapshots
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_PERSISTENT_TREE_H
+#define LEETCODE_STUDY_GUIDE_PERSISTENT_TREE_H
+
+#include "tree.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Immutable version of a binary search tree
+ *
+ * insert and remove leave this version untouched and return a new one
+ * that copies only the O(log n) nodes on the search path; every other
+ * node is shared through the existing shared_ptr links. Nodes are never
+ * modified once a version holds them, so copying a version is an O(1)
+ * snapshot and any number of threads may read any versions concurrently.
+ *
+ * The tree is always AVL balanced (rank is the height, as with
+ * AvlBalance): rotations build fresh nodes instead of relinking shared
+ * ones. Sizes come from SearchTreeNode::subtree_size, so the order statistics
+ * are O(log n) as well. Duplicates are ignored, as in BinarySearchTree.
+ */
+template<typename T>
+class PersistentBinarySearchTree {
+public:
+    using NodePtr = std::shared_ptr<const SearchTreeNode<T>>;
+
+    /**
+     * @brief Create an empty tree
+     */
+    PersistentBinarySearchTree() = default;
+
+    /**
+     * @brief Build a balanced tree from sorted values
+     * @param sorted_values Values in ascending order; repeated values are kept once
+     * @throws std::invalid_argument if the values are not sorted
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    explicit PersistentBinarySearchTree(const std::vector<T>& sorted_values);
+
+    /**
+     * @brief Copy the values of a mutable BST once
+     * @param tree Source tree
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    template<typename BalancePolicy>
+    explicit PersistentBinarySearchTree(const BinarySearchTree<T, BalancePolicy>& tree)
+        : PersistentBinarySearchTree(tree.to_sorted_array()) {}
+
+    /**
+     * @brief Version with a value added
+     * @param value Value to insert
+     * @return New version (shares this version if value is already present)
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n) new nodes
+     */
+    PersistentBinarySearchTree insert(const T& value) const;
+
+    /**
+     * @brief Version with a value removed
+     * @param value Value to remove
+     * @return New version (shares this version if value is absent)
+     * Time Complexity: O(log n)
+     * Space Complexity: O(log n) new nodes
+     */
+    PersistentBinarySearchTree remove(const T& value) const;
+
+    /**
+     * @brief Search for a value
+     * @param value Value to search for
+     * @return True if found
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    bool search(const T& value) const;
+
+    /**
+     * @brief Find minimum value
+     * @return Minimum value
+     * @throws std::runtime_error if tree is empty
+     * Time Complexity: O(log n)
+     */
+    T find_min() const;
+
+    /**
+     * @brief Find maximum value
+     * @return Maximum value
+     * @throws std::runtime_error if tree is empty
+     * Time Complexity: O(log n)
+     */
+    T find_max() const;
+
+    /**
+     * @brief Find kth smallest element (1-indexed)
+     * @param k Position (1-indexed)
+     * @return kth smallest element
+     * @throws std::out_of_range if k is invalid
+     * Time Complexity: O(log n)
+     */
+    T kth_smallest(int k) const;
+
+    /**
+     * @brief Count values smaller than the given value
+     * @param value Value to rank (need not be in the tree)
+     * @return Number of stored values less than value
+     * Time Complexity: O(log n)
+     */
+    size_t rank(const T& value) const;
+
+    /**
+     * @brief Get sorted array of all values
+     * @return Sorted vector of values
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    std::vector<T> to_sorted_array() const;
+
+    /**
+     * @brief Lazy inorder iteration over the values in [lo, hi]
+     * @param lo Inclusive lower bound
+     * @param hi Inclusive upper bound
+     * @return Range of forward iterators in ascending order
+     */
+    TraversalRange<T, SearchTreeNode<T>> range(const T& lo, const T& hi) const {
+        return TraversalRange<T, SearchTreeNode<T>>(TreeIterator<T, SearchTreeNode<T>>(root_.get(), lo, hi));
+    }
+
+    /**
+     * @brief Iterate over all values in ascending order
+     */
+    TreeIterator<T, SearchTreeNode<T>> begin() const { return TreeIterator<T, SearchTreeNode<T>>(root_.get(), TraversalOrder::Inorder); }
+    TreeIterator<T, SearchTreeNode<T>> end() const { return TreeIterator<T, SearchTreeNode<T>>(); }
+
+    /**
+     * @brief Get the root node (shared with every version that contains it)
+     * @return Root node, null if empty
+     */
+    NodePtr get_root() const { return root_; }
+
+    /**
+     * @brief Get number of values
+     * @return Value count
+     */
+    size_t size() const { return root_ ? root_->subtree_size : 0; }
+
+    /**
+     * @brief Check if tree is empty
+     * @return True if empty
+     */
+    bool empty() const { return !root_; }
+
+    /**
+     * @brief Get tree height
+     * @return Height in nodes (0 for an empty tree)
+     */
+    int height() const { return root_ ? root_->rank : 0; }
+
+private:
+    template<typename U>
+    friend class VersionedBinarySearchTree;
+
+    using MutableNodePtr = std::shared_ptr<SearchTreeNode<T>>;
+
+    MutableNodePtr root_;  // Never modified through this pointer once shared
+
+    explicit PersistentBinarySearchTree(MutableNodePtr root) : root_(std::move(root)) {}
+
+    static int height(const MutableNodePtr& node) { return node ? node->rank : 0; }
+    static MutableNodePtr make_node(const T& value, MutableNodePtr left, MutableNodePtr right);
+    static MutableNodePtr balance(const T& value, MutableNodePtr left, MutableNodePtr right);
+    static MutableNodePtr build(const std::vector<T>& values, size_t begin, size_t end);
+    static MutableNodePtr insert_helper(const MutableNodePtr& node, const T& value);
+    static MutableNodePtr remove_helper(const MutableNodePtr& node, const T& value);
+    static MutableNodePtr remove_min(const MutableNodePtr& node, T& min_value);
+};
+
+/**
+ * @brief Shared head of a PersistentBinarySearchTree for concurrent use
+ *
+ * Writers are serialized by a mutex and publish each new version with an
+ * atomic store of the root pointer. snapshot() is an atomic load, so a
+ * reader gets a consistent point-in-time view in O(1) without blocking
+ * on writers, and keeps it for as long as it likes; nodes of versions
+ * nobody holds are freed by the last shared_ptr release.
+ */
+template<typename T>
+class VersionedBinarySearchTree {
+public:
+    /**
+     * @brief Create an empty tree
+     */
+    VersionedBinarySearchTree() = default;
+
+    /**
+     * @brief Start from an existing version
+     * @param initial Initial version
+     */
+    explicit VersionedBinarySearchTree(const PersistentBinarySearchTree<T>& initial) : root_(initial.root_) {}
+
+    VersionedBinarySearchTree(const VersionedBinarySearchTree&) = delete;
+    VersionedBinarySearchTree& operator=(const VersionedBinarySearchTree&) = delete;
+
+    /**
+     * @brief Take a consistent snapshot of the current version
+     * @return Current version
+     * Time Complexity: O(1)
+     */
+    PersistentBinarySearchTree<T> snapshot() const;
+
+    /**
+     * @brief Insert a value and publish the new version
+     * @param value Value to insert
+     * @return True if inserted, false if already present
+     * Time Complexity: O(log n)
+     */
+    bool insert(const T& value);
+
+    /**
+     * @brief Remove a value and publish the new version
+     * @param value Value to remove
+     * @return True if removed, false if absent
+     * Time Complexity: O(log n)
+     */
+    bool remove(const T& value);
+
+    /**
+     * @brief Replace the current version
+     * @param version Version to publish
+     */
+    void publish(const PersistentBinarySearchTree<T>& version);
+
+    /**
+     * @brief Get number of values in the current version
+     * @return Value count
+     */
+    size_t size() const { return snapshot().size(); }
+
+private:
+    std::shared_ptr<SearchTreeNode<T>> root_;  // Accessed only with std::atomic_load/atomic_store
+    std::mutex write_mutex_;
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "persistent_tree.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_PERSISTENT_TREE_H
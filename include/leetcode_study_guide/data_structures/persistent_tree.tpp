@@ -0,0 +1,265 @@
+/**
+ * @file persistent_tree.tpp
+ * @brief Template implementation for PersistentBinarySearchTree and VersionedBinarySearchTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_PERSISTENT_TREE_TPP
+#define LEETCODE_STUDY_GUIDE_PERSISTENT_TREE_TPP
+
+#include <stdexcept>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// PersistentBinarySearchTree Implementation
+
+template<typename T>
+PersistentBinarySearchTree<T>::PersistentBinarySearchTree(const std::vector<T>& sorted_values) {
+    bool has_duplicates = false;
+    for (size_t i = 1; i < sorted_values.size(); ++i) {
+        if (sorted_values[i] < sorted_values[i - 1]) {
+            throw std::invalid_argument("Values must be sorted");
+        }
+        has_duplicates = has_duplicates || !(sorted_values[i - 1] < sorted_values[i]);
+    }
+    if (!has_duplicates) {
+        root_ = build(sorted_values, 0, sorted_values.size());
+        return;
+    }
+
+    // Keep the first of each run of equal values, as repeated inserts would
+    std::vector<T> unique;
+    unique.reserve(sorted_values.size());
+    for (const T& value : sorted_values) {
+        if (unique.empty() || unique.back() < value) {
+            unique.push_back(value);
+        }
+    }
+    root_ = build(unique, 0, unique.size());
+}
+
+template<typename T>
+PersistentBinarySearchTree<T> PersistentBinarySearchTree<T>::insert(const T& value) const {
+    return PersistentBinarySearchTree(insert_helper(root_, value));
+}
+
+template<typename T>
+PersistentBinarySearchTree<T> PersistentBinarySearchTree<T>::remove(const T& value) const {
+    return PersistentBinarySearchTree(remove_helper(root_, value));
+}
+
+template<typename T>
+bool PersistentBinarySearchTree<T>::search(const T& value) const {
+    const SearchTreeNode<T>* current = root_.get();
+    while (current) {
+        if (value < current->data) {
+            current = current->left.get();
+        } else if (current->data < value) {
+            current = current->right.get();
+        } else {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+T PersistentBinarySearchTree<T>::find_min() const {
+    if (!root_) {
+        throw std::runtime_error("Tree is empty");
+    }
+    const SearchTreeNode<T>* current = root_.get();
+    while (current->left) current = current->left.get();
+    return current->data;
+}
+
+template<typename T>
+T PersistentBinarySearchTree<T>::find_max() const {
+    if (!root_) {
+        throw std::runtime_error("Tree is empty");
+    }
+    const SearchTreeNode<T>* current = root_.get();
+    while (current->right) current = current->right.get();
+    return current->data;
+}
+
+template<typename T>
+T PersistentBinarySearchTree<T>::kth_smallest(int k) const {
+    if (k < 1 || static_cast<size_t>(k) > size()) {
+        throw std::out_of_range("k is out of range");
+    }
+
+    size_t index = static_cast<size_t>(k - 1);
+    const SearchTreeNode<T>* current = root_.get();
+    while (true) {
+        size_t left_size = current->left ? current->left->subtree_size : 0;
+        if (index < left_size) {
+            current = current->left.get();
+        } else if (index == left_size) {
+            return current->data;
+        } else {
+            index -= left_size + 1;
+            current = current->right.get();
+        }
+    }
+}
+
+template<typename T>
+size_t PersistentBinarySearchTree<T>::rank(const T& value) const {
+    size_t count = 0;
+    const SearchTreeNode<T>* current = root_.get();
+    while (current) {
+        if (current->data < value) {
+            count += 1 + (current->left ? current->left->subtree_size : 0);
+            current = current->right.get();
+        } else {
+            current = current->left.get();
+        }
+    }
+    return count;
+}
+
+template<typename T>
+std::vector<T> PersistentBinarySearchTree<T>::to_sorted_array() const {
+    std::vector<T> result;
+    result.reserve(size());
+    for (const T& value : *this) {
+        result.push_back(value);
+    }
+    return result;
+}
+
+// PersistentBinarySearchTree Helper Methods
+
+template<typename T>
+typename PersistentBinarySearchTree<T>::MutableNodePtr PersistentBinarySearchTree<T>::make_node(
+    const T& value, MutableNodePtr left, MutableNodePtr right) {
+    auto node = std::make_shared<SearchTreeNode<T>>(value, std::move(left), std::move(right));
+    AvlBalance::update(*node);
+    return node;
+}
+
+template<typename T>
+typename PersistentBinarySearchTree<T>::MutableNodePtr PersistentBinarySearchTree<T>::balance(
+    const T& value, MutableNodePtr left, MutableNodePtr right) {
+    // The AVL rotations of AvlBalance, but building new nodes for the rotated
+    // ones, since the children may belong to older versions
+    int left_height = height(left);
+    int right_height = height(right);
+    if (left_height > right_height + 1) {
+        if (height(left->left) >= height(left->right)) {
+            return make_node(left->data, left->left, make_node(value, left->right, std::move(right)));
+        }
+        const MutableNodePtr& pivot = left->right;  // Left-right case
+        return make_node(pivot->data, make_node(left->data, left->left, pivot->left),
+                         make_node(value, pivot->right, std::move(right)));
+    }
+    if (right_height > left_height + 1) {
+        if (height(right->right) >= height(right->left)) {
+            return make_node(right->data, make_node(value, std::move(left), right->left), right->right);
+        }
+        const MutableNodePtr& pivot = right->left;  // Right-left case
+        return make_node(pivot->data, make_node(value, std::move(left), pivot->left),
+                         make_node(right->data, pivot->right, right->right));
+    }
+    return make_node(value, std::move(left), std::move(right));
+}
+
+template<typename T>
+typename PersistentBinarySearchTree<T>::MutableNodePtr PersistentBinarySearchTree<T>::build(
+    const std::vector<T>& values, size_t begin, size_t end) {
+    if (begin == end) return nullptr;
+    size_t mid = begin + (end - begin) / 2;
+    return make_node(values[mid], build(values, begin, mid), build(values, mid + 1, end));
+}
+
+template<typename T>
+typename PersistentBinarySearchTree<T>::MutableNodePtr PersistentBinarySearchTree<T>::insert_helper(
+    const MutableNodePtr& node, const T& value) {
+    if (!node) {
+        return make_node(value, nullptr, nullptr);
+    }
+
+    // Unchanged subtrees are returned as-is, so a duplicate copies nothing
+    if (value < node->data) {
+        MutableNodePtr left = insert_helper(node->left, value);
+        return left == node->left ? node : balance(node->data, std::move(left), node->right);
+    }
+    if (node->data < value) {
+        MutableNodePtr right = insert_helper(node->right, value);
+        return right == node->right ? node : balance(node->data, node->left, std::move(right));
+    }
+    return node;
+}
+
+template<typename T>
+typename PersistentBinarySearchTree<T>::MutableNodePtr PersistentBinarySearchTree<T>::remove_helper(
+    const MutableNodePtr& node, const T& value) {
+    if (!node) return nullptr;
+
+    if (value < node->data) {
+        MutableNodePtr left = remove_helper(node->left, value);
+        return left == node->left ? node : balance(node->data, std::move(left), node->right);
+    }
+    if (node->data < value) {
+        MutableNodePtr right = remove_helper(node->right, value);
+        return right == node->right ? node : balance(node->data, node->left, std::move(right));
+    }
+
+    // Node to be deleted found: splice in the inorder successor
+    if (!node->left) return node->right;
+    if (!node->right) return node->left;
+    T successor = node->data;
+    MutableNodePtr right = remove_min(node->right, successor);
+    return balance(successor, node->left, std::move(right));
+}
+
+template<typename T>
+typename PersistentBinarySearchTree<T>::MutableNodePtr PersistentBinarySearchTree<T>::remove_min(
+    const MutableNodePtr& node, T& min_value) {
+    if (!node->left) {
+        min_value = node->data;
+        return node->right;
+    }
+    return balance(node->data, remove_min(node->left, min_value), node->right);
+}
+
+// VersionedBinarySearchTree Implementation
+
+template<typename T>
+PersistentBinarySearchTree<T> VersionedBinarySearchTree<T>::snapshot() const {
+    return PersistentBinarySearchTree<T>(std::atomic_load(&root_));
+}
+
+template<typename T>
+bool VersionedBinarySearchTree<T>::insert(const T& value) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    PersistentBinarySearchTree<T> current = snapshot();
+    PersistentBinarySearchTree<T> next = current.insert(value);
+    if (next.root_ == current.root_) return false;
+    std::atomic_store(&root_, next.root_);
+    return true;
+}
+
+template<typename T>
+bool VersionedBinarySearchTree<T>::remove(const T& value) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    PersistentBinarySearchTree<T> current = snapshot();
+    PersistentBinarySearchTree<T> next = current.remove(value);
+    if (next.root_ == current.root_) return false;
+    std::atomic_store(&root_, next.root_);
+    return true;
+}
+
+template<typename T>
+void VersionedBinarySearchTree<T>::publish(const PersistentBinarySearchTree<T>& version) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    std::atomic_store(&root_, version.root_);
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_PERSISTENT_TREE_TPP
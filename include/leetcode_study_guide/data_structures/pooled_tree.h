@@ -0,0 +1,426 @@
+/**
+ * @file pooled_tree.h
+ * @brief Pool-allocated binary tree and BST with 32-bit child indices
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_POOLED_TREE_H
+#define LEETCODE_STUDY_GUIDE_POOLED_TREE_H
+
+#include "../common.h"
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Binary tree node addressed by index inside a PooledBinaryTree
+ */
+template<typename T>
+struct PooledTreeNode {
+    T data;
+    uint32_t left;   // Index of left child, or kNullNode
+    uint32_t right;  // Index of right child, or kNullNode
+
+    PooledTreeNode(const T& value, uint32_t left_child, uint32_t right_child)
+        : data(value), left(left_child), right(right_child) {}
+};
+
+/**
+ * @brief Binary tree whose nodes live in a block pool
+ *
+ * Same traversal API as BinaryTree, but children are 32-bit indices into
+ * blocks of 4096 nodes instead of shared_ptr links. A node costs its value
+ * plus 8 bytes (no control block, no per-node allocation, no reference
+ * count traffic while traversing), nodes allocated together are adjacent
+ * in memory, and freed slots are recycled through a free list. Every
+ * algorithm is iterative, so degenerate trees of any depth are safe, and
+ * clear() frees whole blocks. Node handles are NodeId values; kNullNode
+ * marks a missing child.
+ */
+template<typename T>
+class PooledBinaryTree {
+public:
+    using NodeId = uint32_t;
+    using Node = PooledTreeNode<T>;
+    static constexpr NodeId kNullNode = std::numeric_limits<NodeId>::max();
+
+    /**
+     * @brief Default constructor
+     */
+    PooledBinaryTree() : free_list_(kNullNode), next_slot_(0), root_(kNullNode), size_(0) {}
+
+    /**
+     * @brief Constructor with root value
+     * @param root_value Value for the root node
+     */
+    explicit PooledBinaryTree(const T& root_value);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~PooledBinaryTree() = default;
+
+    // Tree Construction and Modification
+
+    /**
+     * @brief Set the root of the tree (discards existing nodes)
+     * @param value Value for the root node
+     */
+    void set_root(const T& value);
+
+    /**
+     * @brief Insert node as left child of given node
+     * @param parent Parent node
+     * @param value Value for new node
+     * @return Id of newly created node
+     * @throws std::invalid_argument if parent is kNullNode
+     */
+    NodeId insert_left(NodeId parent, const T& value);
+
+    /**
+     * @brief Insert node as right child of given node
+     * @param parent Parent node
+     * @param value Value for new node
+     * @return Id of newly created node
+     * @throws std::invalid_argument if parent is kNullNode
+     */
+    NodeId insert_right(NodeId parent, const T& value);
+
+    /**
+     * @brief Build tree from level-order array (LeetCode format)
+     * @param values Vector of values in level-order
+     * @param null_value Value representing null nodes
+     */
+    void build_from_array(const std::vector<T>& values, const T& null_value);
+
+    // Tree Traversal Algorithms
+
+    /**
+     * @brief Inorder traversal (Left, Root, Right)
+     * @return Vector of values in inorder sequence
+     * Time Complexity: O(n)
+     * Space Complexity: O(h) where h is height
+     */
+    std::vector<T> inorder_traversal() const;
+
+    /**
+     * @brief Preorder traversal (Root, Left, Right)
+     * @return Vector of values in preorder sequence
+     * Time Complexity: O(n)
+     * Space Complexity: O(h) where h is height
+     */
+    std::vector<T> preorder_traversal() const;
+
+    /**
+     * @brief Postorder traversal (Left, Right, Root)
+     * @return Vector of values in postorder sequence
+     * Time Complexity: O(n)
+     * Space Complexity: O(h) where h is height
+     */
+    std::vector<T> postorder_traversal() const;
+
+    /**
+     * @brief Level-order traversal (BFS)
+     * @return Vector of values in level-order sequence
+     * Time Complexity: O(n)
+     * Space Complexity: O(w) where w is maximum width
+     */
+    std::vector<T> level_order_traversal() const;
+
+    /**
+     * @brief Iterative inorder traversal (same as inorder_traversal)
+     */
+    std::vector<T> inorder_iterative() const { return inorder_traversal(); }
+
+    /**
+     * @brief Iterative preorder traversal (same as preorder_traversal)
+     */
+    std::vector<T> preorder_iterative() const { return preorder_traversal(); }
+
+    /**
+     * @brief Iterative postorder traversal (same as postorder_traversal)
+     */
+    std::vector<T> postorder_iterative() const { return postorder_traversal(); }
+
+    // Tree Properties and Analysis
+
+    /**
+     * @brief Calculate height of the tree
+     * @return Height of the tree (0 for empty tree)
+     * Time Complexity: O(n)
+     * Space Complexity: O(w)
+     */
+    int height() const;
+
+    /**
+     * @brief Calculate maximum depth of the tree
+     * @return Maximum depth (same as height)
+     */
+    int max_depth() const { return height(); }
+
+    /**
+     * @brief Calculate minimum depth of the tree
+     * @return Minimum depth to a leaf node
+     * Time Complexity: O(n)
+     * Space Complexity: O(w)
+     */
+    int min_depth() const;
+
+    /**
+     * @brief Check if tree is balanced
+     * @return True if tree is height-balanced
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    bool is_balanced() const;
+
+    /**
+     * @brief Check if tree is symmetric
+     * @return True if tree is symmetric around its center
+     * Time Complexity: O(n)
+     * Space Complexity: O(w)
+     */
+    bool is_symmetric() const;
+
+    /**
+     * @brief Count total number of nodes
+     * @return Number of nodes reachable from the root
+     * Time Complexity: O(n)
+     * Space Complexity: O(h)
+     */
+    size_t count_nodes() const;
+
+    // Tree Search and Path Operations
+
+    /**
+     * @brief Find node with given value (preorder)
+     * @param value Value to search for
+     * @return Id of the node if found, kNullNode otherwise
+     * Time Complexity: O(n)
+     * Space Complexity: O(h)
+     */
+    NodeId find(const T& value) const;
+
+    /**
+     * @brief Find path from root to target value
+     * @param target Target value
+     * @return Vector representing path from root to target
+     * Time Complexity: O(n)
+     * Space Complexity: O(h)
+     */
+    std::vector<T> find_path(const T& target) const;
+
+    /**
+     * @brief Find lowest common ancestor of two values
+     * @param val1 First value
+     * @param val2 Second value
+     * @return Id of the LCA node, kNullNode if neither value is found
+     * Time Complexity: O(n)
+     * Space Complexity: O(h)
+     */
+    NodeId lowest_common_ancestor(const T& val1, const T& val2) const;
+
+    // Utility Methods
+
+    /**
+     * @brief Get root node
+     * @return Id of the root, kNullNode when empty
+     */
+    NodeId get_root() const { return root_; }
+
+    /**
+     * @brief Access a node
+     * @param id Node id
+     * @return Node with data and child ids
+     */
+    const Node& node(NodeId id) const { return blocks_[id >> kBlockShift][id & kBlockMask]; }
+
+    /**
+     * @brief Check if tree is empty
+     * @return True if tree is empty
+     */
+    bool empty() const { return root_ == kNullNode; }
+
+    /**
+     * @brief Get size of tree
+     * @return Number of nodes in tree
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Get bytes reserved for nodes
+     * @return Block storage in bytes
+     */
+    size_t memory_usage() const { return blocks_.size() * kBlockSize * sizeof(Node); }
+
+    /**
+     * @brief Clear the tree (frees whole blocks)
+     */
+    void clear();
+
+    /**
+     * @brief Print tree structure (for debugging)
+     */
+    void print_tree() const;
+
+protected:
+    static constexpr unsigned kBlockShift = 12;
+    static constexpr size_t kBlockSize = size_t(1) << kBlockShift;
+    static constexpr NodeId kBlockMask = static_cast<NodeId>(kBlockSize - 1);
+
+    std::vector<std::vector<Node>> blocks_;  // Each block reserved to kBlockSize up front
+    NodeId free_list_;  // Recycled slots, chained through their left index
+    NodeId next_slot_;  // First never-used slot
+    NodeId root_;
+    size_t size_;
+
+    Node& at(NodeId id) { return blocks_[id >> kBlockShift][id & kBlockMask]; }
+    NodeId allocate(const T& value);
+    void release(NodeId id);
+};
+
+/**
+ * @brief Binary search tree on top of PooledBinaryTree
+ *
+ * Same BST API as BinarySearchTree; every operation is iterative and
+ * works directly on node indices.
+ */
+template<typename T>
+class PooledBinarySearchTree : public PooledBinaryTree<T> {
+public:
+    using typename PooledBinaryTree<T>::NodeId;
+    using PooledBinaryTree<T>::kNullNode;
+
+    /**
+     * @brief Default constructor
+     */
+    PooledBinarySearchTree() : PooledBinaryTree<T>() {}
+
+    /**
+     * @brief Constructor with root value
+     * @param root_value Value for the root node
+     */
+    explicit PooledBinarySearchTree(const T& root_value) : PooledBinaryTree<T>(root_value) {}
+
+    /**
+     * @brief Constructor from sorted array (builds a balanced tree)
+     * @param sorted_array Sorted array to build BST from
+     */
+    explicit PooledBinarySearchTree(const std::vector<T>& sorted_array);
+
+    // BST Operations
+
+    /**
+     * @brief Insert value into BST
+     * @param value Value to insert
+     * @return True if inserted, false if already exists
+     * Time Complexity: O(h) where h is height
+     * Space Complexity: O(1)
+     */
+    bool insert(const T& value);
+
+    /**
+     * @brief Search for value in BST
+     * @param value Value to search for
+     * @return True if found, false otherwise
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    bool search(const T& value) const;
+
+    /**
+     * @brief Delete value from BST
+     * @param value Value to delete
+     * @return True if deleted, false if not found
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    bool remove(const T& value);
+
+    /**
+     * @brief Find minimum value in BST
+     * @return Minimum value
+     * @throws std::runtime_error if tree is empty
+     */
+    T find_min() const;
+
+    /**
+     * @brief Find maximum value in BST
+     * @return Maximum value
+     * @throws std::runtime_error if tree is empty
+     */
+    T find_max() const;
+
+    /**
+     * @brief Find inorder successor of given value
+     * @param value Value to find successor for (must be in the tree)
+     * @return Successor value
+     * @throws std::runtime_error if no successor exists
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    T find_successor(const T& value) const;
+
+    /**
+     * @brief Find inorder predecessor of given value
+     * @param value Value to find predecessor for (must be in the tree)
+     * @return Predecessor value
+     * @throws std::runtime_error if no predecessor exists
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    T find_predecessor(const T& value) const;
+
+    /**
+     * @brief Validate if tree maintains BST property
+     * @return True if valid BST, false otherwise
+     * Time Complexity: O(n)
+     * Space Complexity: O(h)
+     */
+    bool is_valid_bst() const;
+
+    /**
+     * @brief Get sorted array from BST (inorder traversal)
+     * @return Sorted vector of all values
+     */
+    std::vector<T> to_sorted_array() const { return this->inorder_traversal(); }
+
+    /**
+     * @brief Find kth smallest element (1-indexed)
+     * @param k Position (1-indexed)
+     * @return kth smallest element
+     * @throws std::out_of_range if k is invalid
+     * Time Complexity: O(h + k)
+     * Space Complexity: O(h)
+     */
+    T kth_smallest(int k) const;
+
+    /**
+     * @brief Find kth largest element (1-indexed)
+     * @param k Position (1-indexed)
+     * @return kth largest element
+     * @throws std::out_of_range if k is invalid
+     * Time Complexity: O(h + k)
+     * Space Complexity: O(h)
+     */
+    T kth_largest(int k) const;
+
+private:
+    using PooledBinaryTree<T>::root_;
+    using PooledBinaryTree<T>::size_;
+
+    NodeId build_balanced(const std::vector<T>& sorted_array);
+    T kth_in_order(int k, bool ascending) const;
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "pooled_tree.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_POOLED_TREE_H
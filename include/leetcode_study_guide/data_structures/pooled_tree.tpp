@@ -0,0 +1,709 @@
+/**
+ * @file pooled_tree.tpp
+ * @brief Template implementation for PooledBinaryTree and PooledBinarySearchTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_POOLED_TREE_TPP
+#define LEETCODE_STUDY_GUIDE_POOLED_TREE_TPP
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// PooledBinaryTree Implementation
+
+template<typename T>
+PooledBinaryTree<T>::PooledBinaryTree(const T& root_value) : PooledBinaryTree() {
+    root_ = allocate(root_value);
+}
+
+template<typename T>
+void PooledBinaryTree<T>::set_root(const T& value) {
+    clear();
+    root_ = allocate(value);
+}
+
+template<typename T>
+typename PooledBinaryTree<T>::NodeId PooledBinaryTree<T>::insert_left(NodeId parent, const T& value) {
+    if (parent == kNullNode) {
+        throw std::invalid_argument("Parent node cannot be null");
+    }
+
+    NodeId new_node = allocate(value);
+    NodeId replaced = at(parent).left;
+    at(parent).left = new_node;
+    release(replaced);
+    return new_node;
+}
+
+template<typename T>
+typename PooledBinaryTree<T>::NodeId PooledBinaryTree<T>::insert_right(NodeId parent, const T& value) {
+    if (parent == kNullNode) {
+        throw std::invalid_argument("Parent node cannot be null");
+    }
+
+    NodeId new_node = allocate(value);
+    NodeId replaced = at(parent).right;
+    at(parent).right = new_node;
+    release(replaced);
+    return new_node;
+}
+
+template<typename T>
+void PooledBinaryTree<T>::build_from_array(const std::vector<T>& values, const T& null_value) {
+    clear();
+    if (values.empty()) {
+        return;
+    }
+
+    root_ = allocate(values[0]);
+
+    std::queue<NodeId> queue;
+    queue.push(root_);
+
+    for (size_t i = 1; i < values.size() && !queue.empty(); i += 2) {
+        NodeId current = queue.front();
+        queue.pop();
+
+        // Left child
+        if (values[i] != null_value) {
+            NodeId child = allocate(values[i]);
+            at(current).left = child;
+            queue.push(child);
+        }
+
+        // Right child
+        if (i + 1 < values.size() && values[i + 1] != null_value) {
+            NodeId child = allocate(values[i + 1]);
+            at(current).right = child;
+            queue.push(child);
+        }
+    }
+}
+
+template<typename T>
+std::vector<T> PooledBinaryTree<T>::inorder_traversal() const {
+    std::vector<T> result;
+    result.reserve(size_);
+    std::vector<NodeId> stack;
+    NodeId current = root_;
+
+    while (current != kNullNode || !stack.empty()) {
+        while (current != kNullNode) {
+            stack.push_back(current);
+            current = node(current).left;
+        }
+        current = stack.back();
+        stack.pop_back();
+        result.push_back(node(current).data);
+        current = node(current).right;
+    }
+
+    return result;
+}
+
+template<typename T>
+std::vector<T> PooledBinaryTree<T>::preorder_traversal() const {
+    std::vector<T> result;
+    if (root_ == kNullNode) return result;
+    result.reserve(size_);
+
+    std::vector<NodeId> stack{root_};
+    while (!stack.empty()) {
+        const Node& current = node(stack.back());
+        stack.pop_back();
+        result.push_back(current.data);
+        if (current.right != kNullNode) stack.push_back(current.right);
+        if (current.left != kNullNode) stack.push_back(current.left);
+    }
+
+    return result;
+}
+
+template<typename T>
+std::vector<T> PooledBinaryTree<T>::postorder_traversal() const {
+    std::vector<T> result;
+    if (root_ == kNullNode) return result;
+    result.reserve(size_);
+
+    // Root, Right, Left order reversed
+    std::vector<NodeId> stack{root_};
+    while (!stack.empty()) {
+        const Node& current = node(stack.back());
+        stack.pop_back();
+        result.push_back(current.data);
+        if (current.left != kNullNode) stack.push_back(current.left);
+        if (current.right != kNullNode) stack.push_back(current.right);
+    }
+
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+template<typename T>
+std::vector<T> PooledBinaryTree<T>::level_order_traversal() const {
+    std::vector<T> result;
+    if (root_ == kNullNode) return result;
+    result.reserve(size_);
+
+    std::queue<NodeId> queue;
+    queue.push(root_);
+    while (!queue.empty()) {
+        const Node& current = node(queue.front());
+        queue.pop();
+        result.push_back(current.data);
+        if (current.left != kNullNode) queue.push(current.left);
+        if (current.right != kNullNode) queue.push(current.right);
+    }
+
+    return result;
+}
+
+template<typename T>
+int PooledBinaryTree<T>::height() const {
+    if (root_ == kNullNode) return 0;
+
+    int levels = 0;
+    std::queue<NodeId> queue;
+    queue.push(root_);
+    while (!queue.empty()) {
+        ++levels;
+        for (size_t count = queue.size(); count > 0; --count) {
+            const Node& current = node(queue.front());
+            queue.pop();
+            if (current.left != kNullNode) queue.push(current.left);
+            if (current.right != kNullNode) queue.push(current.right);
+        }
+    }
+
+    return levels;
+}
+
+template<typename T>
+int PooledBinaryTree<T>::min_depth() const {
+    if (root_ == kNullNode) return 0;
+
+    int depth = 0;
+    std::queue<NodeId> queue;
+    queue.push(root_);
+    while (!queue.empty()) {
+        ++depth;
+        for (size_t count = queue.size(); count > 0; --count) {
+            const Node& current = node(queue.front());
+            queue.pop();
+            if (current.left == kNullNode && current.right == kNullNode) return depth;
+            if (current.left != kNullNode) queue.push(current.left);
+            if (current.right != kNullNode) queue.push(current.right);
+        }
+    }
+
+    return depth;
+}
+
+template<typename T>
+bool PooledBinaryTree<T>::is_balanced() const {
+    if (root_ == kNullNode) return true;
+
+    // Reverse of (root, left, right) preorder lists children before parents
+    std::vector<NodeId> order;
+    order.reserve(size_);
+    std::vector<NodeId> stack{root_};
+    while (!stack.empty()) {
+        NodeId id = stack.back();
+        stack.pop_back();
+        order.push_back(id);
+        if (node(id).left != kNullNode) stack.push_back(node(id).left);
+        if (node(id).right != kNullNode) stack.push_back(node(id).right);
+    }
+
+    std::vector<int> heights(next_slot_, 0);  // Indexed by node id
+    auto height_of = [&heights](NodeId id) { return id == kNullNode ? 0 : heights[id]; };
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        int left_height = height_of(node(*it).left);
+        int right_height = height_of(node(*it).right);
+        if (std::abs(left_height - right_height) > 1) return false;
+        heights[*it] = 1 + std::max(left_height, right_height);
+    }
+
+    return true;
+}
+
+template<typename T>
+bool PooledBinaryTree<T>::is_symmetric() const {
+    if (root_ == kNullNode) return true;
+
+    std::vector<std::pair<NodeId, NodeId>> stack{{node(root_).left, node(root_).right}};
+    while (!stack.empty()) {
+        NodeId left, right;
+        std::tie(left, right) = stack.back();
+        stack.pop_back();
+        if (left == kNullNode && right == kNullNode) continue;
+        if (left == kNullNode || right == kNullNode) return false;
+        if (!(node(left).data == node(right).data)) return false;
+        stack.emplace_back(node(left).left, node(right).right);
+        stack.emplace_back(node(left).right, node(right).left);
+    }
+
+    return true;
+}
+
+template<typename T>
+size_t PooledBinaryTree<T>::count_nodes() const {
+    if (root_ == kNullNode) return 0;
+
+    size_t count = 0;
+    std::vector<NodeId> stack{root_};
+    while (!stack.empty()) {
+        const Node& current = node(stack.back());
+        stack.pop_back();
+        ++count;
+        if (current.left != kNullNode) stack.push_back(current.left);
+        if (current.right != kNullNode) stack.push_back(current.right);
+    }
+
+    return count;
+}
+
+template<typename T>
+typename PooledBinaryTree<T>::NodeId PooledBinaryTree<T>::find(const T& value) const {
+    if (root_ == kNullNode) return kNullNode;
+
+    std::vector<NodeId> stack{root_};
+    while (!stack.empty()) {
+        NodeId id = stack.back();
+        stack.pop_back();
+        const Node& current = node(id);
+        if (current.data == value) return id;
+        if (current.right != kNullNode) stack.push_back(current.right);
+        if (current.left != kNullNode) stack.push_back(current.left);
+    }
+
+    return kNullNode;
+}
+
+template<typename T>
+std::vector<T> PooledBinaryTree<T>::find_path(const T& target) const {
+    std::vector<T> path;
+    if (root_ == kNullNode) return path;
+
+    // Preorder with depth: path[0, depth) always holds the ancestors
+    std::vector<std::pair<NodeId, size_t>> stack{{root_, 0}};
+    while (!stack.empty()) {
+        NodeId id;
+        size_t depth;
+        std::tie(id, depth) = stack.back();
+        stack.pop_back();
+
+        const Node& current = node(id);
+        path.resize(depth);
+        path.push_back(current.data);
+        if (current.data == target) return path;
+
+        if (current.right != kNullNode) stack.emplace_back(current.right, depth + 1);
+        if (current.left != kNullNode) stack.emplace_back(current.left, depth + 1);
+    }
+
+    path.clear();
+    return path;
+}
+
+template<typename T>
+typename PooledBinaryTree<T>::NodeId PooledBinaryTree<T>::lowest_common_ancestor(const T& val1, const T& val2) const {
+    // Iterative form of the recursive LCA: a matching node answers for its
+    // whole subtree, otherwise the answer combines both children's answers
+    struct Frame {
+        NodeId id;
+        int stage;
+        NodeId left_result;
+    };
+
+    NodeId result = kNullNode;
+    if (root_ == kNullNode) return result;
+
+    std::vector<Frame> stack{{root_, 0, kNullNode}};
+    while (!stack.empty()) {
+        Frame& frame = stack.back();
+        const Node& current = node(frame.id);
+
+        if (frame.stage == 0) {
+            if (current.data == val1 || current.data == val2) {
+                result = frame.id;
+                stack.pop_back();
+                continue;
+            }
+            frame.stage = 1;
+            if (current.left != kNullNode) {
+                stack.push_back({current.left, 0, kNullNode});
+                continue;
+            }
+            result = kNullNode;
+        }
+
+        if (frame.stage == 1) {
+            frame.left_result = result;
+            frame.stage = 2;
+            if (current.right != kNullNode) {
+                stack.push_back({current.right, 0, kNullNode});
+                continue;
+            }
+            result = kNullNode;
+        }
+
+        NodeId left_result = frame.left_result;
+        NodeId right_result = result;
+        NodeId id = frame.id;
+        stack.pop_back();
+
+        if (left_result != kNullNode && right_result != kNullNode) {
+            result = id;
+        } else {
+            result = left_result != kNullNode ? left_result : right_result;
+        }
+    }
+
+    return result;
+}
+
+template<typename T>
+void PooledBinaryTree<T>::clear() {
+    blocks_.clear();
+    free_list_ = kNullNode;
+    next_slot_ = 0;
+    root_ = kNullNode;
+    size_ = 0;
+}
+
+template<typename T>
+void PooledBinaryTree<T>::print_tree() const {
+    if (root_ == kNullNode) {
+        std::cout << "Empty tree\n";
+        return;
+    }
+
+    std::vector<std::tuple<NodeId, std::string, bool>> stack;
+    stack.emplace_back(root_, "", true);
+    while (!stack.empty()) {
+        NodeId id;
+        std::string prefix;
+        bool is_last;
+        std::tie(id, prefix, is_last) = std::move(stack.back());
+        stack.pop_back();
+
+        const Node& current = node(id);
+        std::cout << prefix << (is_last ? "└── " : "├── ") << current.data << std::endl;
+
+        std::string child_prefix = prefix + (is_last ? "    " : "│   ");
+        if (current.right != kNullNode) {
+            stack.emplace_back(current.right, child_prefix, true);
+        }
+        if (current.left != kNullNode) {
+            stack.emplace_back(current.left, child_prefix, current.right == kNullNode);
+        }
+    }
+}
+
+// Pool management
+
+template<typename T>
+typename PooledBinaryTree<T>::NodeId PooledBinaryTree<T>::allocate(const T& value) {
+    NodeId id;
+    if (free_list_ != kNullNode) {
+        id = free_list_;
+        Node& slot = at(id);
+        free_list_ = slot.left;
+        slot.data = value;
+        slot.left = kNullNode;
+        slot.right = kNullNode;
+    } else {
+        if (next_slot_ == kNullNode) {
+            throw std::length_error("Tree node limit reached");
+        }
+        if ((next_slot_ & kBlockMask) == 0) {
+            blocks_.emplace_back();
+            blocks_.back().reserve(kBlockSize);
+        }
+        blocks_.back().emplace_back(value, kNullNode, kNullNode);
+        id = next_slot_++;
+    }
+
+    ++size_;
+    return id;
+}
+
+template<typename T>
+void PooledBinaryTree<T>::release(NodeId id) {
+    if (id == kNullNode) return;
+
+    // Free the whole subtree; the free list reuses the left index
+    std::vector<NodeId> stack{id};
+    while (!stack.empty()) {
+        NodeId current = stack.back();
+        stack.pop_back();
+        Node& slot = at(current);
+        if (slot.left != kNullNode) stack.push_back(slot.left);
+        if (slot.right != kNullNode) stack.push_back(slot.right);
+        slot.left = free_list_;
+        slot.right = kNullNode;
+        free_list_ = current;
+        --size_;
+    }
+}
+
+// PooledBinarySearchTree Implementation
+
+template<typename T>
+PooledBinarySearchTree<T>::PooledBinarySearchTree(const std::vector<T>& sorted_array) : PooledBinaryTree<T>() {
+    if (!sorted_array.empty()) {
+        root_ = build_balanced(sorted_array);
+    }
+}
+
+template<typename T>
+bool PooledBinarySearchTree<T>::insert(const T& value) {
+    if (root_ == kNullNode) {
+        root_ = this->allocate(value);
+        return true;
+    }
+
+    NodeId parent = root_;
+    while (true) {
+        const auto& current = this->node(parent);
+        bool go_left = value < current.data;
+        if (!go_left && !(current.data < value)) return false;  // No duplicates
+
+        NodeId next = go_left ? current.left : current.right;
+        if (next == kNullNode) {
+            NodeId child = this->allocate(value);
+            (go_left ? this->at(parent).left : this->at(parent).right) = child;
+            return true;
+        }
+        parent = next;
+    }
+}
+
+template<typename T>
+bool PooledBinarySearchTree<T>::search(const T& value) const {
+    NodeId current = root_;
+    while (current != kNullNode) {
+        const auto& n = this->node(current);
+        if (value < n.data) current = n.left;
+        else if (n.data < value) current = n.right;
+        else return true;
+    }
+    return false;
+}
+
+template<typename T>
+bool PooledBinarySearchTree<T>::remove(const T& value) {
+    NodeId parent = kNullNode;
+    NodeId target = root_;
+    while (target != kNullNode) {
+        const auto& n = this->node(target);
+        if (value < n.data) {
+            parent = target;
+            target = n.left;
+        } else if (n.data < value) {
+            parent = target;
+            target = n.right;
+        } else {
+            break;
+        }
+    }
+    if (target == kNullNode) return false;
+
+    if (this->node(target).left != kNullNode && this->node(target).right != kNullNode) {
+        // Two children: take the inorder successor's value and unlink the successor
+        NodeId successor_parent = target;
+        NodeId successor = this->node(target).right;
+        while (this->node(successor).left != kNullNode) {
+            successor_parent = successor;
+            successor = this->node(successor).left;
+        }
+        this->at(target).data = this->node(successor).data;
+        parent = successor_parent;
+        target = successor;
+    }
+
+    // Target has at most one child now
+    auto& removed = this->at(target);
+    NodeId child = removed.left != kNullNode ? removed.left : removed.right;
+    if (parent == kNullNode) {
+        root_ = child;
+    } else if (this->node(parent).left == target) {
+        this->at(parent).left = child;
+    } else {
+        this->at(parent).right = child;
+    }
+
+    removed.left = kNullNode;
+    removed.right = kNullNode;
+    this->release(target);
+    return true;
+}
+
+template<typename T>
+T PooledBinarySearchTree<T>::find_min() const {
+    if (root_ == kNullNode) {
+        throw std::runtime_error("Tree is empty");
+    }
+    NodeId current = root_;
+    while (this->node(current).left != kNullNode) current = this->node(current).left;
+    return this->node(current).data;
+}
+
+template<typename T>
+T PooledBinarySearchTree<T>::find_max() const {
+    if (root_ == kNullNode) {
+        throw std::runtime_error("Tree is empty");
+    }
+    NodeId current = root_;
+    while (this->node(current).right != kNullNode) current = this->node(current).right;
+    return this->node(current).data;
+}
+
+template<typename T>
+T PooledBinarySearchTree<T>::find_successor(const T& value) const {
+    NodeId successor = kNullNode;
+    NodeId current = root_;
+    while (current != kNullNode) {
+        const auto& n = this->node(current);
+        if (value < n.data) {
+            successor = current;
+            current = n.left;
+        } else if (n.data < value) {
+            current = n.right;
+        } else {
+            // Found: the successor is the leftmost node of the right subtree, if any
+            for (NodeId next = n.right; next != kNullNode; next = this->node(next).left) {
+                successor = next;
+            }
+            if (successor == kNullNode) break;
+            return this->node(successor).data;
+        }
+    }
+    throw std::runtime_error("No successor found");
+}
+
+template<typename T>
+T PooledBinarySearchTree<T>::find_predecessor(const T& value) const {
+    NodeId predecessor = kNullNode;
+    NodeId current = root_;
+    while (current != kNullNode) {
+        const auto& n = this->node(current);
+        if (value < n.data) {
+            current = n.left;
+        } else if (n.data < value) {
+            predecessor = current;
+            current = n.right;
+        } else {
+            // Found: the predecessor is the rightmost node of the left subtree, if any
+            for (NodeId next = n.left; next != kNullNode; next = this->node(next).right) {
+                predecessor = next;
+            }
+            if (predecessor == kNullNode) break;
+            return this->node(predecessor).data;
+        }
+    }
+    throw std::runtime_error("No predecessor found");
+}
+
+template<typename T>
+bool PooledBinarySearchTree<T>::is_valid_bst() const {
+    // Inorder walk must be strictly increasing
+    std::vector<NodeId> stack;
+    NodeId current = root_;
+    NodeId previous = kNullNode;
+
+    while (current != kNullNode || !stack.empty()) {
+        while (current != kNullNode) {
+            stack.push_back(current);
+            current = this->node(current).left;
+        }
+        current = stack.back();
+        stack.pop_back();
+        if (previous != kNullNode && !(this->node(previous).data < this->node(current).data)) {
+            return false;
+        }
+        previous = current;
+        current = this->node(current).right;
+    }
+
+    return true;
+}
+
+template<typename T>
+T PooledBinarySearchTree<T>::kth_smallest(int k) const {
+    return kth_in_order(k, true);
+}
+
+template<typename T>
+T PooledBinarySearchTree<T>::kth_largest(int k) const {
+    return kth_in_order(k, false);
+}
+
+template<typename T>
+typename PooledBinarySearchTree<T>::NodeId PooledBinarySearchTree<T>::build_balanced(const std::vector<T>& sorted_array) {
+    // Allocate in preorder so each subtree occupies a contiguous id range
+    struct Range {
+        size_t start;
+        size_t end;  // Inclusive
+        NodeId parent;
+        bool is_left;
+    };
+
+    NodeId root = kNullNode;
+    std::vector<Range> stack{{0, sorted_array.size() - 1, kNullNode, false}};
+    while (!stack.empty()) {
+        Range range = stack.back();
+        stack.pop_back();
+
+        size_t mid = range.start + (range.end - range.start) / 2;
+        NodeId id = this->allocate(sorted_array[mid]);
+        if (range.parent == kNullNode) {
+            root = id;
+        } else if (range.is_left) {
+            this->at(range.parent).left = id;
+        } else {
+            this->at(range.parent).right = id;
+        }
+
+        if (mid < range.end) stack.push_back({mid + 1, range.end, id, false});
+        if (mid > range.start) stack.push_back({range.start, mid - 1, id, true});
+    }
+
+    return root;
+}
+
+template<typename T>
+T PooledBinarySearchTree<T>::kth_in_order(int k, bool ascending) const {
+    if (k <= 0 || k > static_cast<int>(size_)) {
+        throw std::out_of_range("k is out of range");
+    }
+
+    std::vector<NodeId> stack;
+    NodeId current = root_;
+    while (true) {
+        while (current != kNullNode) {
+            stack.push_back(current);
+            current = ascending ? this->node(current).left : this->node(current).right;
+        }
+        current = stack.back();
+        stack.pop_back();
+        if (--k == 0) return this->node(current).data;
+        current = ascending ? this->node(current).right : this->node(current).left;
+    }
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_POOLED_TREE_TPP
@@ -0,0 +1,326 @@
+/**
+ * @file range_query.h
+ * @brief Fenwick tree and lazy segment tree for dynamic range aggregates
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_RANGE_QUERY_H
+#define LEETCODE_STUDY_GUIDE_RANGE_QUERY_H
+
+#include "../common.h"
+#include "array.h"
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Fenwick (binary indexed) tree over a sequence of sums
+ *
+ * Slot i (1-based) stores the sum of the lowbit(i) values ending at i, so
+ * prefix sums and point updates both touch O(log n) slots of one flat
+ * array. T must form a group under + and - (integers, floating point).
+ */
+template<typename T>
+class FenwickTree {
+public:
+    /**
+     * @brief Create a tree of n zeros
+     * @param n Number of elements
+     */
+    explicit FenwickTree(size_t n = 0) : tree_(n + 1, T()) {}
+
+    /**
+     * @brief Build from existing values
+     * @param values Initial values
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    explicit FenwickTree(const std::vector<T>& values);
+
+    /**
+     * @brief Build from an Array
+     * @param values Initial values
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    explicit FenwickTree(const Array<T>& values) : FenwickTree(values.to_vector()) {}
+
+    /**
+     * @brief Add delta to one element
+     * @param index Element index
+     * @param delta Amount to add
+     * @throws std::out_of_range if index is invalid
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    void add(size_t index, const T& delta);
+
+    /**
+     * @brief Overwrite one element
+     * @param index Element index
+     * @param value New value
+     * @throws std::out_of_range if index is invalid
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    void set(size_t index, const T& value);
+
+    /**
+     * @brief Get one element
+     * @param index Element index
+     * @return Current value
+     * @throws std::out_of_range if index is invalid
+     * Time Complexity: O(log n)
+     */
+    T get(size_t index) const { return range_sum(index, index); }
+
+    /**
+     * @brief Sum of the first count elements
+     * @param count Number of leading elements (0..size())
+     * @return Sum of elements [0, count)
+     * @throws std::out_of_range if count exceeds size()
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T prefix_sum(size_t count) const;
+
+    /**
+     * @brief Sum of an inclusive index range
+     * @param left First index
+     * @param right Last index
+     * @return Sum of elements [left, right]
+     * @throws std::out_of_range if the range is invalid
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T range_sum(size_t left, size_t right) const;
+
+    /**
+     * @brief Find the shortest prefix reaching a target sum
+     * @param target Target sum
+     * @return Smallest index i with sum of [0, i] >= target, or size() if none
+     * Requires all elements to be non-negative.
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    size_t lower_bound(const T& target) const;
+
+    /**
+     * @brief Get number of elements
+     * @return Element count
+     */
+    size_t size() const { return tree_.size() - 1; }
+
+    /**
+     * @brief Check if the tree is empty
+     * @return True if there are no elements
+     */
+    bool empty() const { return size() == 0; }
+
+private:
+    std::vector<T> tree_;  // 1-based; tree_[0] is unused
+};
+
+/**
+ * @brief Monoid policies for SegmentTree
+ *
+ * A monoid supplies the aggregate of an empty range (identity) and an
+ * associative combine. repeat(value, count) is the aggregate of count
+ * copies of value; update policies use it to apply a tag to a whole node.
+ */
+template<typename T>
+struct SumMonoid {
+    using value_type = T;
+    static T identity() { return T(); }
+    static T combine(const T& a, const T& b) { return a + b; }
+    static T repeat(const T& value, size_t count) { return value * static_cast<T>(count); }
+};
+
+/**
+ * @brief Minimum monoid (identity is the largest representable value)
+ */
+template<typename T>
+struct MinMonoid {
+    using value_type = T;
+    static T identity() { return std::numeric_limits<T>::max(); }
+    static T combine(const T& a, const T& b) { return std::min(a, b); }
+    static T repeat(const T& value, size_t) { return value; }
+};
+
+/**
+ * @brief Maximum monoid (identity is the lowest representable value)
+ */
+template<typename T>
+struct MaxMonoid {
+    using value_type = T;
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+    static T combine(const T& a, const T& b) { return std::max(a, b); }
+    static T repeat(const T& value, size_t) { return value; }
+};
+
+/**
+ * @brief Update policies for SegmentTree range updates
+ *
+ * An update policy defines the pending tag stored at internal nodes:
+ * identity() is "no update", compose(newer, older) merges two pending
+ * tags, and apply<Monoid>(tag, aggregate, length) updates the aggregate
+ * of a node covering length elements.
+ */
+template<typename T>
+struct AddUpdate {
+    using tag_type = T;
+    static T identity() { return T(); }
+    static T compose(const T& newer, const T& older) { return newer + older; }
+
+    template<typename Monoid>
+    static T apply(const T& tag, const T& aggregate, size_t length) {
+        return aggregate + Monoid::repeat(tag, length);
+    }
+};
+
+/**
+ * @brief Range assignment: every element in the range becomes the tag value
+ */
+template<typename T>
+struct AssignUpdate {
+    using tag_type = std::optional<T>;
+    static tag_type identity() { return std::nullopt; }
+    static tag_type compose(const tag_type& newer, const tag_type& older) { return newer ? newer : older; }
+
+    template<typename Monoid>
+    static T apply(const tag_type& tag, const T& aggregate, size_t length) {
+        return tag ? Monoid::repeat(*tag, length) : aggregate;
+    }
+};
+
+/**
+ * @brief Iterative segment tree with lazy range updates
+ *
+ * The tree is stored bottom-up in one array of 2 * capacity aggregates
+ * (capacity is n rounded up to a power of two), leaves at capacity..2 *
+ * capacity - 1, so node k has children 2k and 2k + 1 and no pointers are
+ * followed. Updates walk the two range boundaries upwards and only push
+ * pending tags along those two root paths; queries fold the same tags into
+ * their partial results instead, so they never write and concurrent
+ * queries are safe. Padding leaves hold the monoid identity and are never
+ * covered by an update.
+ *
+ * @tparam Monoid Aggregate (SumMonoid by default, MinMonoid, MaxMonoid or custom)
+ * @tparam Update Range update (AddUpdate by default, AssignUpdate or custom)
+ */
+template<typename T, typename Monoid = SumMonoid<T>, typename Update = AddUpdate<T>>
+class SegmentTree {
+public:
+    using Tag = typename Update::tag_type;
+
+    /**
+     * @brief Create a tree of n copies of one value
+     * @param n Number of elements
+     * @param value Initial value of every element (zero by default)
+     *
+     * Elements start as real values, not the monoid identity: an identity
+     * such as MinMonoid's numeric max would overflow on the first AddUpdate.
+     */
+    explicit SegmentTree(size_t n = 0, const T& value = T()) : SegmentTree(std::vector<T>(n, value)) {}
+
+    /**
+     * @brief Build from existing values
+     * @param values Initial values
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    explicit SegmentTree(const std::vector<T>& values);
+
+    /**
+     * @brief Build from an Array
+     * @param values Initial values
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    explicit SegmentTree(const Array<T>& values) : SegmentTree(values.to_vector()) {}
+
+    /**
+     * @brief Aggregate of an inclusive index range
+     * @param left First index
+     * @param right Last index
+     * @return Combined value of elements [left, right]
+     * @throws std::out_of_range if the range is invalid
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T query(size_t left, size_t right) const;
+
+    /**
+     * @brief Aggregate of all elements
+     * @return Combined value (identity if empty)
+     * Time Complexity: O(1)
+     */
+    T query_all() const { return nodes_[1]; }
+
+    /**
+     * @brief Apply an update to an inclusive index range
+     * @param left First index
+     * @param right Last index
+     * @param tag Update to apply (e.g. the amount to add)
+     * @throws std::out_of_range if the range is invalid
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    void update(size_t left, size_t right, const Tag& tag);
+
+    /**
+     * @brief Overwrite one element
+     * @param index Element index
+     * @param value New value
+     * @throws std::out_of_range if index is invalid
+     * Time Complexity: O(log n)
+     */
+    void set(size_t index, const T& value);
+
+    /**
+     * @brief Get one element
+     * @param index Element index
+     * @return Current value
+     * @throws std::out_of_range if index is invalid
+     * Time Complexity: O(log n)
+     */
+    T get(size_t index) const { return query(index, index); }
+
+    /**
+     * @brief Get number of elements
+     * @return Element count
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Check if the tree is empty
+     * @return True if there are no elements
+     */
+    bool empty() const { return size_ == 0; }
+
+private:
+    size_t size_;
+    size_t capacity_;        // Leaf count, a power of two
+    unsigned levels_;        // log2(capacity_)
+    std::vector<T> nodes_;   // 1-based heap order; leaves at capacity_
+    std::vector<Tag> tags_;  // Pending updates for internal nodes
+
+    size_t node_length(size_t node) const;
+    void apply_tag(size_t node, const Tag& tag);
+    void push(size_t node);
+    void pull(size_t node) { nodes_[node] = Monoid::combine(nodes_[2 * node], nodes_[2 * node + 1]); }
+    void push_boundaries(size_t left, size_t right);
+    void check_range(size_t left, size_t right) const;
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "range_query.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_RANGE_QUERY_H
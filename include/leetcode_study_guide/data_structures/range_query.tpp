@@ -0,0 +1,223 @@
+/**
+ * @file range_query.tpp
+ * @brief Template implementation for FenwickTree and SegmentTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_RANGE_QUERY_TPP
+#define LEETCODE_STUDY_GUIDE_RANGE_QUERY_TPP
+
+#include <stdexcept>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// FenwickTree Implementation
+
+template<typename T>
+FenwickTree<T>::FenwickTree(const std::vector<T>& values) : tree_(values.size() + 1, T()) {
+    // Linear build: each slot passes its total on to the next slot covering it
+    size_t n = values.size();
+    for (size_t i = 1; i <= n; ++i) {
+        tree_[i] += values[i - 1];
+        size_t parent = i + (i & (~i + 1));
+        if (parent <= n) tree_[parent] += tree_[i];
+    }
+}
+
+template<typename T>
+void FenwickTree<T>::add(size_t index, const T& delta) {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    for (size_t i = index + 1; i < tree_.size(); i += i & (~i + 1)) {
+        tree_[i] += delta;
+    }
+}
+
+template<typename T>
+void FenwickTree<T>::set(size_t index, const T& value) {
+    add(index, value - get(index));
+}
+
+template<typename T>
+T FenwickTree<T>::prefix_sum(size_t count) const {
+    if (count > size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    T sum = T();
+    for (size_t i = count; i > 0; i &= i - 1) {
+        sum += tree_[i];
+    }
+    return sum;
+}
+
+template<typename T>
+T FenwickTree<T>::range_sum(size_t left, size_t right) const {
+    if (left > right || right >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return prefix_sum(right + 1) - prefix_sum(left);
+}
+
+template<typename T>
+size_t FenwickTree<T>::lower_bound(const T& target) const {
+    // Descend the implicit tree from the largest power of two, keeping the
+    // longest prefix whose sum is still below target
+    size_t n = size();
+    size_t step = 1;
+    while (step * 2 <= n) step *= 2;
+
+    size_t position = 0;
+    T remaining = target;
+    for (; step > 0; step /= 2) {
+        if (position + step <= n && tree_[position + step] < remaining) {
+            position += step;
+            remaining -= tree_[position];
+        }
+    }
+    return position;
+}
+
+// SegmentTree Implementation
+
+template<typename T, typename Monoid, typename Update>
+SegmentTree<T, Monoid, Update>::SegmentTree(const std::vector<T>& values)
+    : size_(values.size()), capacity_(1), levels_(0) {
+    while (capacity_ < size_) {
+        capacity_ *= 2;
+        ++levels_;
+    }
+    nodes_.assign(2 * capacity_, Monoid::identity());
+    tags_.assign(capacity_, Update::identity());
+    std::copy(values.begin(), values.end(), nodes_.begin() + capacity_);
+    for (size_t node = capacity_ - 1; node > 0; --node) {
+        pull(node);
+    }
+}
+
+template<typename T, typename Monoid, typename Update>
+T SegmentTree<T, Monoid, Update>::query(size_t left, size_t right) const {
+    check_range(left, right);
+    size_t l = left + capacity_;
+    size_t r = right + 1 + capacity_;
+    const size_t first_leaf = l;
+    const size_t last_leaf = r - 1;
+
+    // Combine in order: left results grow rightwards, right results leftwards.
+    // Everything gathered into left_sum up to some level lies below the
+    // first leaf's ancestor one level higher (likewise right_sum and the last
+    // leaf), and ancestors' pending tags are newer than anything beneath
+    // them, so applying those tags bottom-up to the partial results gives
+    // the same answer as pushing them down, without writing to the tree.
+    T left_sum = Monoid::identity();
+    T right_sum = Monoid::identity();
+    size_t left_length = 0;
+    size_t right_length = 0;
+    for (unsigned level = 0;; ++level) {
+        if (l < r) {
+            if (l & 1) {
+                left_sum = Monoid::combine(left_sum, nodes_[l++]);
+                left_length += size_t(1) << level;
+            }
+            if (r & 1) {
+                right_sum = Monoid::combine(nodes_[--r], right_sum);
+                right_length += size_t(1) << level;
+            }
+            l /= 2;
+            r /= 2;
+        }
+        if (level == levels_) break;
+        // Skip empty partials: a tag applied to the identity can overflow
+        if (left_length > 0) {
+            left_sum = Update::template apply<Monoid>(tags_[first_leaf >> (level + 1)], left_sum, left_length);
+        }
+        if (right_length > 0) {
+            right_sum = Update::template apply<Monoid>(tags_[last_leaf >> (level + 1)], right_sum, right_length);
+        }
+    }
+    return Monoid::combine(left_sum, right_sum);
+}
+
+template<typename T, typename Monoid, typename Update>
+void SegmentTree<T, Monoid, Update>::update(size_t left, size_t right, const Tag& tag) {
+    check_range(left, right);
+    size_t l = left + capacity_;
+    size_t r = right + 1 + capacity_;
+    push_boundaries(l, r);
+
+    for (size_t lo = l, hi = r; lo < hi; lo /= 2, hi /= 2) {
+        if (lo & 1) apply_tag(lo++, tag);
+        if (hi & 1) apply_tag(--hi, tag);
+    }
+
+    // Recompute the ancestors of the two boundaries
+    for (unsigned i = 1; i <= levels_; ++i) {
+        if (((l >> i) << i) != l) pull(l >> i);
+        if (((r >> i) << i) != r) pull((r - 1) >> i);
+    }
+}
+
+template<typename T, typename Monoid, typename Update>
+void SegmentTree<T, Monoid, Update>::set(size_t index, const T& value) {
+    check_range(index, index);
+    size_t leaf = index + capacity_;
+    for (unsigned i = levels_; i >= 1; --i) {
+        push(leaf >> i);
+    }
+    nodes_[leaf] = value;
+    for (unsigned i = 1; i <= levels_; ++i) {
+        pull(leaf >> i);
+    }
+}
+
+// SegmentTree Helper Methods
+
+template<typename T, typename Monoid, typename Update>
+size_t SegmentTree<T, Monoid, Update>::node_length(size_t node) const {
+#if defined(__GNUC__) || defined(__clang__)
+    unsigned depth = 63 - __builtin_clzll(static_cast<unsigned long long>(node));
+#else
+    unsigned depth = 0;
+    while ((node >> (depth + 1)) != 0) ++depth;
+#endif
+    return capacity_ >> depth;
+}
+
+template<typename T, typename Monoid, typename Update>
+void SegmentTree<T, Monoid, Update>::apply_tag(size_t node, const Tag& tag) {
+    nodes_[node] = Update::template apply<Monoid>(tag, nodes_[node], node_length(node));
+    if (node < capacity_) {
+        tags_[node] = Update::compose(tag, tags_[node]);
+    }
+}
+
+template<typename T, typename Monoid, typename Update>
+void SegmentTree<T, Monoid, Update>::push(size_t node) {
+    apply_tag(2 * node, tags_[node]);
+    apply_tag(2 * node + 1, tags_[node]);
+    tags_[node] = Update::identity();
+}
+
+template<typename T, typename Monoid, typename Update>
+void SegmentTree<T, Monoid, Update>::push_boundaries(size_t left, size_t right) {
+    // Only nodes straddling a boundary of [left, right) can hold tags that
+    // affect the nodes written below them
+    for (unsigned i = levels_; i >= 1; --i) {
+        if (((left >> i) << i) != left) push(left >> i);
+        if (((right >> i) << i) != right) push((right - 1) >> i);
+    }
+}
+
+template<typename T, typename Monoid, typename Update>
+void SegmentTree<T, Monoid, Update>::check_range(size_t left, size_t right) const {
+    if (left > right || right >= size_) {
+        throw std::out_of_range("Index out of range");
+    }
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_RANGE_QUERY_TPP
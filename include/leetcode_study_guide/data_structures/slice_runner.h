@@ -0,0 +1,65 @@
+/**
+ * @file slice_runner.h
+ * @brief Internal fork-join helper shared by the parallel container operations
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_SLICE_RUNNER_H
+#define LEETCODE_STUDY_GUIDE_SLICE_RUNNER_H
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+namespace detail {
+
+// Runs body(slice) for every slice, slice 0 on the calling thread. Workers
+// are joined by a guard even while unwinding (destroying a joinable
+// std::thread calls std::terminate), and the first error raised by any
+// slice is rethrown once all of them have finished.
+template<typename Body>
+void run_slices(size_t num_slices, const Body& body) {
+    std::vector<std::exception_ptr> errors(num_slices);
+    auto guarded = [&](size_t slice) {
+        try {
+            body(slice);
+        } catch (...) {
+            errors[slice] = std::current_exception();
+        }
+    };
+
+    struct JoinGuard {
+        std::vector<std::thread> threads;
+        ~JoinGuard() {
+            for (auto& thread : threads) {
+                if (thread.joinable()) {
+                    thread.join();
+                }
+            }
+        }
+    } workers;
+    workers.threads.reserve(num_slices - 1);
+    for (size_t slice = 1; slice < num_slices; ++slice) {
+        workers.threads.emplace_back(guarded, slice);
+    }
+    guarded(0);
+    for (auto& worker : workers.threads) {
+        worker.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace detail
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_SLICE_RUNNER_H
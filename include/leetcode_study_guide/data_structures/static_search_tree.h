@@ -0,0 +1,145 @@
+/**
+ * @file static_search_tree.h
+ * @brief Read-only search tree over sorted keys in Eytzinger (BFS) order
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_STATIC_SEARCH_TREE_H
+#define LEETCODE_STUDY_GUIDE_STATIC_SEARCH_TREE_H
+
+#include "../common.h"
+#include <cstddef>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Immutable sorted set laid out as an implicit complete binary tree
+ *
+ * Keys are stored in one array in breadth-first order: the children of
+ * slot k are slots 2k and 2k+1 (slot 0 is unused). A search is a loop of
+ * k = 2k + (key[k] < value) with no data-dependent branch, so there are
+ * no mispredictions to flush. The 16 descendants four levels below slot k
+ * are the contiguous slots 16k..16k+15, one cache line for 4-byte keys,
+ * so each step prefetches that line and the memory latency of the next
+ * levels overlaps with the comparisons. Compared with the pointer-based
+ * BinarySearchTree there are no child pointers, no per-node allocation,
+ * and the hot top of the tree is packed into a few cache lines.
+ *
+ * Duplicate keys are allowed; lower_bound returns the first of a run.
+ */
+template<typename T>
+class StaticSearchTree {
+public:
+    /**
+     * @brief Default constructor (empty set)
+     */
+    StaticSearchTree() = default;
+
+    /**
+     * @brief Build from sorted values
+     * @param sorted_values Values in non-decreasing order
+     * @throws std::invalid_argument if values are not sorted
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    explicit StaticSearchTree(const std::vector<T>& sorted_values);
+
+    /**
+     * @brief Check whether a value is present
+     * @param value Value to search for
+     * @return True if found
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    bool contains(const T& value) const;
+
+    /**
+     * @brief Find the smallest stored value not less than value
+     * @param value Search key
+     * @return Pointer to the value, or nullptr if every value is smaller
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    const T* lower_bound(const T& value) const;
+
+    /**
+     * @brief Find the smallest stored value greater than value
+     * @param value Search key
+     * @return Pointer to the value, or nullptr if none is greater
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    const T* upper_bound(const T& value) const;
+
+    /**
+     * @brief Find the smallest stored value greater than value
+     * @param value Search key (need not be stored)
+     * @return Successor value
+     * @throws std::runtime_error if no successor exists
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T find_successor(const T& value) const;
+
+    /**
+     * @brief Find the largest stored value less than value
+     * @param value Search key (need not be stored)
+     * @return Predecessor value
+     * @throws std::runtime_error if no predecessor exists
+     * Time Complexity: O(log n)
+     * Space Complexity: O(1)
+     */
+    T find_predecessor(const T& value) const;
+
+    /**
+     * @brief Get values in sorted order
+     * @return Sorted vector of all values
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    std::vector<T> to_sorted_array() const;
+
+    /**
+     * @brief Get number of values
+     * @return Number of values
+     */
+    size_t size() const { return keys_.empty() ? 0 : keys_.size() - 1; }
+
+    /**
+     * @brief Check if set is empty
+     * @return True if empty
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Get bytes used by the key array
+     * @return Key storage in bytes (excluding heap data owned by keys)
+     */
+    size_t memory_usage() const { return keys_.capacity() * sizeof(T); }
+
+private:
+    // Keys per 64-byte cache line, rounded down to a power of two: the
+    // descendants of slot k this many slots wide start at slot k * kKeysPerLine
+    static constexpr size_t kKeysPerLine = sizeof(T) <= 4 ? 16 : sizeof(T) <= 8 ? 8 :
+                                           sizeof(T) <= 16 ? 4 : sizeof(T) <= 32 ? 2 : 1;
+
+    std::vector<T> keys_;  // keys_[1..n] in BFS order; keys_[0] unused
+
+    size_t fill(const std::vector<T>& sorted_values, size_t next, size_t slot);
+    size_t lower_bound_slot(const T& value) const;
+    size_t upper_bound_slot(const T& value) const;
+    void prefetch(size_t slot) const;
+
+    // Undo the final descent: drop trailing right turns plus the last left turn
+    static size_t strip_right_turns(size_t slot);
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "static_search_tree.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_STATIC_SEARCH_TREE_H
@@ -0,0 +1,165 @@
+/**
+ * @file static_search_tree.tpp
+ * @brief Template implementation for StaticSearchTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_STATIC_SEARCH_TREE_TPP
+#define LEETCODE_STUDY_GUIDE_STATIC_SEARCH_TREE_TPP
+
+#include <cstdint>
+#include <stdexcept>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// StaticSearchTree Implementation
+
+template<typename T>
+StaticSearchTree<T>::StaticSearchTree(const std::vector<T>& sorted_values) {
+    for (size_t i = 1; i < sorted_values.size(); ++i) {
+        if (sorted_values[i] < sorted_values[i - 1]) {
+            throw std::invalid_argument("Values must be sorted");
+        }
+    }
+    if (sorted_values.empty()) return;
+
+    keys_.assign(sorted_values.size() + 1, sorted_values.front());
+    fill(sorted_values, 0, 1);
+}
+
+template<typename T>
+bool StaticSearchTree<T>::contains(const T& value) const {
+    size_t slot = lower_bound_slot(value);
+    return slot != 0 && !(value < keys_[slot]);
+}
+
+template<typename T>
+const T* StaticSearchTree<T>::lower_bound(const T& value) const {
+    size_t slot = lower_bound_slot(value);
+    return slot == 0 ? nullptr : &keys_[slot];
+}
+
+template<typename T>
+const T* StaticSearchTree<T>::upper_bound(const T& value) const {
+    size_t slot = upper_bound_slot(value);
+    return slot == 0 ? nullptr : &keys_[slot];
+}
+
+template<typename T>
+T StaticSearchTree<T>::find_successor(const T& value) const {
+    size_t slot = upper_bound_slot(value);
+    if (slot == 0) {
+        throw std::runtime_error("No successor found");
+    }
+    return keys_[slot];
+}
+
+template<typename T>
+T StaticSearchTree<T>::find_predecessor(const T& value) const {
+    size_t n = size();
+    size_t slot = lower_bound_slot(value);
+
+    // The predecessor is the inorder predecessor of the lower bound slot
+    if (slot == 0) {
+        slot = n == 0 ? 0 : 1;  // Every value is smaller: take the maximum
+        while (slot != 0 && 2 * slot + 1 <= n) slot = 2 * slot + 1;
+    } else if (2 * slot <= n) {
+        slot = 2 * slot;  // Rightmost node of the left subtree
+        while (2 * slot + 1 <= n) slot = 2 * slot + 1;
+    } else {
+        // Climb while slot is a left child; its parent is then smaller
+        while (slot % 2 == 0) slot /= 2;
+        slot /= 2;
+    }
+
+    if (slot == 0) {
+        throw std::runtime_error("No predecessor found");
+    }
+    return keys_[slot];
+}
+
+template<typename T>
+std::vector<T> StaticSearchTree<T>::to_sorted_array() const {
+    std::vector<T> result;
+    size_t n = size();
+    result.reserve(n);
+
+    std::vector<size_t> stack;
+    size_t slot = 1;
+    while (slot <= n || !stack.empty()) {
+        while (slot <= n) {
+            stack.push_back(slot);
+            slot = 2 * slot;
+        }
+        slot = stack.back();
+        stack.pop_back();
+        result.push_back(keys_[slot]);
+        slot = 2 * slot + 1;
+    }
+
+    return result;
+}
+
+// Helper methods implementation
+
+template<typename T>
+size_t StaticSearchTree<T>::fill(const std::vector<T>& sorted_values, size_t next, size_t slot) {
+    // Inorder walk of the implicit tree; depth is log2(n)
+    if (slot < keys_.size()) {
+        next = fill(sorted_values, next, 2 * slot);
+        keys_[slot] = sorted_values[next++];
+        next = fill(sorted_values, next, 2 * slot + 1);
+    }
+    return next;
+}
+
+template<typename T>
+size_t StaticSearchTree<T>::lower_bound_slot(const T& value) const {
+    size_t n = size();
+    size_t slot = 1;
+    while (slot <= n) {
+        prefetch(slot * kKeysPerLine);
+        slot = 2 * slot + static_cast<size_t>(keys_[slot] < value);
+    }
+    return strip_right_turns(slot);
+}
+
+template<typename T>
+size_t StaticSearchTree<T>::upper_bound_slot(const T& value) const {
+    size_t n = size();
+    size_t slot = 1;
+    while (slot <= n) {
+        prefetch(slot * kKeysPerLine);
+        slot = 2 * slot + static_cast<size_t>(!(value < keys_[slot]));
+    }
+    return strip_right_turns(slot);
+}
+
+template<typename T>
+void StaticSearchTree<T>::prefetch(size_t slot) const {
+#if defined(__GNUC__) || defined(__clang__)
+    // Address arithmetic on integers: the slot may lie past the array, and a
+    // prefetch never faults
+    uintptr_t address = reinterpret_cast<uintptr_t>(keys_.data()) + slot * sizeof(T);
+    __builtin_prefetch(reinterpret_cast<const void*>(address));
+#else
+    (void)slot;
+#endif
+}
+
+template<typename T>
+size_t StaticSearchTree<T>::strip_right_turns(size_t slot) {
+#if defined(__GNUC__) || defined(__clang__)
+    return slot >> (__builtin_ctzll(~static_cast<unsigned long long>(slot)) + 1);
+#else
+    while (slot & 1) slot >>= 1;
+    return slot >> 1;
+#endif
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_STATIC_SEARCH_TREE_TPP
@@ -9,7 +9,13 @@
 #define LEETCODE_STUDY_GUIDE_TREE_H
 
 #include "../common.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <vector>
 #include <queue>
 #include <stack>
@@ -46,17 +52,214 @@ struct TreeNode {
         : data(value), left(left_child), right(right_child) {}
 };
 
+/**
+ * @brief Search tree node with balance and order-statistic metadata
+ *
+ * Used by BinarySearchTree and PersistentBinarySearchTree only, so plain
+ * trees do not pay for fields they never read.
+ */
+template<typename T>
+struct SearchTreeNode {
+    T data;
+    std::uint8_t rank;  // Balance metadata: AVL height or red-black level (1 for a leaf)
+    size_t subtree_size;  // Nodes in this subtree
+    std::shared_ptr<SearchTreeNode<T>> left;
+    std::shared_ptr<SearchTreeNode<T>> right;
+    
+    /**
+     * @brief Constructor for SearchTreeNode
+     * @param value Value to store in the node
+     */
+    explicit SearchTreeNode(const T& value) : data(value), rank(1), subtree_size(1), left(nullptr), right(nullptr) {}
+    
+    /**
+     * @brief Constructor with child nodes
+     * @param value Value to store in the node
+     * @param left_child Left child node
+     * @param right_child Right child node
+     */
+    SearchTreeNode(const T& value, 
+                   std::shared_ptr<SearchTreeNode<T>> left_child, 
+                   std::shared_ptr<SearchTreeNode<T>> right_child)
+        : data(value), rank(1), subtree_size(1), left(left_child), right(right_child) {
+        update_subtree_size();
+    }
+    
+    /**
+     * @brief Recompute subtree_size from the children
+     */
+    void update_subtree_size() {
+        subtree_size = 1 + (left ? left->subtree_size : 0) + (right ? right->subtree_size : 0);
+    }
+};
+
+/**
+ * @brief Traversal orders supported by TreeIterator
+ */
+enum class TraversalOrder { Inorder, Preorder, Postorder, LevelOrder };
+
+/**
+ * @brief Lazy forward iterator over a binary tree
+ *
+ * Produces the values of a traversal one at a time. Only the pending nodes
+ * are kept (O(h) for the depth-first orders, O(w) for level order), so
+ * reading the first few values or a key range never materializes the whole
+ * tree. Iterators are invalidated by any modification of the tree.
+ *
+ * @tparam Node Node type (TreeNode or SearchTreeNode)
+ */
+template<typename T, typename Node = TreeNode<T>>
+class TreeIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    /**
+     * @brief Construct the end iterator
+     */
+    TreeIterator() : order_(TraversalOrder::Inorder) {}
+
+    /**
+     * @brief Start a full traversal
+     * @param root Root of the tree (may be null)
+     * @param order Traversal order
+     */
+    TreeIterator(const Node* root, TraversalOrder order);
+
+    /**
+     * @brief Start an inorder traversal of the values in [lo, hi] of a BST
+     * @param root Root of the BST (may be null)
+     * @param lo Inclusive lower bound
+     * @param hi Inclusive upper bound
+     */
+    TreeIterator(const Node* root, const T& lo, const T& hi);
+
+    reference operator*() const { return current()->data; }
+    pointer operator->() const { return &current()->data; }
+
+    TreeIterator& operator++();
+
+    TreeIterator operator++(int) {
+        TreeIterator previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    bool operator==(const TreeIterator& other) const { return current() == other.current(); }
+    bool operator!=(const TreeIterator& other) const { return !(*this == other); }
+
+private:
+    TraversalOrder order_;
+    std::deque<const Node*> pending_;  // Stack (back is current), queue for level order (front)
+    std::optional<T> upper_bound_;     // Inclusive bound for BST range iteration
+
+    const Node* current() const {
+        if (pending_.empty()) return nullptr;
+        return order_ == TraversalOrder::LevelOrder ? pending_.front() : pending_.back();
+    }
+    void push_left_path(const Node* node);
+    void push_postorder_path(const Node* node);
+    void check_upper_bound();
+};
+
+/**
+ * @brief Begin/end pair of TreeIterators, usable in range-based for loops
+ */
+template<typename T, typename Node = TreeNode<T>>
+class TraversalRange {
+public:
+    explicit TraversalRange(TreeIterator<T, Node> first) : first_(std::move(first)) {}
+
+    TreeIterator<T, Node> begin() const { return first_; }
+    TreeIterator<T, Node> end() const { return TreeIterator<T, Node>(); }
+
+private:
+    TreeIterator<T, Node> first_;
+};
+
+/**
+ * @brief Single-pass inorder traversal in O(1) extra memory (Morris)
+ *
+ * Instead of a stack, the walk temporarily threads the right pointer of
+ * each node's inorder predecessor back to the node and removes the thread
+ * on the way out. The tree is therefore modified while a range is alive:
+ * do not read or modify it through anything else until the range is
+ * destroyed. Destroying a range early finishes the walk so that every
+ * thread is removed.
+ */
+template<typename T, typename Node = TreeNode<T>>
+class MorrisInorderRange {
+public:
+    /**
+     * @brief Input iterator over a MorrisInorderRange
+     */
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        explicit iterator(MorrisInorderRange* range = nullptr) : range_(range) {}
+
+        reference operator*() const { return range_->visit_->data; }
+        pointer operator->() const { return &range_->visit_->data; }
+
+        iterator& operator++() {
+            range_->advance();
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const { return node() == other.node(); }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+
+    private:
+        MorrisInorderRange* range_;
+
+        const Node* node() const { return range_ ? range_->visit_ : nullptr; }
+    };
+
+    /**
+     * @brief Start the walk
+     * @param root Root of the tree (may be null)
+     */
+    explicit MorrisInorderRange(std::shared_ptr<Node> root);
+
+    /**
+     * @brief Finish the walk, removing any remaining threads
+     */
+    ~MorrisInorderRange();
+
+    MorrisInorderRange(const MorrisInorderRange&) = delete;
+    MorrisInorderRange& operator=(const MorrisInorderRange&) = delete;
+
+    iterator begin() { return iterator(this); }
+    iterator end() { return iterator(); }
+
+private:
+    std::shared_ptr<Node> cursor_;  // Next subtree to walk
+    const Node* visit_;       // Current value, null when done
+
+    void advance();
+};
+
 /**
  * @brief Binary Tree implementation with traversal algorithms
  * 
  * This class provides a comprehensive implementation of binary tree operations
  * commonly used in LeetCode problems, including all traversal methods and
  * tree manipulation algorithms.
+ *
+ * @tparam Node Node type; BinarySearchTree builds on SearchTreeNode
  */
-template<typename T>
+template<typename T, typename Node = TreeNode<T>>
 class BinaryTree {
 public:
-    using NodePtr = std::shared_ptr<TreeNode<T>>;
+    using NodePtr = std::shared_ptr<Node>;
     
     /**
      * @brief Default constructor
@@ -68,7 +271,7 @@ public:
      * @param root_value Value for the root node
      */
     explicit BinaryTree(const T& root_value) 
-        : root_(std::make_shared<TreeNode<T>>(root_value)), size_(1) {}
+        : root_(std::make_shared<Node>(root_value)), size_(1) {}
     
     /**
      * @brief Destructor
@@ -164,6 +367,66 @@ public:
      */
     std::vector<T> postorder_iterative() const;
     
+    // Lazy Traversals
+    
+    /**
+     * @brief Lazy inorder traversal
+     * @return Range of forward iterators
+     * Time Complexity: O(1) per step amortized, O(n) total
+     * Space Complexity: O(h)
+     */
+    TraversalRange<T, Node> inorder() const { return traversal(TraversalOrder::Inorder); }
+    
+    /**
+     * @brief Lazy preorder traversal
+     * @return Range of forward iterators
+     * Time Complexity: O(1) per step
+     * Space Complexity: O(h)
+     */
+    TraversalRange<T, Node> preorder() const { return traversal(TraversalOrder::Preorder); }
+    
+    /**
+     * @brief Lazy postorder traversal
+     * @return Range of forward iterators
+     * Time Complexity: O(1) per step amortized, O(n) total
+     * Space Complexity: O(h)
+     */
+    TraversalRange<T, Node> postorder() const { return traversal(TraversalOrder::Postorder); }
+    
+    /**
+     * @brief Lazy level-order traversal
+     * @return Range of forward iterators
+     * Time Complexity: O(1) per step
+     * Space Complexity: O(w) where w is maximum width
+     */
+    TraversalRange<T, Node> level_order() const { return traversal(TraversalOrder::LevelOrder); }
+    
+    /**
+     * @brief Lazy traversal in the given order
+     * @param order Traversal order
+     * @return Range of forward iterators
+     */
+    TraversalRange<T, Node> traversal(TraversalOrder order) const {
+        return TraversalRange<T, Node>(TreeIterator<T, Node>(root_.get(), order));
+    }
+    
+    /**
+     * @brief Inorder traversal in O(1) extra memory (threads the tree while alive)
+     *
+     * Not const: the walk rewrites right pointers, so it must not run while
+     * any other thread reads the tree, including through the const API.
+     * @return Single-pass range; see MorrisInorderRange
+     * Time Complexity: O(n) total
+     * Space Complexity: O(1)
+     */
+    MorrisInorderRange<T, Node> morris_inorder() { return MorrisInorderRange<T, Node>(root_); }
+    
+    /**
+     * @brief Inorder iteration support for range-based for loops
+     */
+    TreeIterator<T, Node> begin() const { return TreeIterator<T, Node>(root_.get(), TraversalOrder::Inorder); }
+    TreeIterator<T, Node> end() const { return TreeIterator<T, Node>(); }
+    
     // Tree Properties and Analysis
     
     /**
@@ -293,30 +556,113 @@ protected:
     void print_tree_helper(NodePtr node, const std::string& prefix, bool is_last) const;
 };
 
+template<typename T>
+class StaticSearchTree;
+
+/**
+ * @brief Balance policy for a plain BST (no rebalancing)
+ *
+ * A balance policy supplies two hooks used by BinarySearchTree:
+ * rebalance(node) runs on every node on the path back up from an insert
+ * or remove and returns the (possibly rotated) subtree root, and
+ * update(node) recomputes the node's rank when a subtree is built
+ * bottom-up from sorted data.
+ */
+struct NoBalance {
+    template<typename T>
+    static std::shared_ptr<SearchTreeNode<T>> rebalance(std::shared_ptr<SearchTreeNode<T>> node) { return node; }
+
+    template<typename T>
+    static void update(SearchTreeNode<T>&) {}
+};
+
+/**
+ * @brief AVL balance policy
+ *
+ * rank holds the subtree height and sibling heights differ by at most one,
+ * so the tree height stays below 1.44 log2(n + 2).
+ */
+struct AvlBalance {
+    template<typename T>
+    static std::shared_ptr<SearchTreeNode<T>> rebalance(std::shared_ptr<SearchTreeNode<T>> node);
+
+    template<typename T>
+    static void update(SearchTreeNode<T>& node);
+
+private:
+    template<typename T>
+    static int height(const std::shared_ptr<SearchTreeNode<T>>& node) { return node ? node->rank : 0; }
+
+    template<typename T>
+    static std::shared_ptr<SearchTreeNode<T>> rotate_left(std::shared_ptr<SearchTreeNode<T>> node);
+
+    template<typename T>
+    static std::shared_ptr<SearchTreeNode<T>> rotate_right(std::shared_ptr<SearchTreeNode<T>> node);
+};
+
+/**
+ * @brief Red-black balance policy in Andersson's (AA tree) form
+ *
+ * rank holds the level, which is the black height. A red node is a right
+ * child on its parent's level; left children are always black and no red
+ * node has a red child. This is the right-leaning red-black tree, whose
+ * fix-ups (skew and split) all run on the way back up, so insert and
+ * remove share one rebalance step. The height stays below 2 log2(n + 1).
+ */
+struct RedBlackBalance {
+    template<typename T>
+    static std::shared_ptr<SearchTreeNode<T>> rebalance(std::shared_ptr<SearchTreeNode<T>> node);
+
+    template<typename T>
+    static void update(SearchTreeNode<T>& node);
+
+private:
+    template<typename T>
+    static int level(const std::shared_ptr<SearchTreeNode<T>>& node) { return node ? node->rank : 0; }
+
+    template<typename T>
+    static std::shared_ptr<SearchTreeNode<T>> skew(std::shared_ptr<SearchTreeNode<T>> node);
+
+    template<typename T>
+    static std::shared_ptr<SearchTreeNode<T>> split(std::shared_ptr<SearchTreeNode<T>> node);
+};
+
 /**
  * @brief Binary Search Tree implementation
  * 
  * This class extends BinaryTree with BST-specific operations including
  * search, insert, delete, and validation. Maintains BST property where
  * left subtree values < root < right subtree values.
+ *
+ * @tparam BalancePolicy NoBalance (default), AvlBalance or RedBlackBalance.
+ * With a balancing policy, insert, search, remove, find_successor and
+ * find_predecessor are O(log n) even for sorted insertion order.
+ *
+ * Every node also tracks its subtree size, which turns the order
+ * statistics (kth_smallest, kth_largest, rank, count_in_range) into a
+ * single root-to-leaf descent.
+ *
+ * The tree is a BinaryTree over SearchTreeNode, so it binds to
+ * BinaryTree<T, SearchTreeNode<T>>& and to the standalone functions, which
+ * take any node type.
  */
-template<typename T>
-class BinarySearchTree : public BinaryTree<T> {
+template<typename T, typename BalancePolicy = NoBalance>
+class BinarySearchTree : public BinaryTree<T, SearchTreeNode<T>> {
+    using Base = BinaryTree<T, SearchTreeNode<T>>;
+    
 public:
-    using NodePtr = std::shared_ptr<TreeNode<T>>;
-    using BinaryTree<T>::root_;
-    using BinaryTree<T>::size_;
+    using NodePtr = std::shared_ptr<SearchTreeNode<T>>;
     
     /**
      * @brief Default constructor
      */
-    BinarySearchTree() : BinaryTree<T>() {}
+    BinarySearchTree() : Base() {}
     
     /**
      * @brief Constructor with root value
      * @param root_value Value for the root node
      */
-    explicit BinarySearchTree(const T& root_value) : BinaryTree<T>(root_value) {}
+    explicit BinarySearchTree(const T& root_value) : Base(root_value) {}
     
     /**
      * @brief Constructor from sorted array
@@ -324,13 +670,20 @@ public:
      */
     explicit BinarySearchTree(const std::vector<T>& sorted_array);
     
+    // BinaryTree's shape edits would bypass ordering, balance and subtree
+    // sizes, so a BinarySearchTree changes only through insert and remove
+    void set_root(const T& value) = delete;
+    NodePtr insert_left(NodePtr parent, const T& value) = delete;
+    NodePtr insert_right(NodePtr parent, const T& value) = delete;
+    void build_from_array(const std::vector<T>& values, const T& null_value) = delete;
+    
     // BST Operations
     
     /**
      * @brief Insert value into BST
      * @param value Value to insert
      * @return True if inserted, false if already exists
-     * Time Complexity: O(h) where h is height
+     * Time Complexity: O(h) where h is height (O(log n) when balanced)
      * Space Complexity: O(h) for recursion
      */
     bool insert(const T& value);
@@ -339,7 +692,7 @@ public:
      * @brief Search for value in BST
      * @param value Value to search for
      * @return True if found, false otherwise
-     * Time Complexity: O(h) where h is height
+     * Time Complexity: O(h) where h is height (O(log n) when balanced)
      * Space Complexity: O(h) for recursion
      */
     bool search(const T& value) const;
@@ -348,7 +701,7 @@ public:
      * @brief Delete value from BST
      * @param value Value to delete
      * @return True if deleted, false if not found
-     * Time Complexity: O(h) where h is height
+     * Time Complexity: O(h) where h is height (O(log n) when balanced)
      * Space Complexity: O(h) for recursion
      */
     bool remove(const T& value);
@@ -375,9 +728,9 @@ public:
      * @brief Find inorder successor of given value
      * @param value Value to find successor for
      * @return Successor value
-     * @throws std::runtime_error if no successor exists
+     * @throws std::runtime_error if value is absent or has no successor
      * Time Complexity: O(h)
-     * Space Complexity: O(h)
+     * Space Complexity: O(1)
      */
     T find_successor(const T& value) const;
     
@@ -385,9 +738,9 @@ public:
      * @brief Find inorder predecessor of given value
      * @param value Value to find predecessor for
      * @return Predecessor value
-     * @throws std::runtime_error if no predecessor exists
+     * @throws std::runtime_error if value is absent or has no predecessor
      * Time Complexity: O(h)
-     * Space Complexity: O(h)
+     * Space Complexity: O(1)
      */
     T find_predecessor(const T& value) const;
     
@@ -409,13 +762,34 @@ public:
      */
     std::vector<T> to_sorted_array() const;
     
+    /**
+     * @brief Build a read-only StaticSearchTree holding the same values
+     * @return Static search tree for fast lookups on data that no longer changes
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    StaticSearchTree<T> freeze() const;
+    
+    /**
+     * @brief Lazy inorder iteration over the values in [lo, hi]
+     * @param lo Inclusive lower bound
+     * @param hi Inclusive upper bound
+     * @return Range of forward iterators in ascending order
+     * Time Complexity: O(h) to start, O(1) amortized per value
+     * Space Complexity: O(h)
+     */
+    TraversalRange<T, SearchTreeNode<T>> range(const T& lo, const T& hi) const {
+        return TraversalRange<T, SearchTreeNode<T>>(TreeIterator<T, SearchTreeNode<T>>(root_.get(), lo, hi));
+    }
+    
     /**
      * @brief Find kth smallest element (1-indexed)
      * @param k Position (1-indexed)
      * @return kth smallest element
      * @throws std::out_of_range if k is invalid
-     * Time Complexity: O(h + k)
-     * Space Complexity: O(h)
+     * @throws std::logic_error if nodes were edited outside insert/remove
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
      */
     T kth_smallest(int k) const;
     
@@ -424,11 +798,31 @@ public:
      * @param k Position (1-indexed)
      * @return kth largest element
      * @throws std::out_of_range if k is invalid
-     * Time Complexity: O(h + k)
-     * Space Complexity: O(h)
+     * @throws std::logic_error if nodes were edited outside insert/remove
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
      */
     T kth_largest(int k) const;
     
+    /**
+     * @brief Count values smaller than the given value
+     * @param value Value to rank (need not be in the tree)
+     * @return Number of stored values less than value (0-based rank)
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    size_t rank(const T& value) const;
+    
+    /**
+     * @brief Count values in a closed range
+     * @param lo Lower bound (inclusive)
+     * @param hi Upper bound (inclusive)
+     * @return Number of stored values v with lo <= v <= hi (0 if hi < lo)
+     * Time Complexity: O(h)
+     * Space Complexity: O(1)
+     */
+    size_t count_in_range(const T& lo, const T& hi) const;
+    
     // Tree Balancing (Basic AVL concepts)
     
     /**
@@ -448,24 +842,36 @@ public:
      */
     bool needs_rebalancing() const;
     
+    // The rotations keep subtree sizes but not a balance policy's ranks, so
+    // only unbalanced trees offer them; AvlBalance and RedBlackBalance
+    // rotate through their own update path
+    
     /**
-     * @brief Perform right rotation (for AVL balancing)
+     * @brief Perform right rotation (NoBalance trees only)
      * @param node Root of subtree to rotate
-     * @return New root after rotation
+     * @return New root after rotation; the caller relinks it
      * Time Complexity: O(1)
      * Space Complexity: O(1)
      */
+    template<typename Policy = BalancePolicy,
+             typename = typename std::enable_if<std::is_same<Policy, NoBalance>::value>::type>
     NodePtr rotate_right(NodePtr node);
     
     /**
-     * @brief Perform left rotation (for AVL balancing)
+     * @brief Perform left rotation (NoBalance trees only)
      * @param node Root of subtree to rotate
-     * @return New root after rotation
+     * @return New root after rotation; the caller relinks it
      * Time Complexity: O(1)
      * Space Complexity: O(1)
      */
+    template<typename Policy = BalancePolicy,
+             typename = typename std::enable_if<std::is_same<Policy, NoBalance>::value>::type>
     NodePtr rotate_left(NodePtr node);
 
+protected:
+    using Base::root_;
+    using Base::size_;
+
 private:
     // Helper methods for BST operations
     NodePtr insert_helper(NodePtr node, const T& value, bool& inserted);
@@ -474,8 +880,8 @@ private:
     NodePtr find_min_node(NodePtr node) const;
     NodePtr find_max_node(NodePtr node) const;
     bool is_valid_bst_helper(NodePtr node, const T* min_val, const T* max_val) const;
-    bool kth_smallest_helper(NodePtr node, int& k, T& result) const;
-    bool kth_largest_helper(NodePtr node, int& k, T& result) const;
+    NodePtr select_node(size_t index) const;
+    size_t count_not_greater(const T& value) const;
     int balance_factor_helper(NodePtr node) const;
     bool needs_rebalancing_helper(NodePtr node) const;
     NodePtr build_balanced_bst(const std::vector<T>& sorted_array, int start, int end);
@@ -491,8 +897,8 @@ private:
  * Time Complexity: O(min(n1, n2))
  * Space Complexity: O(min(h1, h2))
  */
-template<typename T>
-bool are_identical(const BinaryTree<T>& tree1, const BinaryTree<T>& tree2);
+template<typename T, typename Node1, typename Node2>
+bool are_identical(const BinaryTree<T, Node1>& tree1, const BinaryTree<T, Node2>& tree2);
 
 /**
  * @brief Serialize tree to string (preorder with null markers)
@@ -502,8 +908,8 @@ bool are_identical(const BinaryTree<T>& tree1, const BinaryTree<T>& tree2);
  * Time Complexity: O(n)
  * Space Complexity: O(n)
  */
-template<typename T>
-std::string serialize_tree(const BinaryTree<T>& tree, const std::string& null_marker = "null");
+template<typename T, typename Node>
+std::string serialize_tree(const BinaryTree<T, Node>& tree, const std::string& null_marker = "null");
 
 /**
  * @brief Deserialize string to tree
@@ -523,8 +929,8 @@ BinaryTree<T> deserialize_tree(const std::string& data, const std::string& null_
  * Time Complexity: O(n)
  * Space Complexity: O(h)
  */
-template<typename T>
-int tree_diameter(const BinaryTree<T>& tree);
+template<typename T, typename Node>
+int tree_diameter(const BinaryTree<T, Node>& tree);
 
 } // namespace data_structures
 } // namespace leetcode_study_guide
@@ -8,6 +8,7 @@
 #ifndef LEETCODE_STUDY_GUIDE_TREE_TPP
 #define LEETCODE_STUDY_GUIDE_TREE_TPP
 
+#include "static_search_tree.h"
 #include <stdexcept>
 #include <sstream>
 #include <algorithm>
@@ -16,46 +17,180 @@
 namespace leetcode_study_guide {
 namespace data_structures {
 
+// TreeIterator Implementation
+
+template<typename T, typename Node>
+TreeIterator<T, Node>::TreeIterator(const Node* root, TraversalOrder order) : order_(order) {
+    if (!root) return;
+    
+    switch (order_) {
+        case TraversalOrder::Inorder:
+            push_left_path(root);
+            break;
+        case TraversalOrder::Postorder:
+            push_postorder_path(root);
+            break;
+        case TraversalOrder::Preorder:
+        case TraversalOrder::LevelOrder:
+            pending_.push_back(root);
+            break;
+    }
+}
+
+template<typename T, typename Node>
+TreeIterator<T, Node>::TreeIterator(const Node* root, const T& lo, const T& hi)
+    : order_(TraversalOrder::Inorder), upper_bound_(hi) {
+    // Keep only the ancestors still >= lo: exactly the inorder stack at lower_bound(lo)
+    for (const Node* node = root; node;) {
+        if (node->data < lo) {
+            node = node->right.get();
+        } else {
+            pending_.push_back(node);
+            node = node->left.get();
+        }
+    }
+    check_upper_bound();
+}
+
+template<typename T, typename Node>
+TreeIterator<T, Node>& TreeIterator<T, Node>::operator++() {
+    const Node* node = current();
+    if (!node) return *this;
+    
+    switch (order_) {
+        case TraversalOrder::Inorder:
+            pending_.pop_back();
+            push_left_path(node->right.get());
+            check_upper_bound();
+            break;
+        case TraversalOrder::Preorder:
+            pending_.pop_back();
+            if (node->right) pending_.push_back(node->right.get());
+            if (node->left) pending_.push_back(node->left.get());
+            break;
+        case TraversalOrder::Postorder:
+            pending_.pop_back();
+            // Coming up from a left child: the right subtree goes first
+            if (!pending_.empty() && pending_.back()->right && pending_.back()->right.get() != node) {
+                push_postorder_path(pending_.back()->right.get());
+            }
+            break;
+        case TraversalOrder::LevelOrder:
+            pending_.pop_front();
+            if (node->left) pending_.push_back(node->left.get());
+            if (node->right) pending_.push_back(node->right.get());
+            break;
+    }
+    return *this;
+}
+
+template<typename T, typename Node>
+void TreeIterator<T, Node>::push_left_path(const Node* node) {
+    for (; node; node = node->left.get()) {
+        pending_.push_back(node);
+    }
+}
+
+template<typename T, typename Node>
+void TreeIterator<T, Node>::push_postorder_path(const Node* node) {
+    // Descend to the first postorder node, preferring left children
+    while (node) {
+        pending_.push_back(node);
+        node = node->left ? node->left.get() : node->right.get();
+    }
+}
+
+template<typename T, typename Node>
+void TreeIterator<T, Node>::check_upper_bound() {
+    if (upper_bound_ && !pending_.empty() && *upper_bound_ < pending_.back()->data) {
+        pending_.clear();
+    }
+}
+
+// MorrisInorderRange Implementation
+
+template<typename T, typename Node>
+MorrisInorderRange<T, Node>::MorrisInorderRange(std::shared_ptr<Node> root)
+    : cursor_(std::move(root)), visit_(nullptr) {
+    advance();
+}
+
+template<typename T, typename Node>
+MorrisInorderRange<T, Node>::~MorrisInorderRange() {
+    while (visit_) {
+        advance();
+    }
+}
+
+template<typename T, typename Node>
+void MorrisInorderRange<T, Node>::advance() {
+    while (cursor_) {
+        if (!cursor_->left) {
+            visit_ = cursor_.get();
+            cursor_ = cursor_->right;
+            return;
+        }
+        
+        Node* predecessor = cursor_->left.get();
+        while (predecessor->right && predecessor->right != cursor_) {
+            predecessor = predecessor->right.get();
+        }
+        
+        if (!predecessor->right) {
+            // First visit: thread the predecessor back here, walk the left subtree
+            predecessor->right = cursor_;
+            cursor_ = cursor_->left;
+        } else {
+            // Left subtree done: remove the thread and visit this node
+            predecessor->right = nullptr;
+            visit_ = cursor_.get();
+            cursor_ = cursor_->right;
+            return;
+        }
+    }
+    visit_ = nullptr;
+}
+
 // BinaryTree Implementation
 
-template<typename T>
-void BinaryTree<T>::set_root(const T& value) {
-    root_ = std::make_shared<TreeNode<T>>(value);
+template<typename T, typename Node>
+void BinaryTree<T, Node>::set_root(const T& value) {
+    root_ = std::make_shared<Node>(value);
     size_ = 1;
 }
 
-template<typename T>
-typename BinaryTree<T>::NodePtr BinaryTree<T>::insert_left(NodePtr parent, const T& value) {
+template<typename T, typename Node>
+typename BinaryTree<T, Node>::NodePtr BinaryTree<T, Node>::insert_left(NodePtr parent, const T& value) {
     if (!parent) {
         throw std::invalid_argument("Parent node cannot be null");
     }
     
-    auto new_node = std::make_shared<TreeNode<T>>(value);
+    auto new_node = std::make_shared<Node>(value);
     parent->left = new_node;
     ++size_;
     return new_node;
 }
 
-template<typename T>
-typename BinaryTree<T>::NodePtr BinaryTree<T>::insert_right(NodePtr parent, const T& value) {
+template<typename T, typename Node>
+typename BinaryTree<T, Node>::NodePtr BinaryTree<T, Node>::insert_right(NodePtr parent, const T& value) {
     if (!parent) {
         throw std::invalid_argument("Parent node cannot be null");
     }
     
-    auto new_node = std::make_shared<TreeNode<T>>(value);
+    auto new_node = std::make_shared<Node>(value);
     parent->right = new_node;
     ++size_;
     return new_node;
 }
 
-template<typename T>
-void BinaryTree<T>::build_from_array(const std::vector<T>& values, const T& null_value) {
+template<typename T, typename Node>
+void BinaryTree<T, Node>::build_from_array(const std::vector<T>& values, const T& null_value) {
     if (values.empty()) {
         clear();
         return;
     }
     
-    root_ = std::make_shared<TreeNode<T>>(values[0]);
+    root_ = std::make_shared<Node>(values[0]);
     size_ = 1;
     
     std::queue<NodePtr> queue;
@@ -67,43 +202,43 @@ void BinaryTree<T>::build_from_array(const std::vector<T>& values, const T& null
         
         // Left child
         if (i < values.size() && values[i] != null_value) {
-            current->left = std::make_shared<TreeNode<T>>(values[i]);
+            current->left = std::make_shared<Node>(values[i]);
             queue.push(current->left);
             ++size_;
         }
         
         // Right child
         if (i + 1 < values.size() && values[i + 1] != null_value) {
-            current->right = std::make_shared<TreeNode<T>>(values[i + 1]);
+            current->right = std::make_shared<Node>(values[i + 1]);
             queue.push(current->right);
             ++size_;
         }
     }
 }
 
-template<typename T>
-std::vector<T> BinaryTree<T>::inorder_traversal() const {
+template<typename T, typename Node>
+std::vector<T> BinaryTree<T, Node>::inorder_traversal() const {
     std::vector<T> result;
     inorder_helper(root_, result);
     return result;
 }
 
-template<typename T>
-std::vector<T> BinaryTree<T>::preorder_traversal() const {
+template<typename T, typename Node>
+std::vector<T> BinaryTree<T, Node>::preorder_traversal() const {
     std::vector<T> result;
     preorder_helper(root_, result);
     return result;
 }
 
-template<typename T>
-std::vector<T> BinaryTree<T>::postorder_traversal() const {
+template<typename T, typename Node>
+std::vector<T> BinaryTree<T, Node>::postorder_traversal() const {
     std::vector<T> result;
     postorder_helper(root_, result);
     return result;
 }
 
-template<typename T>
-std::vector<T> BinaryTree<T>::level_order_traversal() const {
+template<typename T, typename Node>
+std::vector<T> BinaryTree<T, Node>::level_order_traversal() const {
     std::vector<T> result;
     if (!root_) return result;
     
@@ -122,8 +257,8 @@ std::vector<T> BinaryTree<T>::level_order_traversal() const {
     return result;
 }
 
-template<typename T>
-std::vector<T> BinaryTree<T>::inorder_iterative() const {
+template<typename T, typename Node>
+std::vector<T> BinaryTree<T, Node>::inorder_iterative() const {
     std::vector<T> result;
     if (!root_) return result;
     
@@ -145,8 +280,8 @@ std::vector<T> BinaryTree<T>::inorder_iterative() const {
     return result;
 }
 
-template<typename T>
-std::vector<T> BinaryTree<T>::preorder_iterative() const {
+template<typename T, typename Node>
+std::vector<T> BinaryTree<T, Node>::preorder_iterative() const {
     std::vector<T> result;
     if (!root_) return result;
     
@@ -165,8 +300,8 @@ std::vector<T> BinaryTree<T>::preorder_iterative() const {
     return result;
 }
 
-template<typename T>
-std::vector<T> BinaryTree<T>::postorder_iterative() const {
+template<typename T, typename Node>
+std::vector<T> BinaryTree<T, Node>::postorder_iterative() const {
     std::vector<T> result;
     if (!root_) return result;
     
@@ -190,58 +325,58 @@ std::vector<T> BinaryTree<T>::postorder_iterative() const {
     return result;
 }
 
-template<typename T>
-int BinaryTree<T>::height() const {
+template<typename T, typename Node>
+int BinaryTree<T, Node>::height() const {
     return height_helper(root_);
 }
 
-template<typename T>
-int BinaryTree<T>::min_depth() const {
+template<typename T, typename Node>
+int BinaryTree<T, Node>::min_depth() const {
     return min_depth_helper(root_);
 }
 
-template<typename T>
-bool BinaryTree<T>::is_balanced() const {
+template<typename T, typename Node>
+bool BinaryTree<T, Node>::is_balanced() const {
     int height = 0;
     return is_balanced_helper(root_, height);
 }
 
-template<typename T>
-bool BinaryTree<T>::is_symmetric() const {
+template<typename T, typename Node>
+bool BinaryTree<T, Node>::is_symmetric() const {
     if (!root_) return true;
     return is_symmetric_helper(root_->left, root_->right);
 }
 
-template<typename T>
-size_t BinaryTree<T>::count_nodes() const {
+template<typename T, typename Node>
+size_t BinaryTree<T, Node>::count_nodes() const {
     return count_nodes_helper(root_);
 }
 
-template<typename T>
-typename BinaryTree<T>::NodePtr BinaryTree<T>::find(const T& value) const {
+template<typename T, typename Node>
+typename BinaryTree<T, Node>::NodePtr BinaryTree<T, Node>::find(const T& value) const {
     return find_helper(root_, value);
 }
 
-template<typename T>
-std::vector<T> BinaryTree<T>::find_path(const T& target) const {
+template<typename T, typename Node>
+std::vector<T> BinaryTree<T, Node>::find_path(const T& target) const {
     std::vector<T> path;
     find_path_helper(root_, target, path);
     return path;
 }
 
-template<typename T>
-typename BinaryTree<T>::NodePtr BinaryTree<T>::lowest_common_ancestor(const T& val1, const T& val2) const {
+template<typename T, typename Node>
+typename BinaryTree<T, Node>::NodePtr BinaryTree<T, Node>::lowest_common_ancestor(const T& val1, const T& val2) const {
     return lca_helper(root_, val1, val2);
 }
 
-template<typename T>
-void BinaryTree<T>::clear() {
+template<typename T, typename Node>
+void BinaryTree<T, Node>::clear() {
     root_ = nullptr;
     size_ = 0;
 }
 
-template<typename T>
-void BinaryTree<T>::print_tree() const {
+template<typename T, typename Node>
+void BinaryTree<T, Node>::print_tree() const {
     if (!root_) {
         std::cout << "Empty tree\n";
         return;
@@ -251,38 +386,38 @@ void BinaryTree<T>::print_tree() const {
 
 // Helper methods implementation
 
-template<typename T>
-void BinaryTree<T>::inorder_helper(NodePtr node, std::vector<T>& result) const {
+template<typename T, typename Node>
+void BinaryTree<T, Node>::inorder_helper(NodePtr node, std::vector<T>& result) const {
     if (!node) return;
     inorder_helper(node->left, result);
     result.push_back(node->data);
     inorder_helper(node->right, result);
 }
 
-template<typename T>
-void BinaryTree<T>::preorder_helper(NodePtr node, std::vector<T>& result) const {
+template<typename T, typename Node>
+void BinaryTree<T, Node>::preorder_helper(NodePtr node, std::vector<T>& result) const {
     if (!node) return;
     result.push_back(node->data);
     preorder_helper(node->left, result);
     preorder_helper(node->right, result);
 }
 
-template<typename T>
-void BinaryTree<T>::postorder_helper(NodePtr node, std::vector<T>& result) const {
+template<typename T, typename Node>
+void BinaryTree<T, Node>::postorder_helper(NodePtr node, std::vector<T>& result) const {
     if (!node) return;
     postorder_helper(node->left, result);
     postorder_helper(node->right, result);
     result.push_back(node->data);
 }
 
-template<typename T>
-int BinaryTree<T>::height_helper(NodePtr node) const {
+template<typename T, typename Node>
+int BinaryTree<T, Node>::height_helper(NodePtr node) const {
     if (!node) return 0;
     return 1 + std::max(height_helper(node->left), height_helper(node->right));
 }
 
-template<typename T>
-int BinaryTree<T>::min_depth_helper(NodePtr node) const {
+template<typename T, typename Node>
+int BinaryTree<T, Node>::min_depth_helper(NodePtr node) const {
     if (!node) return 0;
     if (!node->left && !node->right) return 1;
     
@@ -292,8 +427,8 @@ int BinaryTree<T>::min_depth_helper(NodePtr node) const {
     return 1 + std::min(left_depth, right_depth);
 }
 
-template<typename T>
-bool BinaryTree<T>::is_balanced_helper(NodePtr node, int& height) const {
+template<typename T, typename Node>
+bool BinaryTree<T, Node>::is_balanced_helper(NodePtr node, int& height) const {
     if (!node) {
         height = 0;
         return true;
@@ -308,8 +443,8 @@ bool BinaryTree<T>::is_balanced_helper(NodePtr node, int& height) const {
     return left_balanced && right_balanced && std::abs(left_height - right_height) <= 1;
 }
 
-template<typename T>
-bool BinaryTree<T>::is_symmetric_helper(NodePtr left, NodePtr right) const {
+template<typename T, typename Node>
+bool BinaryTree<T, Node>::is_symmetric_helper(NodePtr left, NodePtr right) const {
     if (!left && !right) return true;
     if (!left || !right) return false;
     
@@ -318,14 +453,14 @@ bool BinaryTree<T>::is_symmetric_helper(NodePtr left, NodePtr right) const {
            is_symmetric_helper(left->right, right->left);
 }
 
-template<typename T>
-size_t BinaryTree<T>::count_nodes_helper(NodePtr node) const {
+template<typename T, typename Node>
+size_t BinaryTree<T, Node>::count_nodes_helper(NodePtr node) const {
     if (!node) return 0;
     return 1 + count_nodes_helper(node->left) + count_nodes_helper(node->right);
 }
 
-template<typename T>
-typename BinaryTree<T>::NodePtr BinaryTree<T>::find_helper(NodePtr node, const T& value) const {
+template<typename T, typename Node>
+typename BinaryTree<T, Node>::NodePtr BinaryTree<T, Node>::find_helper(NodePtr node, const T& value) const {
     if (!node) return nullptr;
     if (node->data == value) return node;
     
@@ -335,8 +470,8 @@ typename BinaryTree<T>::NodePtr BinaryTree<T>::find_helper(NodePtr node, const T
     return find_helper(node->right, value);
 }
 
-template<typename T>
-bool BinaryTree<T>::find_path_helper(NodePtr node, const T& target, std::vector<T>& path) const {
+template<typename T, typename Node>
+bool BinaryTree<T, Node>::find_path_helper(NodePtr node, const T& target, std::vector<T>& path) const {
     if (!node) return false;
     
     path.push_back(node->data);
@@ -352,8 +487,8 @@ bool BinaryTree<T>::find_path_helper(NodePtr node, const T& target, std::vector<
     return false;
 }
 
-template<typename T>
-typename BinaryTree<T>::NodePtr BinaryTree<T>::lca_helper(NodePtr node, const T& val1, const T& val2) const {
+template<typename T, typename Node>
+typename BinaryTree<T, Node>::NodePtr BinaryTree<T, Node>::lca_helper(NodePtr node, const T& val1, const T& val2) const {
     if (!node) return nullptr;
     
     if (node->data == val1 || node->data == val2) return node;
@@ -365,8 +500,8 @@ typename BinaryTree<T>::NodePtr BinaryTree<T>::lca_helper(NodePtr node, const T&
     return left_lca ? left_lca : right_lca;
 }
 
-template<typename T>
-void BinaryTree<T>::print_tree_helper(NodePtr node, const std::string& prefix, bool is_last) const {
+template<typename T, typename Node>
+void BinaryTree<T, Node>::print_tree_helper(NodePtr node, const std::string& prefix, bool is_last) const {
     if (!node) return;
     
     std::cout << prefix << (is_last ? "└── " : "├── ") << node->data << std::endl;
@@ -381,147 +516,313 @@ void BinaryTree<T>::print_tree_helper(NodePtr node, const std::string& prefix, b
     }
 }
 
-// BinarySearchTree Implementation
+// Balance policy implementation
+
+template<typename T>
+std::shared_ptr<SearchTreeNode<T>> AvlBalance::rebalance(std::shared_ptr<SearchTreeNode<T>> node) {
+    update(*node);
+    int balance = height(node->left) - height(node->right);
+    
+    if (balance > 1) {
+        if (height(node->left->left) < height(node->left->right)) {
+            node->left = rotate_left(node->left);  // Left-right case
+        }
+        return rotate_right(node);
+    }
+    if (balance < -1) {
+        if (height(node->right->right) < height(node->right->left)) {
+            node->right = rotate_right(node->right);  // Right-left case
+        }
+        return rotate_left(node);
+    }
+    return node;
+}
+
+template<typename T>
+void AvlBalance::update(SearchTreeNode<T>& node) {
+    node.rank = static_cast<std::uint8_t>(1 + std::max(height(node.left), height(node.right)));
+}
+
+template<typename T>
+std::shared_ptr<SearchTreeNode<T>> AvlBalance::rotate_left(std::shared_ptr<SearchTreeNode<T>> node) {
+    auto new_root = node->right;
+    node->right = new_root->left;
+    new_root->left = node;
+    update(*node);
+    update(*new_root);
+    node->update_subtree_size();
+    new_root->update_subtree_size();
+    return new_root;
+}
+
+template<typename T>
+std::shared_ptr<SearchTreeNode<T>> AvlBalance::rotate_right(std::shared_ptr<SearchTreeNode<T>> node) {
+    auto new_root = node->left;
+    node->left = new_root->right;
+    new_root->right = node;
+    update(*node);
+    update(*new_root);
+    node->update_subtree_size();
+    new_root->update_subtree_size();
+    return new_root;
+}
+
+template<typename T>
+std::shared_ptr<SearchTreeNode<T>> RedBlackBalance::rebalance(std::shared_ptr<SearchTreeNode<T>> node) {
+    // After a removal below, pull this level (and a red right child) down
+    int expected = 1 + std::min(level(node->left), level(node->right));
+    if (expected < node->rank) {
+        node->rank = static_cast<std::uint8_t>(expected);
+        if (node->right && expected < node->right->rank) {
+            node->right->rank = static_cast<std::uint8_t>(expected);
+        }
+    }
+    
+    // Turn red left links into right links, then split runs of two red links
+    node = skew(node);
+    if (node->right) {
+        node->right = skew(node->right);
+        if (node->right->right) {
+            node->right->right = skew(node->right->right);
+        }
+    }
+    node = split(node);
+    if (node->right) {
+        node->right = split(node->right);
+    }
+    return node;
+}
 
 template<typename T>
-BinarySearchTree<T>::BinarySearchTree(const std::vector<T>& sorted_array) : BinaryTree<T>() {
+void RedBlackBalance::update(SearchTreeNode<T>& node) {
+    // Valid for the midpoint build, where the left half is never the larger one
+    node.rank = static_cast<std::uint8_t>(1 + std::min(level(node.left), level(node.right)));
+}
+
+template<typename T>
+std::shared_ptr<SearchTreeNode<T>> RedBlackBalance::skew(std::shared_ptr<SearchTreeNode<T>> node) {
+    if (!node->left || node->left->rank != node->rank) return node;
+    
+    auto new_root = node->left;
+    node->left = new_root->right;
+    new_root->right = node;
+    node->update_subtree_size();
+    new_root->update_subtree_size();
+    return new_root;
+}
+
+template<typename T>
+std::shared_ptr<SearchTreeNode<T>> RedBlackBalance::split(std::shared_ptr<SearchTreeNode<T>> node) {
+    if (!node->right || !node->right->right || node->right->right->rank != node->rank) return node;
+    
+    auto new_root = node->right;
+    node->right = new_root->left;
+    new_root->left = node;
+    ++new_root->rank;
+    node->update_subtree_size();
+    new_root->update_subtree_size();
+    return new_root;
+}
+
+// BinarySearchTree Implementation
+
+template<typename T, typename BalancePolicy>
+BinarySearchTree<T, BalancePolicy>::BinarySearchTree(const std::vector<T>& sorted_array) : Base() {
     if (!sorted_array.empty()) {
         root_ = build_balanced_bst(sorted_array, 0, sorted_array.size() - 1);
         size_ = sorted_array.size();
     }
 }
 
-template<typename T>
-bool BinarySearchTree<T>::insert(const T& value) {
+template<typename T, typename BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::insert(const T& value) {
     bool inserted = false;
     root_ = insert_helper(root_, value, inserted);
     if (inserted) ++size_;
     return inserted;
 }
 
-template<typename T>
-bool BinarySearchTree<T>::search(const T& value) const {
+template<typename T, typename BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::search(const T& value) const {
     return search_helper(root_, value);
 }
 
-template<typename T>
-bool BinarySearchTree<T>::remove(const T& value) {
+template<typename T, typename BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::remove(const T& value) {
     bool removed = false;
     root_ = remove_helper(root_, value, removed);
     if (removed) --size_;
     return removed;
 }
 
-template<typename T>
-T BinarySearchTree<T>::find_min() const {
+template<typename T, typename BalancePolicy>
+T BinarySearchTree<T, BalancePolicy>::find_min() const {
     if (!root_) {
         throw std::runtime_error("Tree is empty");
     }
     return find_min_node(root_)->data;
 }
 
-template<typename T>
-T BinarySearchTree<T>::find_max() const {
+template<typename T, typename BalancePolicy>
+T BinarySearchTree<T, BalancePolicy>::find_max() const {
     if (!root_) {
         throw std::runtime_error("Tree is empty");
     }
     return find_max_node(root_)->data;
 }
 
-template<typename T>
-T BinarySearchTree<T>::find_successor(const T& value) const {
-    // Implementation for finding inorder successor
-    auto inorder = this->inorder_traversal();
-    auto it = std::find(inorder.begin(), inorder.end(), value);
-    if (it == inorder.end() || std::next(it) == inorder.end()) {
-        throw std::runtime_error("No successor found");
+template<typename T, typename BalancePolicy>
+T BinarySearchTree<T, BalancePolicy>::find_successor(const T& value) const {
+    // Last node where the search turned left, unless value has a right subtree
+    NodePtr successor = nullptr;
+    NodePtr current = root_;
+    while (current) {
+        if (value < current->data) {
+            successor = current;
+            current = current->left;
+        } else if (current->data < value) {
+            current = current->right;
+        } else {
+            if (current->right) {
+                successor = find_min_node(current->right);
+            }
+            if (!successor) break;
+            return successor->data;
+        }
     }
-    return *std::next(it);
+    throw std::runtime_error("No successor found");
 }
 
-template<typename T>
-T BinarySearchTree<T>::find_predecessor(const T& value) const {
-    // Implementation for finding inorder predecessor
-    auto inorder = this->inorder_traversal();
-    auto it = std::find(inorder.begin(), inorder.end(), value);
-    if (it == inorder.end() || it == inorder.begin()) {
-        throw std::runtime_error("No predecessor found");
+template<typename T, typename BalancePolicy>
+T BinarySearchTree<T, BalancePolicy>::find_predecessor(const T& value) const {
+    // Last node where the search turned right, unless value has a left subtree
+    NodePtr predecessor = nullptr;
+    NodePtr current = root_;
+    while (current) {
+        if (value < current->data) {
+            current = current->left;
+        } else if (current->data < value) {
+            predecessor = current;
+            current = current->right;
+        } else {
+            if (current->left) {
+                predecessor = find_max_node(current->left);
+            }
+            if (!predecessor) break;
+            return predecessor->data;
+        }
     }
-    return *std::prev(it);
+    throw std::runtime_error("No predecessor found");
 }
 
-template<typename T>
-bool BinarySearchTree<T>::is_valid_bst() const {
+template<typename T, typename BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::is_valid_bst() const {
     return is_valid_bst_helper(root_, nullptr, nullptr);
 }
 
-template<typename T>
-std::vector<T> BinarySearchTree<T>::to_sorted_array() const {
+template<typename T, typename BalancePolicy>
+std::vector<T> BinarySearchTree<T, BalancePolicy>::to_sorted_array() const {
     return this->inorder_traversal();
 }
 
-template<typename T>
-T BinarySearchTree<T>::kth_smallest(int k) const {
+template<typename T, typename BalancePolicy>
+StaticSearchTree<T> BinarySearchTree<T, BalancePolicy>::freeze() const {
+    return StaticSearchTree<T>(this->inorder_traversal());
+}
+
+template<typename T, typename BalancePolicy>
+T BinarySearchTree<T, BalancePolicy>::kth_smallest(int k) const {
     if (k <= 0 || k > static_cast<int>(size_)) {
         throw std::out_of_range("k is out of range");
     }
     
-    T result;
-    kth_smallest_helper(root_, k, result);
-    return result;
+    NodePtr node = select_node(static_cast<size_t>(k) - 1);
+    if (!node) {
+        throw std::logic_error("Subtree sizes are stale (nodes relinked by hand)");
+    }
+    return node->data;
 }
 
-template<typename T>
-T BinarySearchTree<T>::kth_largest(int k) const {
+template<typename T, typename BalancePolicy>
+T BinarySearchTree<T, BalancePolicy>::kth_largest(int k) const {
     if (k <= 0 || k > static_cast<int>(size_)) {
         throw std::out_of_range("k is out of range");
     }
     
-    T result;
-    kth_largest_helper(root_, k, result);
-    return result;
+    NodePtr node = select_node(size_ - static_cast<size_t>(k));
+    if (!node) {
+        throw std::logic_error("Subtree sizes are stale (nodes relinked by hand)");
+    }
+    return node->data;
 }
 
-template<typename T>
-int BinarySearchTree<T>::balance_factor(NodePtr node) const {
+template<typename T, typename BalancePolicy>
+size_t BinarySearchTree<T, BalancePolicy>::rank(const T& value) const {
+    size_t smaller = 0;
+    NodePtr current = root_;
+    while (current) {
+        if (current->data < value) {
+            smaller += 1 + (current->left ? current->left->subtree_size : 0);
+            current = current->right;
+        } else {
+            current = current->left;
+        }
+    }
+    return smaller;
+}
+
+template<typename T, typename BalancePolicy>
+size_t BinarySearchTree<T, BalancePolicy>::count_in_range(const T& lo, const T& hi) const {
+    if (hi < lo) return 0;
+    return count_not_greater(hi) - rank(lo);
+}
+
+template<typename T, typename BalancePolicy>
+int BinarySearchTree<T, BalancePolicy>::balance_factor(NodePtr node) const {
     if (!node) return 0;
     return this->height_helper(node->left) - this->height_helper(node->right);
 }
 
-template<typename T>
-bool BinarySearchTree<T>::needs_rebalancing() const {
+template<typename T, typename BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::needs_rebalancing() const {
     return needs_rebalancing_helper(root_);
 }
 
-template<typename T>
-typename BinarySearchTree<T>::NodePtr BinarySearchTree<T>::rotate_right(NodePtr node) {
+template<typename T, typename BalancePolicy>
+template<typename Policy, typename>
+typename BinarySearchTree<T, BalancePolicy>::NodePtr BinarySearchTree<T, BalancePolicy>::rotate_right(NodePtr node) {
     if (!node || !node->left) return node;
     
     NodePtr new_root = node->left;
     node->left = new_root->right;
     new_root->right = node;
+    node->update_subtree_size();
+    new_root->update_subtree_size();
     
     return new_root;
 }
 
-template<typename T>
-typename BinarySearchTree<T>::NodePtr BinarySearchTree<T>::rotate_left(NodePtr node) {
+template<typename T, typename BalancePolicy>
+template<typename Policy, typename>
+typename BinarySearchTree<T, BalancePolicy>::NodePtr BinarySearchTree<T, BalancePolicy>::rotate_left(NodePtr node) {
     if (!node || !node->right) return node;
     
     NodePtr new_root = node->right;
     node->right = new_root->left;
     new_root->left = node;
+    node->update_subtree_size();
+    new_root->update_subtree_size();
     
     return new_root;
 }
 
 // BST Helper methods implementation
 
-template<typename T>
-typename BinarySearchTree<T>::NodePtr BinarySearchTree<T>::insert_helper(NodePtr node, const T& value, bool& inserted) {
+template<typename T, typename BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::NodePtr BinarySearchTree<T, BalancePolicy>::insert_helper(NodePtr node, const T& value, bool& inserted) {
     if (!node) {
         inserted = true;
-        return std::make_shared<TreeNode<T>>(value);
+        return std::make_shared<SearchTreeNode<T>>(value);
     }
     
     if (value < node->data) {
@@ -531,11 +832,12 @@ typename BinarySearchTree<T>::NodePtr BinarySearchTree<T>::insert_helper(NodePtr
     }
     // If value == node->data, don't insert (no duplicates)
     
-    return node;
+    node->update_subtree_size();
+    return BalancePolicy::rebalance(node);
 }
 
-template<typename T>
-bool BinarySearchTree<T>::search_helper(NodePtr node, const T& value) const {
+template<typename T, typename BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::search_helper(NodePtr node, const T& value) const {
     if (!node) return false;
     
     if (value == node->data) return true;
@@ -543,8 +845,8 @@ bool BinarySearchTree<T>::search_helper(NodePtr node, const T& value) const {
     else return search_helper(node->right, value);
 }
 
-template<typename T>
-typename BinarySearchTree<T>::NodePtr BinarySearchTree<T>::remove_helper(NodePtr node, const T& value, bool& removed) {
+template<typename T, typename BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::NodePtr BinarySearchTree<T, BalancePolicy>::remove_helper(NodePtr node, const T& value, bool& removed) {
     if (!node) return nullptr;
     
     if (value < node->data) {
@@ -573,27 +875,28 @@ typename BinarySearchTree<T>::NodePtr BinarySearchTree<T>::remove_helper(NodePtr
         }
     }
     
-    return node;
+    node->update_subtree_size();
+    return BalancePolicy::rebalance(node);
 }
 
-template<typename T>
-typename BinarySearchTree<T>::NodePtr BinarySearchTree<T>::find_min_node(NodePtr node) const {
+template<typename T, typename BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::NodePtr BinarySearchTree<T, BalancePolicy>::find_min_node(NodePtr node) const {
     while (node && node->left) {
         node = node->left;
     }
     return node;
 }
 
-template<typename T>
-typename BinarySearchTree<T>::NodePtr BinarySearchTree<T>::find_max_node(NodePtr node) const {
+template<typename T, typename BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::NodePtr BinarySearchTree<T, BalancePolicy>::find_max_node(NodePtr node) const {
     while (node && node->right) {
         node = node->right;
     }
     return node;
 }
 
-template<typename T>
-bool BinarySearchTree<T>::is_valid_bst_helper(NodePtr node, const T* min_val, const T* max_val) const {
+template<typename T, typename BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::is_valid_bst_helper(NodePtr node, const T* min_val, const T* max_val) const {
     if (!node) return true;
     
     if ((min_val && node->data <= *min_val) || (max_val && node->data >= *max_val)) {
@@ -604,38 +907,41 @@ bool BinarySearchTree<T>::is_valid_bst_helper(NodePtr node, const T* min_val, co
            is_valid_bst_helper(node->right, &node->data, max_val);
 }
 
-template<typename T>
-bool BinarySearchTree<T>::kth_smallest_helper(NodePtr node, int& k, T& result) const {
-    if (!node) return false;
-    
-    if (kth_smallest_helper(node->left, k, result)) return true;
-    
-    --k;
-    if (k == 0) {
-        result = node->data;
-        return true;
+template<typename T, typename BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::NodePtr BinarySearchTree<T, BalancePolicy>::select_node(size_t index) const {
+    // index is 0-based and already checked against size_
+    NodePtr current = root_;
+    while (current) {
+        size_t left_size = current->left ? current->left->subtree_size : 0;
+        if (index < left_size) {
+            current = current->left;
+        } else if (index == left_size) {
+            return current;
+        } else {
+            index -= left_size + 1;
+            current = current->right;
+        }
     }
-    
-    return kth_smallest_helper(node->right, k, result);
+    return nullptr;
 }
 
-template<typename T>
-bool BinarySearchTree<T>::kth_largest_helper(NodePtr node, int& k, T& result) const {
-    if (!node) return false;
-    
-    if (kth_largest_helper(node->right, k, result)) return true;
-    
-    --k;
-    if (k == 0) {
-        result = node->data;
-        return true;
+template<typename T, typename BalancePolicy>
+size_t BinarySearchTree<T, BalancePolicy>::count_not_greater(const T& value) const {
+    size_t count = 0;
+    NodePtr current = root_;
+    while (current) {
+        if (value < current->data) {
+            current = current->left;
+        } else {
+            count += 1 + (current->left ? current->left->subtree_size : 0);
+            current = current->right;
+        }
     }
-    
-    return kth_largest_helper(node->left, k, result);
+    return count;
 }
 
-template<typename T>
-bool BinarySearchTree<T>::needs_rebalancing_helper(NodePtr node) const {
+template<typename T, typename BalancePolicy>
+bool BinarySearchTree<T, BalancePolicy>::needs_rebalancing_helper(NodePtr node) const {
     if (!node) return false;
     
     int bf = balance_factor(node);
@@ -644,25 +950,27 @@ bool BinarySearchTree<T>::needs_rebalancing_helper(NodePtr node) const {
     return needs_rebalancing_helper(node->left) || needs_rebalancing_helper(node->right);
 }
 
-template<typename T>
-typename BinarySearchTree<T>::NodePtr BinarySearchTree<T>::build_balanced_bst(const std::vector<T>& sorted_array, int start, int end) {
+template<typename T, typename BalancePolicy>
+typename BinarySearchTree<T, BalancePolicy>::NodePtr BinarySearchTree<T, BalancePolicy>::build_balanced_bst(const std::vector<T>& sorted_array, int start, int end) {
     if (start > end) return nullptr;
     
     int mid = start + (end - start) / 2;
-    auto node = std::make_shared<TreeNode<T>>(sorted_array[mid]);
+    auto node = std::make_shared<SearchTreeNode<T>>(sorted_array[mid]);
     
     node->left = build_balanced_bst(sorted_array, start, mid - 1);
     node->right = build_balanced_bst(sorted_array, mid + 1, end);
+    node->update_subtree_size();
+    BalancePolicy::update(*node);
     
     return node;
 }
 
 // Standalone utility functions implementation
 
-template<typename T>
-bool are_identical(const BinaryTree<T>& tree1, const BinaryTree<T>& tree2) {
-    std::function<bool(typename BinaryTree<T>::NodePtr, typename BinaryTree<T>::NodePtr)> 
-        compare = [&](typename BinaryTree<T>::NodePtr node1, typename BinaryTree<T>::NodePtr node2) -> bool {
+template<typename T, typename Node1, typename Node2>
+bool are_identical(const BinaryTree<T, Node1>& tree1, const BinaryTree<T, Node2>& tree2) {
+    std::function<bool(typename BinaryTree<T, Node1>::NodePtr, typename BinaryTree<T, Node2>::NodePtr)> 
+        compare = [&](typename BinaryTree<T, Node1>::NodePtr node1, typename BinaryTree<T, Node2>::NodePtr node2) -> bool {
         if (!node1 && !node2) return true;
         if (!node1 || !node2) return false;
         
@@ -674,11 +982,11 @@ bool are_identical(const BinaryTree<T>& tree1, const BinaryTree<T>& tree2) {
     return compare(tree1.get_root(), tree2.get_root());
 }
 
-template<typename T>
-std::string serialize_tree(const BinaryTree<T>& tree, const std::string& null_marker) {
+template<typename T, typename Node>
+std::string serialize_tree(const BinaryTree<T, Node>& tree, const std::string& null_marker) {
     std::ostringstream oss;
-    std::function<void(typename BinaryTree<T>::NodePtr)> serialize = 
-        [&](typename BinaryTree<T>::NodePtr node) {
+    std::function<void(typename BinaryTree<T, Node>::NodePtr)> serialize = 
+        [&](typename BinaryTree<T, Node>::NodePtr node) {
         if (!node) {
             oss << null_marker << ",";
             return;
@@ -735,12 +1043,12 @@ BinaryTree<T> deserialize_tree(const std::string& data, const std::string& null_
     return tree;
 }
 
-template<typename T>
-int tree_diameter(const BinaryTree<T>& tree) {
+template<typename T, typename Node>
+int tree_diameter(const BinaryTree<T, Node>& tree) {
     int diameter = 0;
     
-    std::function<int(typename BinaryTree<T>::NodePtr)> height = 
-        [&](typename BinaryTree<T>::NodePtr node) -> int {
+    std::function<int(typename BinaryTree<T, Node>::NodePtr)> height = 
+        [&](typename BinaryTree<T, Node>::NodePtr node) -> int {
         if (!node) return 0;
         
         int left_height = height(node->left);
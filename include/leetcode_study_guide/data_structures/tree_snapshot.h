@@ -0,0 +1,148 @@
+/**
+ * @file tree_snapshot.h
+ * @brief Compact binary snapshot of a BinaryTree, loadable with mmap
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_TREE_SNAPSHOT_H
+#define LEETCODE_STUDY_GUIDE_TREE_SNAPSHOT_H
+
+#include "../common.h"
+#include "mapped_file.h"
+#include "tree.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Binary replacement for the text serialize_tree/deserialize_tree format
+ *
+ * Nodes are numbered in preorder. The shape takes 2 bits per node (has
+ * left child, has right child), which determines the tree uniquely, and
+ * the values follow as one contiguous array: raw values for trivially
+ * copyable types, or an offset table plus concatenated bytes for
+ * std::string. Like FrozenTrie, the in-memory layout is exactly the file
+ * layout: save() writes one buffer, and load() maps the file and reads
+ * shape bits and values in place without any parsing. to_tree() rebuilds
+ * a BinaryTree in one sequential pass. Files use the host byte order.
+ */
+template<typename T>
+class TreeSnapshot {
+public:
+    /**
+     * @brief Create a snapshot of an empty tree
+     */
+    TreeSnapshot();
+
+    /**
+     * @brief Encode a tree
+     * @param tree Source tree
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    template<typename Node>
+    explicit TreeSnapshot(const BinaryTree<T, Node>& tree);
+
+    /**
+     * @brief Map a file written by save()
+     * @param path File path
+     * @return Snapshot reading directly from the mapping
+     * @throws std::runtime_error if the file is missing or malformed
+     * Time Complexity: O(1)
+     */
+    static TreeSnapshot load(const std::string& path);
+
+    /**
+     * @brief View a buffer holding the save() format without copying
+     * @param data Start of the buffer (8-byte aligned, must outlive the result)
+     * @param size Buffer size in bytes
+     * @return Snapshot reading directly from the buffer
+     * @throws std::runtime_error if the buffer is malformed
+     */
+    static TreeSnapshot from_buffer(const void* data, size_t size);
+
+    /**
+     * @brief Write the snapshot to a file
+     * @param path Destination path
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief Rebuild the tree
+     * @return Tree with the same shape and values
+     * @throws std::runtime_error if the shape bits are inconsistent
+     * Time Complexity: O(n)
+     * Space Complexity: O(n)
+     */
+    BinaryTree<T> to_tree() const;
+
+    /**
+     * @brief Get the value of a node
+     * @param index Preorder index
+     * @return Node value
+     */
+    T value(size_t index) const;
+
+    /**
+     * @brief Check whether a node has a left child
+     * @param index Preorder index
+     * @return True if the left child exists (it is node index + 1)
+     */
+    bool has_left(size_t index) const { return bit(2 * index); }
+
+    /**
+     * @brief Check whether a node has a right child
+     * @param index Preorder index
+     * @return True if the right child exists
+     */
+    bool has_right(size_t index) const { return bit(2 * index + 1); }
+
+    /**
+     * @brief Get number of nodes
+     * @return Node count
+     */
+    size_t size() const { return static_cast<size_t>(node_count_); }
+
+    /**
+     * @brief Check if the snapshot holds an empty tree
+     * @return True if empty
+     */
+    bool empty() const { return node_count_ == 0; }
+
+    /**
+     * @brief Get size of the encoded representation
+     * @return Number of bytes (equal to the file size)
+     */
+    size_t memory_usage() const { return bytes_; }
+
+private:
+    struct Header {
+        char magic[8];
+        uint64_t node_count;
+        uint64_t value_size;   // sizeof(T), or 0 for std::string
+        uint64_t value_words;  // Length of the value section in 64-bit words
+    };
+
+    std::shared_ptr<const void> storage_;  // Keeps owned buffer or mapping alive
+    size_t bytes_;
+    uint64_t node_count_;
+    const uint64_t* shape_;           // 2 bits per node in preorder
+    const unsigned char* values_;     // Packed values, or string bytes
+    const uint64_t* offsets_;         // String start offsets (node_count + 1), else null
+
+    static uint64_t value_size();
+    bool bit(uint64_t pos) const { return (shape_[pos / 64] >> (pos % 64)) & 1; }
+    void attach(std::shared_ptr<const void> storage, const void* data, size_t size);
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "tree_snapshot.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_TREE_SNAPSHOT_H
@@ -0,0 +1,238 @@
+/**
+ * @file tree_snapshot.tpp
+ * @brief Template implementation for TreeSnapshot
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_TREE_SNAPSHOT_TPP
+#define LEETCODE_STUDY_GUIDE_TREE_SNAPSHOT_TPP
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// TreeSnapshot Implementation
+
+namespace tree_snapshot_detail {
+
+const char kMagic[8] = {'L', 'S', 'G', 'B', 'T', 'R', 'E', '1'};
+
+inline uint64_t words_for_bytes(uint64_t bytes) {
+    return (bytes + 7) / 8;
+}
+
+} // namespace tree_snapshot_detail
+
+template<typename T>
+uint64_t TreeSnapshot<T>::value_size() {
+    if constexpr (std::is_same<T, std::string>::value) {
+        return 0;
+    } else {
+        static_assert(std::is_trivially_copyable<T>::value && alignof(T) <= alignof(uint64_t),
+                      "TreeSnapshot stores trivially copyable values or std::string");
+        return sizeof(T);
+    }
+}
+
+template<typename T>
+TreeSnapshot<T>::TreeSnapshot() : TreeSnapshot(BinaryTree<T>()) {}
+
+template<typename T>
+template<typename Node>
+TreeSnapshot<T>::TreeSnapshot(const BinaryTree<T, Node>& tree) {
+    using tree_snapshot_detail::words_for_bytes;
+
+    // Preorder walk collecting shape bits and values
+    std::vector<uint64_t> shape;
+    std::vector<const Node*> order;
+    uint64_t value_bytes = 0;
+    std::vector<const Node*> stack;
+    if (tree.get_root()) stack.push_back(tree.get_root().get());
+    while (!stack.empty()) {
+        const Node* node = stack.back();
+        stack.pop_back();
+
+        uint64_t pos = 2 * order.size();
+        if (pos % 64 == 0) shape.push_back(0);
+        shape.back() |= (uint64_t(node->left != nullptr) | uint64_t(node->right != nullptr) << 1) << (pos % 64);
+        order.push_back(node);
+        if constexpr (std::is_same<T, std::string>::value) {
+            value_bytes += node->data.size();
+        }
+
+        if (node->right) stack.push_back(node->right.get());
+        if (node->left) stack.push_back(node->left.get());
+    }
+
+    uint64_t n = order.size();
+    uint64_t value_words;
+    if constexpr (std::is_same<T, std::string>::value) {
+        value_words = (n + 1) + words_for_bytes(value_bytes);
+    } else {
+        value_words = words_for_bytes(n * value_size());
+    }
+
+    uint64_t header_words = sizeof(Header) / sizeof(uint64_t);
+    auto buffer = std::make_shared<std::vector<uint64_t>>(header_words + shape.size() + value_words, 0);
+    uint64_t* words = buffer->data();
+
+    Header header;
+    std::memcpy(header.magic, tree_snapshot_detail::kMagic, sizeof(header.magic));
+    header.node_count = n;
+    header.value_size = value_size();
+    header.value_words = value_words;
+    std::memcpy(words, &header, sizeof(header));
+    if (!shape.empty()) {
+        std::memcpy(words + header_words, shape.data(), shape.size() * sizeof(uint64_t));
+    }
+
+    unsigned char* values = reinterpret_cast<unsigned char*>(words + header_words + shape.size());
+    if constexpr (std::is_same<T, std::string>::value) {
+        uint64_t* offsets = reinterpret_cast<uint64_t*>(values);
+        unsigned char* bytes = values + (n + 1) * sizeof(uint64_t);
+        uint64_t offset = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            offsets[i] = offset;
+            std::memcpy(bytes + offset, order[i]->data.data(), order[i]->data.size());
+            offset += order[i]->data.size();
+        }
+        offsets[n] = offset;
+    } else {
+        for (uint64_t i = 0; i < n; ++i) {
+            std::memcpy(values + i * sizeof(T), &order[i]->data, sizeof(T));
+        }
+    }
+
+    const void* data = buffer->data();
+    size_t size = buffer->size() * sizeof(uint64_t);
+    attach(std::shared_ptr<const void>(buffer, data), data, size);
+}
+
+template<typename T>
+TreeSnapshot<T> TreeSnapshot<T>::load(const std::string& path) {
+    auto mapping = std::make_shared<MappedFile>(path);
+    TreeSnapshot snapshot;
+    snapshot.attach(std::shared_ptr<const void>(mapping, mapping->data()), mapping->data(), mapping->size());
+    return snapshot;
+}
+
+template<typename T>
+TreeSnapshot<T> TreeSnapshot<T>::from_buffer(const void* data, size_t size) {
+    TreeSnapshot snapshot;
+    snapshot.attach(nullptr, data, size);
+    return snapshot;
+}
+
+template<typename T>
+void TreeSnapshot<T>::save(const std::string& path) const {
+    MappedFile::write(path, storage_.get(), bytes_);
+}
+
+template<typename T>
+BinaryTree<T> TreeSnapshot<T>::to_tree() const {
+    BinaryTree<T> tree;
+    if (node_count_ == 0) return tree;
+
+    // Preorder rebuild: each node fills the most recently opened child slot
+    using NodePtr = typename BinaryTree<T>::NodePtr;
+    std::vector<std::pair<NodePtr, bool>> slots;  // (parent, is_left)
+    tree.set_root(value(0));
+    NodePtr node = tree.get_root();
+    for (uint64_t i = 0;;) {
+        if (has_right(i)) slots.emplace_back(node, false);
+        if (has_left(i)) slots.emplace_back(node, true);
+        if (++i == node_count_) break;
+        if (slots.empty()) {
+            throw std::runtime_error("Malformed tree snapshot");
+        }
+
+        NodePtr parent = std::move(slots.back().first);
+        bool is_left = slots.back().second;
+        slots.pop_back();
+        node = is_left ? tree.insert_left(parent, value(i)) : tree.insert_right(parent, value(i));
+    }
+    if (!slots.empty()) {
+        throw std::runtime_error("Malformed tree snapshot");
+    }
+    return tree;
+}
+
+template<typename T>
+T TreeSnapshot<T>::value(size_t index) const {
+    if constexpr (std::is_same<T, std::string>::value) {
+        return std::string(reinterpret_cast<const char*>(values_) + offsets_[index],
+                           offsets_[index + 1] - offsets_[index]);
+    } else {
+        T result;
+        std::memcpy(&result, values_ + index * sizeof(T), sizeof(T));
+        return result;
+    }
+}
+
+// TreeSnapshot Helper Methods
+
+template<typename T>
+void TreeSnapshot<T>::attach(std::shared_ptr<const void> storage, const void* data, size_t size) {
+    using tree_snapshot_detail::words_for_bytes;
+
+    if (size < sizeof(Header) || reinterpret_cast<uintptr_t>(data) % alignof(uint64_t) != 0) {
+        throw std::runtime_error("Invalid tree snapshot buffer");
+    }
+
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, tree_snapshot_detail::kMagic, sizeof(header.magic)) != 0 ||
+        header.value_size != value_size()) {
+        throw std::runtime_error("Invalid tree snapshot header");
+    }
+
+    uint64_t header_words = sizeof(Header) / sizeof(uint64_t);
+    uint64_t available = size / sizeof(uint64_t) - header_words;
+    uint64_t shape_words = header.node_count > available * 32 ? 0 : (2 * header.node_count + 63) / 64;
+    if (header.node_count > available * 32 || shape_words > available || header.value_words > available - shape_words) {
+        throw std::runtime_error("Truncated tree snapshot buffer");
+    }
+
+    const uint64_t* words = static_cast<const uint64_t*>(data);
+    const uint64_t* value_section = words + header_words + shape_words;
+    const uint64_t* offsets = nullptr;
+    const unsigned char* values = reinterpret_cast<const unsigned char*>(value_section);
+    if constexpr (std::is_same<T, std::string>::value) {
+        // Offsets must be monotone and end inside the byte section
+        uint64_t n = header.node_count;
+        if (header.value_words < n + 1) {
+            throw std::runtime_error("Truncated tree snapshot buffer");
+        }
+        offsets = value_section;
+        values = reinterpret_cast<const unsigned char*>(value_section + n + 1);
+        uint64_t byte_limit = (header.value_words - (n + 1)) * sizeof(uint64_t);
+        if (offsets[0] != 0 || offsets[n] > byte_limit) {
+            throw std::runtime_error("Invalid tree snapshot values");
+        }
+        for (uint64_t i = 0; i < n; ++i) {
+            if (offsets[i] > offsets[i + 1]) {
+                throw std::runtime_error("Invalid tree snapshot values");
+            }
+        }
+    } else if (header.value_words < words_for_bytes(header.node_count * sizeof(T))) {
+        throw std::runtime_error("Truncated tree snapshot buffer");
+    }
+
+    storage_ = storage ? std::move(storage) : std::shared_ptr<const void>(std::shared_ptr<void>(), data);
+    bytes_ = (header_words + shape_words + header.value_words) * sizeof(uint64_t);
+    node_count_ = header.node_count;
+    shape_ = words + header_words;
+    values_ = values;
+    offsets_ = offsets;
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_TREE_SNAPSHOT_TPP
@@ -0,0 +1,331 @@
+/**
+ * @file unrolled_linked_list.h
+ * @brief Unrolled linked list storing several elements per pooled chunk
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_UNROLLED_LINKED_LIST_H
+#define LEETCODE_STUDY_GUIDE_UNROLLED_LINKED_LIST_H
+
+#include "../common.h"
+#include "node_pool.h"
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Sequence list with the SinglyLinkedList/DoublyLinkedList API
+ *
+ * Instead of one shared_ptr node per element, elements are packed into
+ * chunks of about kChunkBytes (four cache lines) that are doubly linked
+ * through raw pointers and allocated from a NodePool. A traversal walks
+ * contiguous arrays and follows one pointer per chunk, with no reference
+ * counting and no per-element allocation. An insert into a full chunk
+ * splits it in half, and an erase that leaves a chunk less than half full
+ * merges it with its successor when both fit, so chunks stay at least
+ * half full on average. clear() and the destructor never recurse.
+ *
+ * Iterators and element references are invalidated by any insertion or
+ * removal.
+ */
+template<typename T>
+class UnrolledLinkedList {
+private:
+    struct Chunk;
+
+    template<bool Const>
+    class BasicIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<Const, const T*, T*>::type;
+        using reference = typename std::conditional<Const, const T&, T&>::type;
+        using ChunkPtr = typename std::conditional<Const, const Chunk*, Chunk*>::type;
+
+        BasicIterator() : chunk_(nullptr), index_(0) {}
+        BasicIterator(ChunkPtr chunk, uint32_t index) : chunk_(chunk), index_(index) {}
+
+        // Mutable iterators convert to const ones
+        template<bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) : chunk_(other.chunk_), index_(other.index_) {}
+
+        reference operator*() const { return chunk_->items()[index_]; }
+        pointer operator->() const { return chunk_->items() + index_; }
+
+        BasicIterator& operator++() {
+            if (++index_ == chunk_->count) {
+                chunk_ = chunk_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) {
+            BasicIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const BasicIterator& other) const {
+            return chunk_ == other.chunk_ && index_ == other.index_;
+        }
+        bool operator!=(const BasicIterator& other) const { return !(*this == other); }
+
+    private:
+        template<bool> friend class BasicIterator;
+
+        ChunkPtr chunk_;
+        uint32_t index_;
+    };
+
+public:
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+
+    /// Target size of one chunk in bytes, header included
+    static constexpr size_t kChunkBytes = 256;
+
+    /// Elements per chunk (at least 4 for large element types)
+    static constexpr size_t kChunkCapacity =
+        (kChunkBytes - 2 * sizeof(void*) - sizeof(uint32_t)) / sizeof(T) >= 4
+            ? (kChunkBytes - 2 * sizeof(void*) - sizeof(uint32_t)) / sizeof(T)
+            : 4;
+
+    /**
+     * @brief Default constructor
+     */
+    UnrolledLinkedList() : head_(nullptr), tail_(nullptr), size_(0) {}
+
+    /**
+     * @brief Constructor with initializer list
+     * @param init_list Initializer list of values
+     */
+    UnrolledLinkedList(std::initializer_list<T> init_list);
+
+    /**
+     * @brief Constructor from vector
+     * @param values Vector of values to create list from
+     */
+    UnrolledLinkedList(const std::vector<T>& values);
+
+    /**
+     * @brief Copy constructor (the copy is compacted into full chunks)
+     * @param other List to copy
+     */
+    UnrolledLinkedList(const UnrolledLinkedList& other);
+
+    /**
+     * @brief Move constructor (elements keep their addresses)
+     * @param other List to move from; left empty
+     */
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept;
+
+    /**
+     * @brief Copy assignment
+     * @param other List to copy
+     * @return Reference to this list
+     */
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other);
+
+    /**
+     * @brief Move assignment
+     * @param other List to move from; left empty
+     * @return Reference to this list
+     */
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept;
+
+    /**
+     * @brief Destructor
+     */
+    ~UnrolledLinkedList() { clear(); }
+
+    // Basic Operations
+
+    /**
+     * @brief Insert element at the beginning
+     * @param value Value to insert
+     * Time Complexity: O(kChunkCapacity)
+     * Space Complexity: O(1) amortized
+     */
+    void push_front(const T& value);
+
+    /**
+     * @brief Insert element at the end
+     * @param value Value to insert
+     * Time Complexity: O(1)
+     * Space Complexity: O(1) amortized
+     */
+    void push_back(const T& value);
+
+    /**
+     * @brief Insert element at specific position
+     * @param position Position to insert at (0-indexed)
+     * @param value Value to insert
+     * @throws std::out_of_range if position > size()
+     * Time Complexity: O(n / kChunkCapacity + kChunkCapacity)
+     * Space Complexity: O(1) amortized
+     */
+    void insert(size_t position, const T& value);
+
+    /**
+     * @brief Remove element from the beginning
+     * @throws std::runtime_error if the list is empty
+     * Time Complexity: O(kChunkCapacity)
+     * Space Complexity: O(1)
+     */
+    void pop_front();
+
+    /**
+     * @brief Remove element from the end
+     * @throws std::runtime_error if the list is empty
+     * Time Complexity: O(1), O(kChunkCapacity) when chunks merge
+     * Space Complexity: O(1)
+     */
+    void pop_back();
+
+    /**
+     * @brief Remove element at specific position
+     * @param position Position to remove from (0-indexed)
+     * @throws std::out_of_range if position >= size()
+     * Time Complexity: O(n / kChunkCapacity + kChunkCapacity)
+     * Space Complexity: O(1)
+     */
+    void erase(size_t position);
+
+    /**
+     * @brief Remove all occurrences of a value
+     * @param value Value to remove
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
+     */
+    void remove(const T& value);
+
+    // Search and Access Operations
+
+    /**
+     * @brief Search for element
+     * @param value Value to search for
+     * @return Position of first occurrence, or -1 if not found
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
+     */
+    int find(const T& value) const;
+
+    /**
+     * @brief Get element at specific position
+     * @param position Position to get element from
+     * @return Reference to element at position
+     * @throws std::out_of_range if position >= size()
+     * Time Complexity: O(n / kChunkCapacity), walking from the nearer end
+     * Space Complexity: O(1)
+     */
+    T& at(size_t position);
+    const T& at(size_t position) const;
+
+    /**
+     * @brief Get first element
+     * @return Reference to the first element
+     * @throws std::runtime_error if the list is empty
+     */
+    const T& front() const;
+
+    /**
+     * @brief Get last element
+     * @return Reference to the last element
+     * @throws std::runtime_error if the list is empty
+     */
+    const T& back() const;
+
+    // Advanced Operations
+
+    /**
+     * @brief Reverse the list in place
+     * Time Complexity: O(n)
+     * Space Complexity: O(1)
+     */
+    void reverse();
+
+    // Iteration
+
+    iterator begin() { return iterator(head_, 0); }
+    iterator end() { return iterator(); }
+    const_iterator begin() const { return const_iterator(head_, 0); }
+    const_iterator end() const { return const_iterator(); }
+
+    // Utility Methods
+
+    /**
+     * @brief Get current size of list
+     * @return Number of elements in list
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Check if list is empty
+     * @return True if list is empty, false otherwise
+     */
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * @brief Get number of chunks in use
+     * @return Chunk count
+     */
+    size_t chunk_count() const { return pool_.size(); }
+
+    /**
+     * @brief Clear all elements from list
+     * Time Complexity: O(number of chunks) for trivially destructible T, O(n) otherwise
+     */
+    void clear();
+
+    /**
+     * @brief Convert to vector
+     * @return Vector containing all elements
+     */
+    std::vector<T> to_vector() const;
+
+    /**
+     * @brief Print list for debugging
+     */
+    void print() const;
+
+private:
+    struct Chunk {
+        Chunk* prev;
+        Chunk* next;
+        uint32_t count;
+        alignas(T) unsigned char storage[kChunkCapacity * sizeof(T)];
+
+        Chunk() : prev(nullptr), next(nullptr), count(0) {}
+        T* items() { return reinterpret_cast<T*>(storage); }
+        const T* items() const { return reinterpret_cast<const T*>(storage); }
+    };
+
+    NodePool<Chunk> pool_;
+    Chunk* head_;
+    Chunk* tail_;
+    size_t size_;
+
+    // Helper methods
+    Chunk* new_chunk_after(Chunk* chunk);
+    void free_chunk(Chunk* chunk);
+    Chunk* locate(size_t& position) const;
+    void insert_into(Chunk* chunk, uint32_t index, T&& item);
+    void erase_from(Chunk* chunk, uint32_t index);
+    void split(Chunk* chunk);
+    void merge_next(Chunk* chunk);
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#include "unrolled_linked_list.tpp"
+
+#endif // LEETCODE_STUDY_GUIDE_UNROLLED_LINKED_LIST_H
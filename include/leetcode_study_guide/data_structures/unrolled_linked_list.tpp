@@ -0,0 +1,407 @@
+/**
+ * @file unrolled_linked_list.tpp
+ * @brief Template implementation for UnrolledLinkedList
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_UNROLLED_LINKED_LIST_TPP
+#define LEETCODE_STUDY_GUIDE_UNROLLED_LINKED_LIST_TPP
+
+#include <algorithm>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// UnrolledLinkedList Implementation
+
+template<typename T>
+UnrolledLinkedList<T>::UnrolledLinkedList(std::initializer_list<T> init_list)
+    : head_(nullptr), tail_(nullptr), size_(0) {
+    for (const auto& value : init_list) {
+        push_back(value);
+    }
+}
+
+template<typename T>
+UnrolledLinkedList<T>::UnrolledLinkedList(const std::vector<T>& values)
+    : head_(nullptr), tail_(nullptr), size_(0) {
+    for (const auto& value : values) {
+        push_back(value);
+    }
+}
+
+template<typename T>
+UnrolledLinkedList<T>::UnrolledLinkedList(const UnrolledLinkedList& other)
+    : head_(nullptr), tail_(nullptr), size_(0) {
+    for (const auto& value : other) {
+        push_back(value);
+    }
+}
+
+template<typename T>
+UnrolledLinkedList<T>::UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+    : pool_(std::move(other.pool_)), head_(other.head_), tail_(other.tail_), size_(other.size_) {
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0;
+}
+
+template<typename T>
+UnrolledLinkedList<T>& UnrolledLinkedList<T>::operator=(const UnrolledLinkedList& other) {
+    if (this != &other) {
+        UnrolledLinkedList copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template<typename T>
+UnrolledLinkedList<T>& UnrolledLinkedList<T>::operator=(UnrolledLinkedList&& other) noexcept {
+    if (this != &other) {
+        clear();
+        pool_ = std::move(other.pool_);
+        head_ = other.head_;
+        tail_ = other.tail_;
+        size_ = other.size_;
+        other.head_ = nullptr;
+        other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::push_front(const T& value) {
+    T item(value);
+    if (!head_ || head_->count == kChunkCapacity) {
+        new_chunk_after(nullptr);
+    }
+    insert_into(head_, 0, std::move(item));
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::push_back(const T& value) {
+    if (!tail_ || tail_->count == kChunkCapacity) {
+        T item(value);  // value may live in the chunk being filled up
+        new_chunk_after(tail_);
+        ::new (static_cast<void*>(tail_->items())) T(std::move(item));
+    } else {
+        ::new (static_cast<void*>(tail_->items() + tail_->count)) T(value);
+    }
+    ++tail_->count;
+    ++size_;
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::insert(size_t position, const T& value) {
+    if (position > size_) {
+        throw std::out_of_range("Position out of range");
+    }
+    if (position == size_) {
+        push_back(value);
+        return;
+    }
+
+    T item(value);
+    Chunk* chunk = locate(position);
+    insert_into(chunk, static_cast<uint32_t>(position), std::move(item));
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::pop_front() {
+    if (!head_) {
+        throw std::runtime_error("Cannot pop from empty list");
+    }
+    erase_from(head_, 0);
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::pop_back() {
+    if (!tail_) {
+        throw std::runtime_error("Cannot pop from empty list");
+    }
+    erase_from(tail_, tail_->count - 1);
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::erase(size_t position) {
+    if (position >= size_) {
+        throw std::out_of_range("Position out of range");
+    }
+    Chunk* chunk = locate(position);
+    erase_from(chunk, static_cast<uint32_t>(position));
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::remove(const T& value) {
+    const T target(value);  // value may refer to an element that gets overwritten
+    Chunk* chunk = head_;
+    while (chunk) {
+        // Compact the survivors to the front of the chunk
+        T* items = chunk->items();
+        uint32_t kept = 0;
+        for (uint32_t i = 0; i < chunk->count; ++i) {
+            if (items[i] == target) continue;
+            if (kept != i) items[kept] = std::move(items[i]);
+            ++kept;
+        }
+        for (uint32_t i = kept; i < chunk->count; ++i) {
+            items[i].~T();
+        }
+        size_ -= chunk->count - kept;
+        chunk->count = kept;
+
+        Chunk* next = chunk->next;
+        if (kept == 0) {
+            free_chunk(chunk);
+        } else if (chunk->prev && chunk->prev->count + kept <= kChunkCapacity) {
+            merge_next(chunk->prev);
+        }
+        chunk = next;
+    }
+}
+
+template<typename T>
+int UnrolledLinkedList<T>::find(const T& value) const {
+    int position = 0;
+    for (const Chunk* chunk = head_; chunk; chunk = chunk->next) {
+        const T* items = chunk->items();
+        for (uint32_t i = 0; i < chunk->count; ++i) {
+            if (items[i] == value) {
+                return position + static_cast<int>(i);
+            }
+        }
+        position += static_cast<int>(chunk->count);
+    }
+    return -1;
+}
+
+template<typename T>
+T& UnrolledLinkedList<T>::at(size_t position) {
+    if (position >= size_) {
+        throw std::out_of_range("Position out of range");
+    }
+    Chunk* chunk = locate(position);
+    return chunk->items()[position];
+}
+
+template<typename T>
+const T& UnrolledLinkedList<T>::at(size_t position) const {
+    if (position >= size_) {
+        throw std::out_of_range("Position out of range");
+    }
+    const Chunk* chunk = locate(position);
+    return chunk->items()[position];
+}
+
+template<typename T>
+const T& UnrolledLinkedList<T>::front() const {
+    if (!head_) {
+        throw std::runtime_error("List is empty");
+    }
+    return head_->items()[0];
+}
+
+template<typename T>
+const T& UnrolledLinkedList<T>::back() const {
+    if (!tail_) {
+        throw std::runtime_error("List is empty");
+    }
+    return tail_->items()[tail_->count - 1];
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::reverse() {
+    Chunk* chunk = head_;
+    while (chunk) {
+        std::reverse(chunk->items(), chunk->items() + chunk->count);
+        std::swap(chunk->prev, chunk->next);
+        chunk = chunk->prev;  // The old next
+    }
+    std::swap(head_, tail_);
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::clear() {
+    if (!std::is_trivially_destructible<T>::value) {
+        for (Chunk* chunk = head_; chunk; chunk = chunk->next) {
+            T* items = chunk->items();
+            for (uint32_t i = 0; i < chunk->count; ++i) {
+                items[i].~T();
+            }
+        }
+    }
+    // Chunks are trivially destructible, so the pool drops its blocks at once
+    pool_.release();
+    head_ = nullptr;
+    tail_ = nullptr;
+    size_ = 0;
+}
+
+template<typename T>
+std::vector<T> UnrolledLinkedList<T>::to_vector() const {
+    std::vector<T> result;
+    result.reserve(size_);
+    for (const Chunk* chunk = head_; chunk; chunk = chunk->next) {
+        result.insert(result.end(), chunk->items(), chunk->items() + chunk->count);
+    }
+    return result;
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::print() const {
+    for (const Chunk* chunk = head_; chunk; chunk = chunk->next) {
+        std::cout << "[";
+        for (uint32_t i = 0; i < chunk->count; ++i) {
+            if (i > 0) std::cout << ", ";
+            std::cout << chunk->items()[i];
+        }
+        std::cout << "] -> ";
+    }
+    std::cout << "nullptr" << std::endl;
+}
+
+// UnrolledLinkedList Helper Methods
+
+template<typename T>
+typename UnrolledLinkedList<T>::Chunk* UnrolledLinkedList<T>::new_chunk_after(Chunk* chunk) {
+    // A null chunk means "before the head"
+    Chunk* created = pool_.create();
+    Chunk* next = chunk ? chunk->next : head_;
+    created->prev = chunk;
+    created->next = next;
+    if (chunk) {
+        chunk->next = created;
+    } else {
+        head_ = created;
+    }
+    if (next) {
+        next->prev = created;
+    } else {
+        tail_ = created;
+    }
+    return created;
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::free_chunk(Chunk* chunk) {
+    // The chunk's elements must already be destroyed
+    if (chunk->prev) {
+        chunk->prev->next = chunk->next;
+    } else {
+        head_ = chunk->next;
+    }
+    if (chunk->next) {
+        chunk->next->prev = chunk->prev;
+    } else {
+        tail_ = chunk->prev;
+    }
+    pool_.destroy(chunk);
+}
+
+template<typename T>
+typename UnrolledLinkedList<T>::Chunk* UnrolledLinkedList<T>::locate(size_t& position) const {
+    // Finds the chunk holding position (< size_) and turns position into
+    // an index inside it, walking from whichever end is nearer
+    Chunk* chunk;
+    if (position < size_ / 2) {
+        chunk = head_;
+        while (position >= chunk->count) {
+            position -= chunk->count;
+            chunk = chunk->next;
+        }
+    } else {
+        size_t from_end = size_ - position;
+        chunk = tail_;
+        while (from_end > chunk->count) {
+            from_end -= chunk->count;
+            chunk = chunk->prev;
+        }
+        position = chunk->count - from_end;
+    }
+    return chunk;
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::insert_into(Chunk* chunk, uint32_t index, T&& item) {
+    if (chunk->count == kChunkCapacity) {
+        split(chunk);
+        if (index > chunk->count) {
+            index -= chunk->count;
+            chunk = chunk->next;
+        }
+    }
+
+    T* items = chunk->items();
+    uint32_t count = chunk->count;
+    if (index == count) {
+        ::new (static_cast<void*>(items + count)) T(std::move(item));
+    } else {
+        // Open a gap at index by shifting the tail of the chunk right by one
+        ::new (static_cast<void*>(items + count)) T(std::move(items[count - 1]));
+        std::move_backward(items + index, items + count - 1, items + count);
+        items[index] = std::move(item);
+    }
+    ++chunk->count;
+    ++size_;
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::erase_from(Chunk* chunk, uint32_t index) {
+    T* items = chunk->items();
+    std::move(items + index + 1, items + chunk->count, items + index);
+    items[chunk->count - 1].~T();
+    --chunk->count;
+    --size_;
+
+    if (chunk->count == 0) {
+        free_chunk(chunk);
+    } else if (chunk->count < kChunkCapacity / 2) {
+        // Keep chunks dense by folding an underfull chunk into a neighbour
+        if (chunk->next && chunk->count + chunk->next->count <= kChunkCapacity) {
+            merge_next(chunk);
+        } else if (chunk->prev && chunk->prev->count + chunk->count <= kChunkCapacity) {
+            merge_next(chunk->prev);
+        }
+    }
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::split(Chunk* chunk) {
+    // Moves the upper half of a chunk into a new chunk right after it
+    Chunk* right = new_chunk_after(chunk);
+    uint32_t keep = chunk->count / 2;
+    T* from = chunk->items();
+    T* to = right->items();
+    for (uint32_t i = keep; i < chunk->count; ++i) {
+        ::new (static_cast<void*>(to + (i - keep))) T(std::move(from[i]));
+        from[i].~T();
+    }
+    right->count = chunk->count - keep;
+    chunk->count = keep;
+}
+
+template<typename T>
+void UnrolledLinkedList<T>::merge_next(Chunk* chunk) {
+    // Appends the successor's elements to chunk and frees the successor
+    Chunk* next = chunk->next;
+    T* to = chunk->items() + chunk->count;
+    T* from = next->items();
+    for (uint32_t i = 0; i < next->count; ++i) {
+        ::new (static_cast<void*>(to + i)) T(std::move(from[i]));
+        from[i].~T();
+    }
+    chunk->count += next->count;
+    next->count = 0;
+    free_chunk(next);
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_UNROLLED_LINKED_LIST_TPP
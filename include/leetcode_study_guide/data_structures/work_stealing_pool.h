@@ -0,0 +1,119 @@
+/**
+ * @file work_stealing_pool.h
+ * @brief Fork-join thread pool with per-worker deques and work stealing
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_WORK_STEALING_POOL_H
+#define LEETCODE_STUDY_GUIDE_WORK_STEALING_POOL_H
+
+#include "../common.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+/**
+ * @brief Thread pool for recursive fork-join parallelism
+ *
+ * Each worker owns a deque. A task spawned on a worker goes to the back of
+ * that worker's deque and the worker pops from the back (newest, smallest
+ * task first, which keeps its working set hot), while idle workers steal
+ * from the front of other deques (oldest, largest task first). Tasks
+ * spawned from outside the pool are spread round-robin over the deques.
+ *
+ * A thread waiting on a TaskGroup runs queued tasks itself instead of
+ * blocking, so nested fork-join never deadlocks, even with a single
+ * worker, and the calling thread contributes to the work.
+ */
+class WorkStealingPool {
+public:
+    /**
+     * @brief Set of spawned tasks that can be waited on together
+     *
+     * The destructor waits for tasks still running, so a group unwound by
+     * an exception never leaves a task holding references into the dead
+     * frame. Errors that were never collected by wait() are dropped then.
+     */
+    class TaskGroup {
+    public:
+        explicit TaskGroup(WorkStealingPool& pool) : pool_(pool), pending_(0) {}
+        ~TaskGroup() { drain(); }
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        /**
+         * @brief Queue a task
+         * @param task Function to run on some pool thread
+         */
+        void spawn(std::function<void()> task);
+
+        /**
+         * @brief Run queued tasks until every task of this group has finished
+         * @throws Rethrows the first exception thrown by a task
+         */
+        void wait();
+
+    private:
+        WorkStealingPool& pool_;
+        std::atomic<size_t> pending_;
+        std::mutex error_mutex_;
+        std::exception_ptr error_;
+
+        void drain();
+    };
+
+    /**
+     * @brief Start the workers
+     * @param threads Number of workers (0 = hardware concurrency)
+     */
+    explicit WorkStealingPool(unsigned threads = 0);
+
+    /**
+     * @brief Finish queued tasks and join the workers
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Get number of workers
+     * @return Worker count
+     */
+    unsigned size() const { return static_cast<unsigned>(workers_.size()); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;  // One per worker
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> queued_;                  // Tasks in all deques
+    std::atomic<size_t> next_queue_;              // Round-robin target for outside spawns
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stopping_;
+
+    void push(std::function<void()> task);
+    bool run_one(size_t home);
+    void worker_loop(size_t index);
+    size_t current_queue() const;
+};
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_WORK_STEALING_POOL_H
@@ -0,0 +1,20 @@
+/**
+ * @file adaptive_radix_tree.cpp
+ * @brief Explicit instantiations for AdaptiveRadixTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/adaptive_radix_tree.h"
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit template instantiations for common types
+
+template class AdaptiveRadixTree<int>;
+template class AdaptiveRadixTree<double>;
+template class AdaptiveRadixTree<std::string>;
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
@@ -0,0 +1,131 @@
+/**
+ * @file aho_corasick.cpp
+ * @brief Implementation file for AhoCorasick
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/aho_corasick.h"
+#include <queue>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// AhoCorasick Implementation
+
+AhoCorasick::AhoCorasick(const std::vector<std::string>& patterns)
+    : patterns_(patterns), byte_class_(), alphabet_size_(1), state_(0), position_(0) {
+    build();
+}
+
+AhoCorasick::AhoCorasick(const Trie& trie)
+    : AhoCorasick(trie.get_all_words()) {}
+
+std::vector<AhoCorasick::Match> AhoCorasick::scan(const std::string& chunk) {
+    std::vector<Match> matches;
+    scan(chunk.data(), chunk.size(), [&matches](const Match& match) {
+        matches.push_back(match);
+    });
+    return matches;
+}
+
+std::vector<AhoCorasick::Match> AhoCorasick::find_all(const std::string& text) const {
+    std::vector<Match> matches;
+    auto collect = [&matches](const Match& match) {
+        matches.push_back(match);
+    };
+    run(0, 0, text.data(), text.size(), collect);
+    return matches;
+}
+
+bool AhoCorasick::contains_any(const std::string& text) const {
+    int32_t state = 0;
+    for (char byte : text) {
+        state = next(state, byte);
+        if (has_output_[state]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AhoCorasick::reset() {
+    state_ = 0;
+    position_ = 0;
+}
+
+// AhoCorasick Helper Methods
+
+void AhoCorasick::build() {
+    // Compress the alphabet to the bytes that actually occur in patterns
+    for (const std::string& pattern : patterns_) {
+        for (char byte : pattern) {
+            byte_class_[static_cast<unsigned char>(byte)] = 1;
+        }
+    }
+    for (int byte = 0; byte < 256; ++byte) {
+        if (byte_class_[byte]) {
+            byte_class_[byte] = static_cast<unsigned char>(alphabet_size_++);
+        }
+    }
+    
+    // Goto function of the pattern trie; -1 marks a missing edge
+    transitions_.assign(alphabet_size_, -1);
+    std::vector<std::vector<uint32_t>> ends(1);
+    for (size_t id = 0; id < patterns_.size(); ++id) {
+        if (patterns_[id].empty()) continue;
+        
+        int32_t state = 0;
+        for (char byte : patterns_[id]) {
+            size_t slot = static_cast<size_t>(state) * alphabet_size_ + byte_class_[static_cast<unsigned char>(byte)];
+            if (transitions_[slot] < 0) {
+                transitions_[slot] = static_cast<int32_t>(ends.size());
+                transitions_.resize(transitions_.size() + alphabet_size_, -1);
+                ends.emplace_back();
+            }
+            state = transitions_[slot];
+        }
+        ends[state].push_back(static_cast<uint32_t>(id));
+    }
+    
+    // Breadth-first: fill missing edges from the failure state, which is
+    // shallower and therefore already complete
+    size_t states = ends.size();
+    std::vector<int32_t> fail(states, 0);
+    dict_link_.assign(states, -1);
+    has_output_.assign(states, 0);
+    has_output_[0] = !ends[0].empty();
+    
+    std::queue<int32_t> pending;
+    pending.push(0);
+    while (!pending.empty()) {
+        int32_t state = pending.front();
+        pending.pop();
+        int32_t* row = &transitions_[static_cast<size_t>(state) * alphabet_size_];
+        const int32_t* fail_row = &transitions_[static_cast<size_t>(fail[state]) * alphabet_size_];
+        
+        for (size_t c = 0; c < alphabet_size_; ++c) {
+            int32_t child = row[c];
+            if (child < 0) {
+                row[c] = state == 0 ? 0 : fail_row[c];
+                continue;
+            }
+            
+            int32_t link = state == 0 ? 0 : fail_row[c];
+            fail[child] = link;
+            dict_link_[child] = ends[link].empty() ? dict_link_[link] : link;
+            has_output_[child] = !ends[child].empty() || dict_link_[child] >= 0;
+            pending.push(child);
+        }
+    }
+    
+    // Flatten the per-state pattern lists
+    output_begin_.assign(states + 1, 0);
+    for (size_t s = 0; s < states; ++s) {
+        output_begin_[s + 1] = output_begin_[s] + static_cast<uint32_t>(ends[s].size());
+        output_ids_.insert(output_ids_.end(), ends[s].begin(), ends[s].end());
+    }
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
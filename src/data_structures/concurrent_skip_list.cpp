@@ -0,0 +1,22 @@
+/**
+ * @file concurrent_skip_list.cpp
+ * @brief Explicit instantiations for ConcurrentSkipList
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/concurrent_skip_list.h"
+#include <string>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit template instantiations for common types
+
+template class ConcurrentSkipList<int, int>;
+template class ConcurrentSkipList<int, std::string>;
+template class ConcurrentSkipList<std::string, int>;
+template class ConcurrentSkipList<double, double>;
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
@@ -0,0 +1,321 @@
+/**
+ * @file concurrent_trie.cpp
+ * @brief Implementation file for ConcurrentTrie
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/concurrent_trie.h"
+#include <algorithm>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+namespace {
+
+template<typename Children>
+auto lower_bound_key(Children& children, unsigned char key) -> decltype(children.begin()) {
+    return std::lower_bound(children.begin(), children.end(), key,
+                            [](const typename Children::value_type& entry, unsigned char k) {
+                                return entry.first < k;
+                            });
+}
+
+} // namespace
+
+// ConcurrentTrie Implementation
+
+ConcurrentTrie::ConcurrentTrie() : root_(new Node()) {}
+
+ConcurrentTrie::~ConcurrentTrie() {
+    destroy_tree(root_.load(std::memory_order_relaxed));
+}
+
+bool ConcurrentTrie::insert(const std::string& word) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    const Node* root = root_.load(std::memory_order_relaxed);
+    std::vector<const Node*> replaced;
+    const Node* updated = insert_path(root, word, 0, replaced);
+    if (updated == root) {
+        return false;
+    }
+    publish(updated, replaced);
+    return true;
+}
+
+bool ConcurrentTrie::remove(const std::string& word) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    const Node* root = root_.load(std::memory_order_relaxed);
+    std::vector<const Node*> replaced;
+    bool removed = false;
+    const Node* updated = remove_path(root, word, 0, true, replaced, removed);
+    if (!removed) {
+        return false;
+    }
+    publish(updated, replaced);
+    return true;
+}
+
+void ConcurrentTrie::clear() {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    const Node* old_root = root_.exchange(new Node(), std::memory_order_acq_rel);
+    
+    // The whole old snapshot becomes garbage once current readers finish
+    EpochReclaimer& reclaimer = EpochReclaimer::instance();
+    std::vector<const Node*> pending = {old_root};
+    while (!pending.empty()) {
+        const Node* node = pending.back();
+        pending.pop_back();
+        for (const auto& entry : node->children) {
+            pending.push_back(entry.second);
+        }
+        reclaimer.retire(const_cast<Node*>(node));
+    }
+}
+
+bool ConcurrentTrie::search(const std::string& word) const {
+    EpochReclaimer::Guard guard;
+    std::string path;
+    const Node* node = find_node(root_.load(std::memory_order_acquire), word, &path);
+    return node && node->is_end_of_word && path.size() == word.size();
+}
+
+bool ConcurrentTrie::starts_with(const std::string& prefix) const {
+    EpochReclaimer::Guard guard;
+    return find_node(root_.load(std::memory_order_acquire), prefix, nullptr) != nullptr;
+}
+
+int ConcurrentTrie::count_words_with_prefix(const std::string& prefix) const {
+    EpochReclaimer::Guard guard;
+    const Node* node = find_node(root_.load(std::memory_order_acquire), prefix, nullptr);
+    return node ? node->prefix_count : 0;
+}
+
+std::vector<std::string> ConcurrentTrie::auto_complete(const std::string& prefix, int max_suggestions) const {
+    std::vector<std::string> suggestions;
+    EpochReclaimer::Guard guard;
+    std::string path;
+    const Node* node = find_node(root_.load(std::memory_order_acquire), prefix, &path);
+    if (node && max_suggestions > 0) {
+        collect_limited(node, path, suggestions, max_suggestions);
+    }
+    return suggestions;
+}
+
+int ConcurrentTrie::size() const {
+    EpochReclaimer::Guard guard;
+    return root_.load(std::memory_order_acquire)->prefix_count;
+}
+
+// ConcurrentTrie Helper Methods
+
+const ConcurrentTrie::Node* ConcurrentTrie::find_child(const Node* node, unsigned char key) {
+    auto it = lower_bound_key(node->children, key);
+    return it != node->children.end() && it->first == key ? it->second : nullptr;
+}
+
+const ConcurrentTrie::Node* ConcurrentTrie::find_node(const Node* root, const std::string& prefix, std::string* path) {
+    const Node* current = root;
+    size_t i = 0;
+    
+    while (i < prefix.size()) {
+        const Node* child = find_child(current, static_cast<unsigned char>(prefix[i]));
+        if (!child) {
+            return nullptr;
+        }
+        
+        // The prefix may end part-way through the child's edge label
+        size_t length = std::min(child->label.size(), prefix.size() - i);
+        if (prefix.compare(i, length, child->label, 0, length) != 0) {
+            return nullptr;
+        }
+        
+        current = child;
+        i += child->label.size();
+    }
+    
+    if (path) {
+        *path = prefix;
+        if (i > prefix.size()) {
+            path->append(current->label, current->label.size() - (i - prefix.size()), std::string::npos);
+        }
+    }
+    return current;
+}
+
+const ConcurrentTrie::Node* ConcurrentTrie::insert_path(const Node* node, const std::string& word, size_t pos,
+                                                        std::vector<const Node*>& replaced) {
+    if (pos == word.size()) {
+        if (node->is_end_of_word) {
+            return node;  // Already present: nothing is copied
+        }
+        Node* copy = new Node(*node);
+        copy->is_end_of_word = true;
+        copy->prefix_count++;
+        replaced.push_back(node);
+        return copy;
+    }
+    
+    unsigned char key = static_cast<unsigned char>(word[pos]);
+    const Node* child = find_child(node, key);
+    const Node* new_child = nullptr;
+    
+    if (!child) {
+        Node* leaf = new Node(word.substr(pos));
+        leaf->is_end_of_word = true;
+        leaf->prefix_count = 1;
+        new_child = leaf;
+    } else {
+        const std::string& label = child->label;
+        size_t matched = 1;
+        while (matched < label.size() && pos + matched < word.size() && label[matched] == word[pos + matched]) {
+            ++matched;
+        }
+        
+        if (matched == label.size()) {
+            new_child = insert_path(child, word, pos + matched, replaced);
+            if (new_child == child) {
+                return node;
+            }
+        } else {
+            // Split the edge: the copy below keeps the old subtree
+            Node* lower = new Node(*child);
+            lower->label.erase(0, matched);
+            Node* middle = new Node(label.substr(0, matched));
+            middle->prefix_count = child->prefix_count + 1;
+            middle->children.emplace_back(static_cast<unsigned char>(lower->label[0]), lower);
+            
+            if (pos + matched == word.size()) {
+                middle->is_end_of_word = true;
+            } else {
+                Node* leaf = new Node(word.substr(pos + matched));
+                leaf->is_end_of_word = true;
+                leaf->prefix_count = 1;
+                unsigned char leaf_key = static_cast<unsigned char>(leaf->label[0]);
+                middle->children.insert(lower_bound_key(middle->children, leaf_key), std::make_pair(leaf_key, leaf));
+            }
+            replaced.push_back(child);
+            new_child = middle;
+        }
+    }
+    
+    Node* copy = new Node(*node);
+    copy->prefix_count++;
+    auto it = lower_bound_key(copy->children, key);
+    if (child) {
+        it->second = new_child;
+    } else {
+        copy->children.insert(it, std::make_pair(key, new_child));
+    }
+    replaced.push_back(node);
+    return copy;
+}
+
+const ConcurrentTrie::Node* ConcurrentTrie::remove_path(const Node* node, const std::string& word, size_t pos,
+                                                        bool is_root, std::vector<const Node*>& replaced,
+                                                        bool& removed) {
+    if (pos == word.size()) {
+        if (!node->is_end_of_word) {
+            return node;
+        }
+        removed = true;
+        replaced.push_back(node);
+        
+        if (!is_root && node->children.empty()) {
+            return nullptr;
+        }
+        if (!is_root && node->children.size() == 1) {
+            return merge_with_only_child(node, replaced);
+        }
+        Node* copy = new Node(*node);
+        copy->is_end_of_word = false;
+        copy->prefix_count--;
+        return copy;
+    }
+    
+    unsigned char key = static_cast<unsigned char>(word[pos]);
+    const Node* child = find_child(node, key);
+    if (!child || word.compare(pos, child->label.size(), child->label) != 0) {
+        return node;
+    }
+    
+    const Node* new_child = remove_path(child, word, pos + child->label.size(), false, replaced, removed);
+    if (!removed) {
+        return node;
+    }
+    replaced.push_back(node);
+    
+    Node* copy = new Node(*node);
+    copy->prefix_count--;
+    auto it = lower_bound_key(copy->children, key);
+    if (new_child) {
+        it->second = new_child;
+    } else {
+        copy->children.erase(it);
+    }
+    
+    // A pass-through node left behind is spliced into its only child
+    if (!is_root && !copy->is_end_of_word && copy->children.size() == 1) {
+        const Node* only = copy->children[0].second;
+        Node* merged;
+        if (only == new_child) {
+            merged = const_cast<Node*>(only);  // Fresh copy, not yet visible to readers
+        } else {
+            merged = new Node(*only);
+            replaced.push_back(only);
+        }
+        merged->label.insert(0, copy->label);
+        delete copy;
+        return merged;
+    }
+    return copy;
+}
+
+const ConcurrentTrie::Node* ConcurrentTrie::merge_with_only_child(const Node* node,
+                                                                  std::vector<const Node*>& replaced) {
+    const Node* only = node->children[0].second;
+    Node* merged = new Node(*only);
+    merged->label.insert(0, node->label);
+    replaced.push_back(only);
+    return merged;
+}
+
+void ConcurrentTrie::collect_limited(const Node* node, std::string& prefix,
+                                     std::vector<std::string>& words, int limit) {
+    if (node->is_end_of_word) {
+        words.push_back(prefix);
+    }
+    
+    for (const auto& entry : node->children) {
+        if (static_cast<int>(words.size()) >= limit) return;
+        const Node* child = entry.second;
+        prefix += child->label;
+        collect_limited(child, prefix, words, limit);
+        prefix.resize(prefix.size() - child->label.size());
+    }
+}
+
+void ConcurrentTrie::destroy_tree(const Node* root) {
+    std::vector<const Node*> pending = {root};
+    while (!pending.empty()) {
+        const Node* node = pending.back();
+        pending.pop_back();
+        for (const auto& entry : node->children) {
+            pending.push_back(entry.second);
+        }
+        delete node;
+    }
+}
+
+void ConcurrentTrie::publish(const Node* root, const std::vector<const Node*>& replaced) {
+    root_.store(root, std::memory_order_release);
+    
+    // Readers that loaded the old root may still be inside these nodes
+    EpochReclaimer& reclaimer = EpochReclaimer::instance();
+    for (const Node* node : replaced) {
+        reclaimer.retire(const_cast<Node*>(node));
+    }
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
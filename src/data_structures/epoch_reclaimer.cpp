@@ -0,0 +1,162 @@
+/**
+ * @file epoch_reclaimer.cpp
+ * @brief Implementation file for EpochReclaimer
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/epoch_reclaimer.h"
+#include <memory>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Per-thread pin state and retire buffer
+struct EpochReclaimer::ThreadState {
+    ThreadSlot* slot = nullptr;
+    unsigned nesting = 0;
+    std::vector<Retired> retired;
+    
+    ~ThreadState() {
+        EpochReclaimer& domain = EpochReclaimer::instance();
+        if (!retired.empty()) {
+            std::lock_guard<std::mutex> lock(domain.orphan_mutex_);
+            domain.orphans_.insert(domain.orphans_.end(), retired.begin(), retired.end());
+        }
+        if (slot) {
+            slot->epoch.store(0, std::memory_order_release);
+            slot->in_use.store(false, std::memory_order_release);
+        }
+    }
+};
+
+// EpochReclaimer Implementation
+
+EpochReclaimer::SlotChunk::SlotChunk() : next(nullptr) {
+    for (ThreadSlot& slot : slots) {
+        slot.epoch.store(0, std::memory_order_relaxed);
+        slot.in_use.store(false, std::memory_order_relaxed);
+    }
+}
+
+EpochReclaimer::EpochReclaimer() : global_epoch_(1) {}
+
+EpochReclaimer::~EpochReclaimer() {
+    // Only runs at process exit, after every reader is gone
+    for (const Retired& entry : orphans_) {
+        entry.deleter(entry.object);
+    }
+    SlotChunk* chunk = slots_.next.load(std::memory_order_acquire);
+    while (chunk) {
+        SlotChunk* next = chunk->next.load(std::memory_order_relaxed);
+        delete chunk;
+        chunk = next;
+    }
+}
+
+EpochReclaimer& EpochReclaimer::instance() {
+    static EpochReclaimer domain;
+    return domain;
+}
+
+EpochReclaimer::Guard::Guard() {
+    ThreadState& state = local();
+    if (state.nesting++ > 0) return;
+    
+    if (!state.slot) {
+        state.slot = instance().acquire_slot();
+    }
+    
+    // The announcement must be visible before any shared pointer is read
+    uint64_t current = instance().global_epoch_.load(std::memory_order_relaxed);
+    state.slot->epoch.store(current, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+EpochReclaimer::Guard::~Guard() {
+    ThreadState& state = local();
+    if (--state.nesting > 0) return;
+    state.slot->epoch.store(0, std::memory_order_release);
+}
+
+void EpochReclaimer::retire(void* object, void (*deleter)(void*)) {
+    // Read the epoch only after the unlink is globally visible
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    ThreadState& state = local();
+    state.retired.push_back(Retired{object, deleter, global_epoch_.load(std::memory_order_relaxed)});
+    if (state.retired.size() >= kCollectThreshold) {
+        collect();
+    }
+}
+
+size_t EpochReclaimer::collect() {
+    try_advance();
+    uint64_t current = global_epoch_.load(std::memory_order_acquire);
+    size_t freed = free_safe(local().retired, current);
+    
+    std::unique_lock<std::mutex> lock(orphan_mutex_, std::try_to_lock);
+    if (lock.owns_lock()) {
+        freed += free_safe(orphans_, current);
+    }
+    return freed;
+}
+
+// EpochReclaimer Helper Methods
+
+EpochReclaimer::ThreadState& EpochReclaimer::local() {
+    thread_local ThreadState state;
+    return state;
+}
+
+EpochReclaimer::ThreadSlot* EpochReclaimer::acquire_slot() {
+    SlotChunk* chunk = &slots_;
+    while (true) {
+        for (ThreadSlot& slot : chunk->slots) {
+            bool expected = false;
+            if (!slot.in_use.load(std::memory_order_relaxed) &&
+                slot.in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return &slot;
+            }
+        }
+        
+        SlotChunk* next = chunk->next.load(std::memory_order_acquire);
+        if (!next) {
+            // Every slot is taken: append a chunk with the first slot claimed.
+            // If another thread appends first, keep scanning from its chunk.
+            std::unique_ptr<SlotChunk> grown(new SlotChunk());
+            grown->slots[0].in_use.store(true, std::memory_order_relaxed);
+            if (chunk->next.compare_exchange_strong(next, grown.get(), std::memory_order_acq_rel)) {
+                return &grown.release()->slots[0];
+            }
+        }
+        chunk = next;
+    }
+}
+
+bool EpochReclaimer::try_advance() {
+    uint64_t current = global_epoch_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (const SlotChunk* chunk = &slots_; chunk; chunk = chunk->next.load(std::memory_order_acquire)) {
+        for (const ThreadSlot& slot : chunk->slots) {
+            uint64_t pinned = slot.epoch.load(std::memory_order_acquire);
+            if (pinned != 0 && pinned != current) {
+                return false;  // A reader may still hold pointers from an older epoch
+            }
+        }
+    }
+    return global_epoch_.compare_exchange_strong(current, current + 1, std::memory_order_acq_rel);
+}
+
+size_t EpochReclaimer::free_safe(std::vector<Retired>& retired, uint64_t epoch) {
+    // Entries are appended in epoch order, so the safe ones form a prefix
+    size_t safe = 0;
+    while (safe < retired.size() && retired[safe].epoch + 2 <= epoch) {
+        retired[safe].deleter(retired[safe].object);
+        ++safe;
+    }
+    retired.erase(retired.begin(), retired.begin() + static_cast<std::ptrdiff_t>(safe));
+    return safe;
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
@@ -0,0 +1,451 @@
+/**
+ * @file frozen_trie.cpp
+ * @brief Implementation file for FrozenTrie and SuccinctBitVector
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/frozen_trie.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+namespace {
+
+const char kFrozenTrieMagic[8] = {'L', 'S', 'G', 'T', 'R', 'I', 'E', '1'};
+
+// File header; the sections follow in the order of FrozenTrieLayout
+struct FrozenTrieHeader {
+    char magic[8];
+    uint64_t node_count;
+    uint64_t word_count;
+    uint64_t louds_bits;
+};
+
+int popcount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<int>(__popcnt64(word));
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<int>((word * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+// Index of the lowest set bit; word must be non-zero
+int count_trailing_zeros(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index = 0;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return popcount((word & (~word + 1)) - 1);
+#endif
+}
+
+// Adds a section length to a word offset; the total must stay addressable in bytes
+void advance(uint64_t& offset, uint64_t words) {
+    if (words > std::numeric_limits<uint64_t>::max() / sizeof(uint64_t) - offset) {
+        throw std::runtime_error("Invalid frozen trie header");
+    }
+    offset += words;
+}
+
+// Word offsets of each section, derived from the header counts
+struct FrozenTrieLayout {
+    uint64_t louds_words;
+    uint64_t louds_blocks;
+    uint64_t terminal_words;
+    uint64_t terminal_blocks;
+    uint64_t labels;
+    uint64_t total_words;
+    
+    FrozenTrieLayout(uint64_t node_count, uint64_t louds_bits) {
+        uint64_t offset = sizeof(FrozenTrieHeader) / sizeof(uint64_t);
+        louds_words = offset;
+        advance(offset, SuccinctBitVector::word_count(louds_bits));
+        louds_blocks = offset;
+        advance(offset, SuccinctBitVector::block_count(louds_bits));
+        terminal_words = offset;
+        advance(offset, SuccinctBitVector::word_count(node_count));
+        terminal_blocks = offset;
+        advance(offset, SuccinctBitVector::block_count(node_count));
+        labels = offset;
+        advance(offset, node_count / 8 + (node_count % 8 != 0));
+        total_words = offset;
+    }
+};
+
+// A stored rank directory must match its bits, and padding bits must be clear
+bool valid_directory(const uint64_t* words, uint64_t bits, const uint64_t* blocks) {
+    const uint64_t words_per_block = SuccinctBitVector::kBlockBits / 64;
+    uint64_t total_words = SuccinctBitVector::word_count(bits);
+    if (bits % 64 != 0 && (words[total_words - 1] >> (bits % 64)) != 0) {
+        return false;
+    }
+    uint64_t ones = 0;
+    for (uint64_t w = 0; w < total_words; ++w) {
+        if (w % words_per_block == 0 && blocks[w / words_per_block] != ones) {
+            return false;
+        }
+        ones += static_cast<uint64_t>(popcount(words[w]));
+    }
+    for (uint64_t b = (total_words + words_per_block - 1) / words_per_block;
+         b < SuccinctBitVector::block_count(bits); ++b) {
+        if (blocks[b] != ones) return false;
+    }
+    return true;
+}
+
+// Excess (ones minus zeros) of a byte read least significant bit first,
+// and the lowest excess reached by any of its non-empty prefixes
+struct ByteExcess {
+    int total;
+    int lowest;
+};
+
+const std::array<ByteExcess, 256>& byte_excess() {
+    static const std::array<ByteExcess, 256> table = [] {
+        std::array<ByteExcess, 256> result{};
+        for (unsigned byte = 0; byte < 256; ++byte) {
+            int excess = 0, lowest = 8;
+            for (unsigned bit = 0; bit < 8; ++bit) {
+                excess += (byte >> bit) & 1 ? 1 : -1;
+                lowest = std::min(lowest, excess);
+            }
+            result[byte] = ByteExcess{excess, lowest};
+        }
+        return result;
+    }();
+    return table;
+}
+
+// Every node must be introduced by a one before its own degree code starts,
+// so child ids always exceed their parent's and traversals terminate. With
+// n - 1 ones and n zeros, that means the string ends in a zero and no prefix
+// of the rest has more zeros than ones. Words whose starting excess is at
+// least 64 cannot go negative and only need a popcount
+bool valid_louds(const uint64_t* words, uint64_t bits, uint64_t node_count) {
+    if (bits != 2 * node_count - 1 || ((words[(bits - 1) / 64] >> ((bits - 1) % 64)) & 1)) {
+        return false;
+    }
+    const std::array<ByteExcess, 256>& table = byte_excess();
+    uint64_t limit = bits - 1;
+    int64_t excess = 0;
+    for (uint64_t w = 0; w * 64 < limit; ++w) {
+        uint64_t word = words[w];
+        uint64_t span = std::min<uint64_t>(64, limit - w * 64);
+        if (span == 64 && excess >= 64) {
+            excess += 2 * static_cast<int64_t>(popcount(word)) - 64;
+            continue;
+        }
+        uint64_t bit = 0;
+        for (; bit + 8 <= span; bit += 8) {
+            const ByteExcess& entry = table[(word >> bit) & 0xFF];
+            if (excess + entry.lowest < 0) return false;
+            excess += entry.total;
+        }
+        for (; bit < span; ++bit) {
+            excess += (word >> bit) & 1 ? 1 : -1;
+            if (excess < 0) return false;
+        }
+    }
+    return excess == 0;
+}
+
+} // namespace
+
+// SuccinctBitVector Implementation
+
+uint64_t SuccinctBitVector::rank1(uint64_t pos) const {
+    uint64_t block = pos / kBlockBits;
+    uint64_t result = blocks_[block];
+    for (uint64_t w = block * (kBlockBits / 64); w < pos / 64; ++w) {
+        result += popcount(words_[w]);
+    }
+    if (pos % 64) {
+        result += popcount(words_[pos / 64] & ((uint64_t(1) << (pos % 64)) - 1));
+    }
+    return result;
+}
+
+uint64_t SuccinctBitVector::select0(uint64_t j) const {
+    // Binary search for the last block with at most j zeros before it
+    uint64_t lo = 0, hi = block_count(size_) - 1;
+    while (hi - lo > 1) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (mid * kBlockBits - blocks_[mid] <= j) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    
+    uint64_t remaining = j - (lo * kBlockBits - blocks_[lo]);
+    for (uint64_t w = lo * (kBlockBits / 64); w < word_count(size_); ++w) {
+        uint64_t zeros = ~words_[w];
+        if (w == size_ / 64) {
+            zeros &= (uint64_t(1) << (size_ % 64)) - 1;  // Padding is not part of the vector
+        }
+        uint64_t count = static_cast<uint64_t>(popcount(zeros));
+        if (remaining < count) {
+            for (; remaining > 0; --remaining) {
+                zeros &= zeros - 1;
+            }
+            return w * 64 + static_cast<uint64_t>(count_trailing_zeros(zeros));
+        }
+        remaining -= count;
+    }
+    throw std::out_of_range("select0 index out of range");
+}
+
+void SuccinctBitVector::build_directory(const uint64_t* words, uint64_t bits, uint64_t* blocks) {
+    uint64_t total_words = word_count(bits);
+    uint64_t ones = 0;
+    for (uint64_t w = 0; w < total_words; ++w) {
+        if (w % (kBlockBits / 64) == 0) {
+            blocks[w / (kBlockBits / 64)] = ones;
+        }
+        ones += popcount(words[w]);
+    }
+    for (uint64_t b = (total_words + kBlockBits / 64 - 1) / (kBlockBits / 64); b < block_count(bits); ++b) {
+        blocks[b] = ones;
+    }
+}
+
+// FrozenTrie Implementation
+
+FrozenTrie::FrozenTrie() : FrozenTrie(Trie()) {}
+
+FrozenTrie::FrozenTrie(const Trie& trie)
+    : base_(nullptr), bytes_(0), node_count_(0), word_count_(0), labels_(nullptr) {
+    // A character-level node is a radix node plus how much of its label is used
+    using CharNode = std::pair<const Trie::TrieNode*, size_t>;
+    
+    std::vector<uint64_t> louds, terminal;
+    std::vector<unsigned char> labels;
+    uint64_t louds_bits = 0;
+    
+    auto append_bit = [](std::vector<uint64_t>& bits, uint64_t pos, bool value) {
+        if (pos % 64 == 0) bits.push_back(0);
+        if (value) bits.back() |= uint64_t(1) << (pos % 64);
+    };
+    
+    // Breadth-first walk over the expanded character tree
+    std::queue<CharNode> pending;
+    pending.emplace(trie.root_, 0);
+    labels.push_back(0);
+    while (!pending.empty()) {
+        auto [node, used] = pending.front();
+        pending.pop();
+        
+        bool at_radix_node = used == node->label_length;
+        append_bit(terminal, node_count_, at_radix_node && node->is_end_of_word);
+        ++node_count_;
+        
+        if (!at_radix_node) {
+            labels.push_back(static_cast<unsigned char>(trie.label(node)[used]));
+            pending.emplace(node, used + 1);
+            append_bit(louds, louds_bits++, true);
+        } else {
+            node->children.for_each([&](unsigned char key, Trie::TrieNode* child) {
+                labels.push_back(key);
+                pending.emplace(child, 1);
+                append_bit(louds, louds_bits++, true);
+            });
+        }
+        append_bit(louds, louds_bits++, false);
+    }
+    word_count_ = static_cast<uint64_t>(trie.size());
+    
+    // Lay everything out in one buffer that doubles as the file image
+    FrozenTrieLayout layout(node_count_, louds_bits);
+    auto buffer = std::make_shared<std::vector<uint64_t>>(layout.total_words, 0);
+    uint64_t* words = buffer->data();
+    
+    FrozenTrieHeader header;
+    std::memcpy(header.magic, kFrozenTrieMagic, sizeof(header.magic));
+    header.node_count = node_count_;
+    header.word_count = word_count_;
+    header.louds_bits = louds_bits;
+    std::memcpy(words, &header, sizeof(header));
+    
+    std::copy(louds.begin(), louds.end(), words + layout.louds_words);
+    SuccinctBitVector::build_directory(words + layout.louds_words, louds_bits, words + layout.louds_blocks);
+    std::copy(terminal.begin(), terminal.end(), words + layout.terminal_words);
+    SuccinctBitVector::build_directory(words + layout.terminal_words, node_count_, words + layout.terminal_blocks);
+    std::memcpy(words + layout.labels, labels.data(), labels.size());
+    
+    const void* data = words;
+    attach(std::shared_ptr<const void>(buffer, data), data, layout.total_words * sizeof(uint64_t), false);
+}
+
+FrozenTrie FrozenTrie::load(const std::string& path, bool verify) {
+    auto mapping = std::make_shared<MappedFile>(path);
+    FrozenTrie frozen;
+    frozen.attach(std::shared_ptr<const void>(mapping, mapping->data()), mapping->data(), mapping->size(), verify);
+    return frozen;
+}
+
+FrozenTrie FrozenTrie::from_buffer(const void* data, size_t size, bool verify) {
+    FrozenTrie frozen;
+    frozen.attach(nullptr, data, size, verify);
+    return frozen;
+}
+
+void FrozenTrie::save(const std::string& path) const {
+    MappedFile::write(path, base_, bytes_);
+}
+
+bool FrozenTrie::search(const std::string& word) const {
+    uint64_t node = 0;
+    return find_node(word, node) && terminal_.get(node);
+}
+
+bool FrozenTrie::starts_with(const std::string& prefix) const {
+    uint64_t node = 0;
+    return find_node(prefix, node);
+}
+
+int FrozenTrie::count_words_with_prefix(const std::string& prefix) const {
+    uint64_t node = 0;
+    if (!find_node(prefix, node)) {
+        return 0;
+    }
+    
+    // The subtree occupies one contiguous range of node ids on every level
+    uint64_t first = node, last = node;
+    uint64_t count = 0;
+    while (first <= last) {
+        count += terminal_.rank1(last + 1) - terminal_.rank1(first);
+        
+        uint64_t first_start = first == 0 ? 0 : louds_.select0(first - 1) + 1;
+        uint64_t last_end = louds_.select0(last);
+        first = louds_.rank1(first_start) + 1;
+        last = louds_.rank1(last_end);
+    }
+    return static_cast<int>(count);
+}
+
+std::vector<std::string> FrozenTrie::auto_complete(const std::string& prefix, int max_suggestions) const {
+    std::vector<std::string> suggestions;
+    uint64_t node = 0;
+    if (max_suggestions > 0 && find_node(prefix, node)) {
+        std::string path = prefix;
+        collect_limited(node, path, suggestions, max_suggestions);
+    }
+    return suggestions;
+}
+
+// FrozenTrie Helper Methods
+
+void FrozenTrie::attach(std::shared_ptr<const void> storage, const void* data, size_t size, bool verify) {
+    if (size < sizeof(FrozenTrieHeader) || reinterpret_cast<uintptr_t>(data) % alignof(uint64_t) != 0) {
+        throw std::runtime_error("Invalid frozen trie buffer");
+    }
+    
+    FrozenTrieHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kFrozenTrieMagic, sizeof(header.magic)) != 0 || header.node_count == 0) {
+        throw std::runtime_error("Invalid frozen trie header");
+    }
+    
+    // Every node takes at least a label byte, which bounds the counts by the
+    // buffer size before any arithmetic on them
+    uint64_t header_words = sizeof(FrozenTrieHeader) / sizeof(uint64_t);
+    uint64_t available = size / sizeof(uint64_t) - header_words;
+    if (header.node_count > available * 8) {
+        throw std::runtime_error("Truncated frozen trie buffer");
+    }
+    // A tree of n nodes has n - 1 edges: n - 1 ones and n zeros
+    if (header.louds_bits % 2 == 0 || header.louds_bits / 2 != header.node_count - 1 ||
+        header.word_count > header.node_count) {
+        throw std::runtime_error("Invalid frozen trie header");
+    }
+    
+    FrozenTrieLayout layout(header.node_count, header.louds_bits);
+    if (size / sizeof(uint64_t) < layout.total_words) {
+        throw std::runtime_error("Truncated frozen trie buffer");
+    }
+    
+    // The structural checks read every page of the buffer, so they only run
+    // on request, for buffers that did not come from save()
+    const uint64_t* words = static_cast<const uint64_t*>(data);
+    if (verify && (!valid_directory(words + layout.louds_words, header.louds_bits, words + layout.louds_blocks) ||
+        !valid_directory(words + layout.terminal_words, header.node_count, words + layout.terminal_blocks) ||
+        !valid_louds(words + layout.louds_words, header.louds_bits, header.node_count) ||
+        SuccinctBitVector(words + layout.terminal_words, words + layout.terminal_blocks,
+                          header.node_count).rank1(header.node_count) != header.word_count)) {
+        throw std::runtime_error("Invalid frozen trie structure");
+    }
+    
+    storage_ = std::move(storage);
+    base_ = static_cast<const unsigned char*>(data);
+    bytes_ = layout.total_words * sizeof(uint64_t);
+    node_count_ = header.node_count;
+    word_count_ = header.word_count;
+    louds_ = SuccinctBitVector(words + layout.louds_words, words + layout.louds_blocks, header.louds_bits);
+    terminal_ = SuccinctBitVector(words + layout.terminal_words, words + layout.terminal_blocks, header.node_count);
+    labels_ = reinterpret_cast<const unsigned char*>(words + layout.labels);
+}
+
+uint64_t FrozenTrie::first_child(uint64_t node, uint64_t& degree) const {
+    // Node x's unary degree code sits between the (x-1)-th and x-th zero
+    uint64_t start = node == 0 ? 0 : louds_.select0(node - 1) + 1;
+    uint64_t end = louds_.select0(node);
+    degree = end - start;
+    return louds_.rank1(start) + 1;
+}
+
+bool FrozenTrie::find_node(const std::string& prefix, uint64_t& node) const {
+    node = 0;
+    for (char c : prefix) {
+        uint64_t degree = 0;
+        uint64_t first = first_child(node, degree);
+        
+        // Children labels are contiguous and sorted
+        const unsigned char* begin = labels_ + first;
+        const unsigned char* end = begin + degree;
+        const unsigned char* it = std::lower_bound(begin, end, static_cast<unsigned char>(c));
+        if (it == end || *it != static_cast<unsigned char>(c)) {
+            return false;
+        }
+        node = first + static_cast<uint64_t>(it - begin);
+    }
+    return true;
+}
+
+void FrozenTrie::collect_limited(uint64_t node, std::string& prefix,
+                                 std::vector<std::string>& words, int limit) const {
+    if (terminal_.get(node)) {
+        words.push_back(prefix);
+    }
+    
+    uint64_t degree = 0;
+    uint64_t first = first_child(node, degree);
+    for (uint64_t child = first; child < first + degree; ++child) {
+        if (static_cast<int>(words.size()) >= limit) return;
+        prefix.push_back(static_cast<char>(labels_[child]));
+        collect_limited(child, prefix, words, limit);
+        prefix.pop_back();
+    }
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
@@ -6,43 +6,209 @@
  */
 
 #include "leetcode_study_guide/data_structures/heap.h"
+#include "leetcode_study_guide/data_structures/frozen_trie.h"
 #include <iostream>
 #include <algorithm>
+#include <type_traits>
 
 namespace leetcode_study_guide {
 namespace data_structures {
 
-// Trie Implementation
+// Trie ChildMap Implementation
 
-Trie::Trie() : root_(std::make_unique<TrieNode>()), total_words_(0) {}
+// clear() and ~Trie drop the arenas without running any node destructor
+static_assert(std::is_trivially_destructible<Trie::TrieNode>::value,
+              "TrieNode must not own memory outside the trie's arenas");
 
-void Trie::insert(const std::string& word) {
-    TrieNode* current = root_.get();
-    
-    for (char c : word) {
-        int index = c - 'a';
-        if (index < 0 || index >= 26) {
-            continue; // Skip non-lowercase letters
+Trie::TrieNode** Trie::ChildMap::slot(unsigned char key) const {
+    switch (kind_) {
+        case Kind::Inline:
+            for (size_t i = 0; i < size_ && inline_.keys[i] <= key; ++i) {
+                if (inline_.keys[i] == key) return const_cast<TrieNode**>(&inline_.nodes[i]);
+            }
+            return nullptr;
+        case Kind::Sorted: {
+            const unsigned char* keys = sorted_->keys;
+            const unsigned char* it = std::lower_bound(keys, keys + size_, key);
+            if (it != keys + size_ && *it == key) return &sorted_->nodes[it - keys];
+            return nullptr;
         }
-        
-        if (!current->children[index]) {
-            current->children[index] = std::make_unique<TrieNode>();
+        case Kind::Direct:
+            return direct_->nodes[key] ? &direct_->nodes[key] : nullptr;
+    }
+    return nullptr;
+}
+
+Trie::TrieNode* Trie::ChildMap::find(unsigned char key) const {
+    TrieNode** entry = slot(key);
+    return entry ? *entry : nullptr;
+}
+
+void Trie::ChildMap::replace(unsigned char key, TrieNode* child) {
+    TrieNode** entry = slot(key);
+    if (entry) *entry = child;
+}
+
+void Trie::ChildMap::insert(unsigned char key, TrieNode* child, Blocks& blocks) {
+    // Grow to the next representation when the current one is full
+    if (kind_ == Kind::Inline && size_ == kInlineCapacity) {
+        Sorted* grown = blocks.sorted.create();
+        std::copy(inline_.keys, inline_.keys + size_, grown->keys);
+        std::copy(inline_.nodes, inline_.nodes + size_, grown->nodes);
+        sorted_ = grown;
+        kind_ = Kind::Sorted;
+    } else if (kind_ == Kind::Sorted && size_ == kSortedCapacity) {
+        Direct* grown = blocks.direct.create();
+        for (size_t i = 0; i < size_; ++i) {
+            grown->nodes[sorted_->keys[i]] = sorted_->nodes[i];
         }
+        blocks.sorted.destroy(sorted_);
+        direct_ = grown;
+        kind_ = Kind::Direct;
+    }
+    
+    if (kind_ == Kind::Direct) {
+        direct_->nodes[key] = child;
+        ++size_;
+        return;
+    }
+    
+    unsigned char* keys = kind_ == Kind::Inline ? inline_.keys : sorted_->keys;
+    TrieNode** nodes = kind_ == Kind::Inline ? inline_.nodes : sorted_->nodes;
+    size_t pos = std::lower_bound(keys, keys + size_, key) - keys;
+    std::copy_backward(keys + pos, keys + size_, keys + size_ + 1);
+    std::copy_backward(nodes + pos, nodes + size_, nodes + size_ + 1);
+    keys[pos] = key;
+    nodes[pos] = child;
+    ++size_;
+}
+
+void Trie::ChildMap::erase(unsigned char key, Blocks& blocks) {
+    if (kind_ == Kind::Direct) {
+        if (!direct_->nodes[key]) return;
+        direct_->nodes[key] = nullptr;
+        --size_;
         
-        current = current->children[index].get();
-        current->prefix_count++;
+        // Shrink with some hysteresis so alternating insert/erase stays cheap
+        if (size_ <= kSortedCapacity / 2) {
+            Sorted* shrunk = blocks.sorted.create();
+            size_t count = 0;
+            for (size_t i = 0; i < 256; ++i) {
+                if (direct_->nodes[i]) {
+                    shrunk->keys[count] = static_cast<unsigned char>(i);
+                    shrunk->nodes[count++] = direct_->nodes[i];
+                }
+            }
+            blocks.direct.destroy(direct_);
+            sorted_ = shrunk;
+            kind_ = Kind::Sorted;
+        }
+        return;
+    }
+    
+    unsigned char* keys = kind_ == Kind::Inline ? inline_.keys : sorted_->keys;
+    TrieNode** nodes = kind_ == Kind::Inline ? inline_.nodes : sorted_->nodes;
+    size_t pos = std::lower_bound(keys, keys + size_, key) - keys;
+    if (pos == size_ || keys[pos] != key) return;
+    
+    std::copy(keys + pos + 1, keys + size_, keys + pos);
+    std::copy(nodes + pos + 1, nodes + size_, nodes + pos);
+    --size_;
+    
+    if (kind_ == Kind::Sorted && size_ <= kInlineCapacity / 2) {
+        Sorted* old = sorted_;
+        inline_ = Inline();
+        std::copy(old->keys, old->keys + size_, inline_.keys);
+        std::copy(old->nodes, old->nodes + size_, inline_.nodes);
+        blocks.sorted.destroy(old);
+        kind_ = Kind::Inline;
+    }
+}
+
+void Trie::ChildMap::reset(Blocks& blocks) {
+    if (kind_ == Kind::Sorted) {
+        blocks.sorted.destroy(sorted_);
+    } else if (kind_ == Kind::Direct) {
+        blocks.direct.destroy(direct_);
+    }
+    inline_ = Inline();
+    size_ = 0;
+    kind_ = Kind::Inline;
+}
+
+// Trie Implementation
+
+Trie::Trie() : root_(nullptr), total_words_(0), node_count_(0), cache_k_(0) {
+    root_ = new_node(0, 0);
+}
+
+Trie::Trie(Trie&& other) noexcept
+    : nodes_(std::move(other.nodes_)), child_blocks_(std::move(other.child_blocks_)), labels_(std::move(other.labels_)),
+      root_(other.root_), total_words_(other.total_words_), node_count_(other.node_count_),
+      cache_k_(other.cache_k_), scores_(std::move(other.scores_)), top_(std::move(other.top_)) {
+    other.labels_.clear();
+    other.scores_.clear();
+    other.top_.clear();
+    other.root_ = nullptr;
+    other.total_words_ = 0;
+    other.node_count_ = 0;
+    other.cache_k_ = 0;
+}
+
+Trie& Trie::operator=(Trie&& other) noexcept {
+    if (this != &other) {
+        // Taking over the other arenas releases this trie's in one step
+        nodes_ = std::move(other.nodes_);
+        child_blocks_.sorted = std::move(other.child_blocks_.sorted);
+        child_blocks_.direct = std::move(other.child_blocks_.direct);
+        labels_ = std::move(other.labels_);
+        root_ = other.root_;
+        total_words_ = other.total_words_;
+        node_count_ = other.node_count_;
+        cache_k_ = other.cache_k_;
+        scores_ = std::move(other.scores_);
+        top_ = std::move(other.top_);
+        other.labels_.clear();
+        other.scores_.clear();
+        other.top_.clear();
+        other.root_ = nullptr;
+        other.total_words_ = 0;
+        other.node_count_ = 0;
+        other.cache_k_ = 0;
+    }
+    return *this;
+}
+
+void Trie::insert(const std::string& word) {
+    std::vector<TrieNode*> path;
+    bool inserted = false;
+    TrieNode* node = insert_path(word, path, inserted);
+    
+    if (inserted && cache_k_ > 0) {
+        offer_completion(path, word, score_of(node));
     }
+}
+
+void Trie::insert(const std::string& word, int score) {
+    std::vector<TrieNode*> path;
+    bool inserted = false;
+    TrieNode* node = insert_path(word, path, inserted);
+    int old_score = score_of(node);
+    set_score(node, score);
     
-    if (!current->is_end_of_word) {
-        current->is_end_of_word = true;
-        total_words_++;
+    if (cache_k_ == 0) return;
+    if (!inserted && score < old_score) {
+        // A demoted word may have to make room for one not cached yet
+        refresh_completions(path, word);
+    } else {
+        offer_completion(path, word, score);
     }
-    current->word_count++;
 }
 
 bool Trie::search(const std::string& word) const {
-    TrieNode* node = find_node(word);
-    return node && node->is_end_of_word;
+    std::string path;
+    TrieNode* node = find_node(word, &path);
+    return node && node->is_end_of_word && path.size() == word.size();
 }
 
 bool Trie::starts_with(const std::string& prefix) const {
@@ -50,21 +216,61 @@ bool Trie::starts_with(const std::string& prefix) const {
 }
 
 bool Trie::remove(const std::string& word) {
-    if (!search(word)) {
+    // Record the path so counts can be fixed and empty nodes pruned
+    std::vector<TrieNode*> path = {root_};
+    size_t i = 0;
+    while (i < word.size()) {
+        TrieNode* child = path.back()->children.find(static_cast<unsigned char>(word[i]));
+        if (!child || word.compare(i, child->label_length, label(child)) != 0) {
+            return false;
+        }
+        path.push_back(child);
+        i += child->label_length;
+    }
+    
+    TrieNode* node = path.back();
+    if (!node->is_end_of_word) {
         return false;
     }
     
-    remove_helper(root_.get(), word, 0);
+    node->is_end_of_word = false;
+    node->word_count = 0;
+    set_score(node, 0);  // A later insert of the word starts unscored
+    for (TrieNode* on_path : path) {
+        on_path->prefix_count--;
+    }
     total_words_--;
+    if (cache_k_ > 0) {
+        refresh_completions(path, word);
+    }
+    
+    if (path.size() == 1) {
+        return true;  // Empty word ends at the root
+    }
+    
+    TrieNode* parent = path[path.size() - 2];
+    if (node->children.empty()) {
+        parent->children.erase(static_cast<unsigned char>(label(node)[0]), child_blocks_);
+        free_node(node);
+        
+        // The parent may now be a pass-through node that can be compressed
+        if (parent != root_ && !parent->is_end_of_word && parent->children.size() == 1) {
+            merge_with_only_child(path[path.size() - 3], parent);
+        }
+    } else if (node->children.size() == 1) {
+        merge_with_only_child(parent, node);
+    }
+    
     return true;
 }
 
 std::vector<std::string> Trie::get_words_with_prefix(const std::string& prefix) const {
     std::vector<std::string> words;
-    TrieNode* prefix_node = find_node(prefix);
+    std::string path;
+    TrieNode* prefix_node = find_node(prefix, &path);
     
     if (prefix_node) {
-        collect_words(prefix_node, prefix, words);
+        collect_words(prefix_node, path, words);
     }
     
     return words;
@@ -72,7 +278,8 @@ std::vector<std::string> Trie::get_words_with_prefix(const std::string& prefix)
 
 std::vector<std::string> Trie::get_all_words() const {
     std::vector<std::string> words;
-    collect_words(root_.get(), "", words);
+    std::string path;
+    collect_words(root_, path, words);
     return words;
 }
 
@@ -83,26 +290,14 @@ int Trie::count_words_with_prefix(const std::string& prefix) const {
 
 std::string Trie::longest_common_prefix() const {
     std::string lcp;
-    TrieNode* current = root_.get();
+    const TrieNode* current = root_;
     
-    while (current) {
-        int child_count = 0;
-        int child_index = -1;
-        
-        for (int i = 0; i < 26; ++i) {
-            if (current->children[i]) {
-                child_count++;
-                child_index = i;
-            }
-        }
-        
-        // Stop if we have multiple children or reached end of word
-        if (child_count != 1 || current->is_end_of_word) {
-            break;
-        }
-        
-        lcp += static_cast<char>('a' + child_index);
-        current = current->children[child_index].get();
+    // Stop if we have multiple children or reached end of word
+    while (current->children.size() == 1 && !current->is_end_of_word) {
+        current->children.for_each([&current](unsigned char, TrieNode* child) {
+            current = child;
+        });
+        lcp += label(current);
     }
     
     return lcp;
@@ -110,16 +305,72 @@ std::string Trie::longest_common_prefix() const {
 
 std::vector<std::string> Trie::auto_complete(const std::string& prefix, int max_suggestions) const {
     std::vector<std::string> suggestions;
-    TrieNode* prefix_node = find_node(prefix);
+    std::string path;
+    TrieNode* prefix_node = find_node(prefix, &path);
     
     if (prefix_node) {
         int count = 0;
-        collect_words_limited(prefix_node, prefix, suggestions, count, max_suggestions);
+        collect_words_limited(prefix_node, path, suggestions, count, max_suggestions);
     }
     
     return suggestions;
 }
 
+std::vector<Trie::Completion> Trie::top_completions(const std::string& prefix, int max_suggestions) const {
+    std::string path;
+    TrieNode* prefix_node = max_suggestions > 0 ? find_node(prefix, &path) : nullptr;
+    if (!prefix_node) {
+        return {};
+    }
+    
+    size_t limit = static_cast<size_t>(max_suggestions);
+    if (limit <= cache_k_) {
+        const std::vector<Completion>& top = cached_top(prefix_node);
+        size_t count = std::min(limit, top.size());
+        return std::vector<Completion>(top.begin(), top.begin() + count);
+    }
+    
+    TopKAccumulator<Completion, CompletionOrder> best(limit);
+    collect_top(prefix_node, path, best);
+    return best.result();
+}
+
+void Trie::enable_top_k_cache(int k) {
+    cache_k_ = k > 0 ? static_cast<size_t>(k) : 0;
+    std::unordered_map<const TrieNode*, std::vector<Completion>>().swap(top_);
+    
+    if (cache_k_ > 0) {
+        std::string prefix;
+        rebuild_completions(root_, prefix);
+    }
+}
+
+std::vector<Trie::FuzzyMatch> Trie::fuzzy_search(const std::string& query, int max_distance, int max_results) const {
+    std::vector<FuzzyMatch> matches;
+    if (max_distance < 0 || max_results <= 0) {
+        return matches;
+    }
+    
+    // Row 0: distance from the empty prefix to each query prefix
+    size_t width = query.size() + 1;
+    std::vector<int> rows(width);
+    for (size_t j = 0; j < width; ++j) {
+        rows[j] = std::min(static_cast<int>(j), max_distance + 1);
+    }
+    
+    std::string prefix;
+    fuzzy_collect(root_, prefix, query, max_distance, rows, matches);
+    
+    // Collected in alphabetical order, so a stable sort ranks by distance
+    std::stable_sort(matches.begin(), matches.end(), [](const FuzzyMatch& a, const FuzzyMatch& b) {
+        return a.distance < b.distance;
+    });
+    if (matches.size() > static_cast<size_t>(max_results)) {
+        matches.resize(static_cast<size_t>(max_results));
+    }
+    return matches;
+}
+
 std::vector<std::string> Trie::shortest_unique_prefixes(const std::vector<std::string>& words) {
     Trie trie;
     
@@ -132,19 +383,17 @@ std::vector<std::string> Trie::shortest_unique_prefixes(const std::vector<std::s
     
     for (const std::string& word : words) {
         std::string prefix;
-        TrieNode* current = trie.root_.get();
+        const TrieNode* current = trie.root_;
         
-        for (char c : word) {
-            int index = c - 'a';
-            if (index < 0 || index >= 26) continue;
+        while (prefix.size() < word.size()) {
+            current = current->children.find(static_cast<unsigned char>(word[prefix.size()]));
             
-            prefix += c;
-            current = current->children[index].get();
-            
-            // If this is the only word with this prefix, we found the shortest unique prefix
-            if (current && current->prefix_count == 1) {
+            // If this is the only word below this edge, its first byte is enough
+            if (current->prefix_count == 1) {
+                prefix += trie.label(current)[0];
                 break;
             }
+            prefix += trie.label(current);
         }
         
         prefixes.push_back(prefix);
@@ -162,121 +411,411 @@ int Trie::size() const {
 }
 
 void Trie::clear() {
-    root_ = std::make_unique<TrieNode>();
+    // Nodes hold no memory of their own, so no node is visited
+    scores_.clear();
+    top_.clear();
+    nodes_.release();
+    child_blocks_.sorted.release();
+    child_blocks_.direct.release();
+    std::string().swap(labels_);
+    node_count_ = 0;
+    root_ = new_node(0, 0);
     total_words_ = 0;
 }
 
 void Trie::print_words() const {
     std::cout << "Trie contains " << total_words_ << " words:\n";
-    print_words_helper(root_.get(), "");
+    std::string path;
+    print_words_helper(root_, path);
+}
+
+FrozenTrie Trie::freeze() const {
+    return FrozenTrie(*this);
 }
 
 // Trie Helper Methods
 
-Trie::TrieNode* Trie::find_node(const std::string& prefix) const {
-    TrieNode* current = root_.get();
+Trie::TrieNode* Trie::insert_path(const std::string& word, std::vector<TrieNode*>& path, bool& inserted) {
+    TrieNode* current = root_;
+    current->prefix_count++;
+    path.push_back(current);
+    inserted = true;
+    size_t i = 0;
     
-    for (char c : prefix) {
-        int index = c - 'a';
-        if (index < 0 || index >= 26 || !current->children[index]) {
-            return nullptr;
+    while (i < word.size()) {
+        unsigned char key = static_cast<unsigned char>(word[i]);
+        TrieNode* child = current->children.find(key);
+        
+        if (!child) {
+            // Whole remaining suffix becomes a single leaf edge
+            TrieNode* leaf = new_node(store_label(word, i), word.size() - i);
+            leaf->is_end_of_word = true;
+            leaf->word_count = 1;
+            leaf->prefix_count = 1;
+            current->children.insert(key, leaf, child_blocks_);
+            path.push_back(leaf);
+            total_words_++;
+            return leaf;
+        }
+        
+        std::string_view edge = label(child);
+        size_t matched = 1;
+        while (matched < edge.size() && i + matched < word.size() && edge[matched] == word[i + matched]) {
+            ++matched;
+        }
+        
+        if (matched < edge.size()) {
+            // Split the edge: the shared part becomes a new intermediate node
+            TrieNode* middle = split_edge(child, matched);
+            auto cached = top_.find(child);
+            if (cached != top_.end()) {
+                std::vector<Completion> copy = cached->second;  // Same subtree, same list
+                top_[middle] = std::move(copy);
+            }
+            current->children.replace(key, middle);
+            child = middle;
+        }
+        
+        child->prefix_count++;
+        current = child;
+        path.push_back(current);
+        i += matched;
+    }
+    
+    if (current->is_end_of_word) {
+        // Duplicate: the path already existed, so undo the prefix counts
+        current->word_count++;
+        for (TrieNode* on_path : path) {
+            on_path->prefix_count--;
         }
-        current = current->children[index].get();
+        inserted = false;
+        return current;
     }
     
+    current->is_end_of_word = true;
+    current->word_count = 1;
+    total_words_++;
     return current;
 }
 
-void Trie::collect_words(TrieNode* node, const std::string& prefix, std::vector<std::string>& words) const {
-    if (!node) return;
-    
-    if (node->is_end_of_word) {
-        words.push_back(prefix);
-    }
+void Trie::offer_completion(const std::vector<TrieNode*>& path, const std::string& word, int score) {
+    Completion candidate{word, score};
+    CompletionOrder order;
     
-    for (int i = 0; i < 26; ++i) {
-        if (node->children[i]) {
-            char next_char = static_cast<char>('a' + i);
-            collect_words(node->children[i].get(), prefix + next_char, words);
+    // A word rejected by a subtree's list is rejected by every ancestor's
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        std::vector<Completion>& top = top_[*it];
+        auto existing = std::find_if(top.begin(), top.end(),
+                                     [&word](const Completion& c) { return c.word == word; });
+        if (existing != top.end()) {
+            top.erase(existing);
+        } else if (top.size() >= cache_k_) {
+            if (!order(candidate, top.back())) break;
+            top.pop_back();
         }
+        top.insert(std::lower_bound(top.begin(), top.end(), candidate, order), candidate);
     }
 }
 
-void Trie::collect_words_limited(TrieNode* node, const std::string& prefix, 
-                                std::vector<std::string>& words, int& count, int limit) const {
-    if (!node || count >= limit) return;
+void Trie::refresh_completions(const std::vector<TrieNode*>& path, const std::string& word) {
+    std::vector<size_t> depth(path.size(), 0);
+    for (size_t i = 1; i < path.size(); ++i) {
+        depth[i] = depth[i - 1] + path[i]->label_length;
+    }
     
+    // Lists containing the word form a suffix of the path; rebuild those bottom-up
+    for (size_t i = path.size(); i-- > 0;) {
+        const std::vector<Completion>& top = cached_top(path[i]);
+        bool cached = std::any_of(top.begin(), top.end(),
+                                  [&word](const Completion& c) { return c.word == word; });
+        if (!cached) break;
+        merge_child_completions(path[i], word.substr(0, depth[i]));
+    }
+}
+
+void Trie::rebuild_completions(TrieNode* node, std::string& prefix) {
+    node->children.for_each([&](unsigned char, TrieNode* child) {
+        prefix += label(child);
+        rebuild_completions(child, prefix);
+        prefix.resize(prefix.size() - child->label_length);
+    });
+    merge_child_completions(node, prefix);
+}
+
+void Trie::merge_child_completions(TrieNode* node, const std::string& prefix) {
+    TopKAccumulator<Completion, CompletionOrder> best(cache_k_);
     if (node->is_end_of_word) {
-        words.push_back(prefix);
-        count++;
-        if (count >= limit) return;
+        best.push(Completion{prefix, score_of(node)});
     }
-    
-    for (int i = 0; i < 26; ++i) {
-        if (node->children[i] && count < limit) {
-            char next_char = static_cast<char>('a' + i);
-            collect_words_limited(node->children[i].get(), prefix + next_char, words, count, limit);
+    node->children.for_each([this, &best](unsigned char, TrieNode* child) {
+        for (const Completion& c : cached_top(child)) {
+            if (!best.push(c)) break;  // Child lists are sorted best first
         }
+    });
+    
+    std::vector<Completion> top = best.result();
+    if (top.empty()) {
+        top_.erase(node);
+    } else {
+        top_[node] = std::move(top);
     }
 }
 
-bool Trie::remove_helper(TrieNode* node, const std::string& word, int index) {
-    if (index == static_cast<int>(word.length())) {
-        if (!node->is_end_of_word) {
-            return false;
-        }
+int Trie::score_of(const TrieNode* node) const {
+    auto it = scores_.find(node);
+    return it == scores_.end() ? 0 : it->second;
+}
+
+void Trie::set_score(const TrieNode* node, int score) {
+    if (score == 0) {
+        scores_.erase(node);
+    } else {
+        scores_[node] = score;
+    }
+}
+
+const std::vector<Trie::Completion>& Trie::cached_top(const TrieNode* node) const {
+    static const std::vector<Completion> none;
+    auto it = top_.find(node);
+    return it == top_.end() ? none : it->second;
+}
+
+void Trie::fuzzy_collect(const TrieNode* node, std::string& prefix, const std::string& query,
+                         int max_distance, std::vector<int>& rows, std::vector<FuzzyMatch>& matches) const {
+    size_t width = query.size() + 1;
+    size_t base = prefix.size();
+    int limit = max_distance + 1;  // Every value >= limit is clamped to limit
+    size_t band = static_cast<size_t>(max_distance);
+    
+    for (char c : label(node)) {
+        // Only cells with |i - j| <= max_distance can stay within the limit
+        size_t i = prefix.size() + 1;
+        rows.resize((i + 1) * width);
+        const int* prev = &rows[(i - 1) * width];
+        int* cur = &rows[i * width];
         
-        node->is_end_of_word = false;
-        node->word_count--;
+        size_t lo = i > band ? i - band : 1;
+        size_t hi = std::min(query.size(), i + band);
+        cur[0] = std::min(static_cast<int>(i), limit);
+        if (lo > 1 && lo - 1 <= query.size()) cur[lo - 1] = limit;
+        if (hi < query.size()) cur[hi + 1] = limit;
         
-        // Check if node has any children
-        for (int i = 0; i < 26; ++i) {
-            if (node->children[i]) {
-                return false; // Don't delete this node, it has children
-            }
+        int row_min = cur[0];
+        for (size_t j = lo; j <= hi; ++j) {
+            int cost = prev[j - 1] + (query[j - 1] != c ? 1 : 0);
+            cost = std::min(cost, std::min(prev[j], cur[j - 1]) + 1);
+            cur[j] = std::min(cost, limit);
+            row_min = std::min(row_min, cur[j]);
         }
         
-        return true; // Delete this node if it has no children and no words end here
+        prefix.push_back(c);
+        if (row_min > max_distance) {
+            prefix.resize(base);
+            return;  // No extension of this prefix can come back within range
+        }
     }
     
-    int char_index = word[index] - 'a';
-    if (char_index < 0 || char_index >= 26 || !node->children[char_index]) {
-        return false;
+    // Cells outside the band hold stale values from other branches
+    size_t depth = prefix.size();
+    size_t gap = depth > query.size() ? depth - query.size() : query.size() - depth;
+    int distance = gap <= band ? rows[depth * width + query.size()] : limit;
+    if (node->is_end_of_word && distance <= max_distance) {
+        matches.push_back(FuzzyMatch{prefix, distance});
+    }
+    
+    node->children.for_each([&](unsigned char, TrieNode* child) {
+        fuzzy_collect(child, prefix, query, max_distance, rows, matches);
+    });
+    prefix.resize(base);
+}
+
+void Trie::collect_top(const TrieNode* node, std::string& prefix,
+                       TopKAccumulator<Completion, CompletionOrder>& best) const {
+    if (node->is_end_of_word) {
+        best.push(Completion{prefix, score_of(node)});
+    }
+    
+    node->children.for_each([&](unsigned char, TrieNode* child) {
+        prefix += label(child);
+        collect_top(child, prefix, best);
+        prefix.resize(prefix.size() - child->label_length);
+    });
+}
+
+void Trie::append_sorted(const std::string& word, Spine& spine, std::string& previous) {
+    if (spine.empty()) {
+        spine.emplace_back(root_, 0);
+    } else if (word < previous) {
+        throw std::invalid_argument("Words must be sorted");
+    }
+    
+    TrieNode* last = spine.back().first;
+    if (word == previous && last->is_end_of_word) {
+        last->word_count++;
+        return;
+    }
+    
+    size_t common = 0;
+    size_t limit = std::min(word.size(), previous.size());
+    while (common < limit && word[common] == previous[common]) ++common;
+    
+    // Deepest node of the previous word's path that lies within the common prefix
+    size_t keep = spine.size() - 1;
+    while (spine[keep].second > common) --keep;
+    TrieNode* parent = spine[keep].first;
+    
+    if (spine[keep].second < common) {
+        // The previous word's next edge runs past the common prefix: split it
+        TrieNode* child = spine[keep + 1].first;
+        TrieNode* middle = split_edge(child, common - spine[keep].second);
+        parent->children.replace(static_cast<unsigned char>(label(middle)[0]), middle);
+        spine.resize(keep + 1);
+        spine.emplace_back(middle, common);
+        parent = middle;
+    } else {
+        spine.resize(keep + 1);
     }
     
-    TrieNode* child = node->children[char_index].get();
-    bool should_delete_child = remove_helper(child, word, index + 1);
+    for (const auto& entry : spine) {
+        entry.first->prefix_count++;
+    }
     
-    if (should_delete_child) {
-        node->children[char_index].reset();
+    if (word.size() == common) {
+        parent->is_end_of_word = true;  // Only the empty word ends at an existing node
+        parent->word_count = 1;
+    } else {
+        // Sorted input: the new edge is always the parent's largest key
+        TrieNode* leaf = new_node(store_label(word, common), word.size() - common);
+        leaf->is_end_of_word = true;
+        leaf->word_count = 1;
+        leaf->prefix_count = 1;
+        parent->children.insert(static_cast<unsigned char>(word[common]), leaf, child_blocks_);
+        spine.emplace_back(leaf, word.size());
+    }
+    
+    total_words_++;
+    previous = word;
+}
+
+size_t Trie::store_label(const std::string& text, size_t pos) {
+    size_t offset = labels_.size();
+    labels_.append(text, pos, std::string::npos);
+    return offset;
+}
+
+Trie::TrieNode* Trie::new_node(size_t label_offset, size_t label_length) {
+    ++node_count_;
+    return nodes_.create(label_offset, label_length);
+}
+
+Trie::TrieNode* Trie::split_edge(TrieNode* child, size_t cut) {
+    // The new node's label is the head of the child's bytes, so nothing is copied
+    TrieNode* middle = new_node(child->label_offset, cut);
+    middle->prefix_count = child->prefix_count;
+    child->label_offset += cut;
+    child->label_length -= cut;
+    middle->children.insert(static_cast<unsigned char>(label(child)[0]), child, child_blocks_);
+    return middle;
+}
+
+void Trie::free_node(TrieNode* node) {
+    if (!scores_.empty()) scores_.erase(node);
+    if (!top_.empty()) top_.erase(node);
+    node->children.reset(child_blocks_);
+    --node_count_;
+    nodes_.destroy(node);
+}
+
+Trie::TrieNode* Trie::find_node(const std::string& prefix, std::string* path) const {
+    TrieNode* current = root_;
+    size_t i = 0;
+    
+    while (i < prefix.size()) {
+        TrieNode* child = current->children.find(static_cast<unsigned char>(prefix[i]));
+        if (!child) {
+            return nullptr;
+        }
         
-        // Check if current node should be deleted
-        if (!node->is_end_of_word) {
-            for (int i = 0; i < 26; ++i) {
-                if (node->children[i]) {
-                    return false; // Don't delete this node, it has other children
-                }
-            }
-            return true; // Delete this node if it has no children and no words end here
+        // The prefix may end part-way through the child's edge label
+        size_t length = std::min(child->label_length, prefix.size() - i);
+        if (prefix.compare(i, length, label(child), 0, length) != 0) {
+            return nullptr;
         }
+        
+        current = child;
+        i += child->label_length;
     }
     
-    return false;
+    if (path) {
+        *path = prefix;
+        if (i > prefix.size()) {
+            path->append(label(current).substr(current->label_length - (i - prefix.size())));
+        }
+    }
+    return current;
 }
 
-void Trie::print_words_helper(TrieNode* node, const std::string& prefix) const {
-    if (!node) return;
+void Trie::collect_words(const TrieNode* node, std::string& prefix, std::vector<std::string>& words) const {
+    if (node->is_end_of_word) {
+        words.push_back(prefix);
+    }
+    
+    node->children.for_each([&](unsigned char, TrieNode* child) {
+        prefix += label(child);
+        collect_words(child, prefix, words);
+        prefix.resize(prefix.size() - child->label_length);
+    });
+}
+
+void Trie::collect_words_limited(const TrieNode* node, std::string& prefix, 
+                                std::vector<std::string>& words, int& count, int limit) const {
+    if (count >= limit) return;
     
     if (node->is_end_of_word) {
-        std::cout << "  " << prefix << "\n";
+        words.push_back(prefix);
+        count++;
+        if (count >= limit) return;
     }
     
-    for (int i = 0; i < 26; ++i) {
-        if (node->children[i]) {
-            char next_char = static_cast<char>('a' + i);
-            print_words_helper(node->children[i].get(), prefix + next_char);
+    node->children.for_each([&](unsigned char, TrieNode* child) {
+        if (count < limit) {
+            prefix += label(child);
+            collect_words_limited(child, prefix, words, count, limit);
+            prefix.resize(prefix.size() - child->label_length);
         }
+    });
+}
+
+void Trie::merge_with_only_child(TrieNode* parent, TrieNode* node) {
+    // Splice node out: its single child absorbs node's edge label
+    TrieNode* child = nullptr;
+    node->children.for_each([&child](unsigned char, TrieNode* only) {
+        child = only;
+    });
+    
+    unsigned char key = static_cast<unsigned char>(label(node)[0]);
+    if (node->label_offset + node->label_length == child->label_offset) {
+        child->label_offset = node->label_offset;  // Still adjacent since an earlier split
+    } else {
+        std::string merged(label(node));
+        merged += label(child);
+        child->label_offset = store_label(merged, 0);
     }
+    child->label_length += node->label_length;
+    parent->children.replace(key, child);
+    free_node(node);
+}
+
+void Trie::print_words_helper(const TrieNode* node, std::string& prefix) const {
+    if (node->is_end_of_word) {
+        std::cout << "  " << prefix << "\n";
+    }
+    
+    node->children.for_each([&](unsigned char, TrieNode* child) {
+        prefix += label(child);
+        print_words_helper(child, prefix);
+        prefix.resize(prefix.size() - child->label_length);
+    });
 }
 
 // Explicit template instantiations for common types
@@ -310,5 +849,28 @@ template std::vector<int> merge_k_sorted_arrays<int>(const std::vector<std::vect
 template std::vector<double> merge_k_sorted_arrays<double>(const std::vector<std::vector<double>>& arrays);
 template std::vector<std::string> merge_k_sorted_arrays<std::string>(const std::vector<std::vector<std::string>>& arrays);
 
+// Min-max heap instantiations
+template class MinMaxHeap<int, std::less<int>>;
+template class MinMaxHeap<double, std::less<double>>;
+template class MinMaxHeap<std::string, std::less<std::string>>;
+
+// Top-k accumulator instantiations
+template class TopKAccumulator<int, std::greater<int>>;
+template class TopKAccumulator<int, std::less<int>>;
+template class TopKAccumulator<double, std::greater<double>>;
+template class TopKAccumulator<double, std::less<double>>;
+
+// Loser tree instantiations
+template class LoserTree<int, std::less<int>>;
+template class LoserTree<double, std::less<double>>;
+template class LoserTree<std::string, std::less<std::string>>;
+
+template std::vector<int> loser_tree_merge<int>(const std::vector<std::vector<int>>& arrays, const std::less<int>& comp);
+template std::vector<double> loser_tree_merge<double>(const std::vector<std::vector<double>>& arrays, const std::less<double>& comp);
+template std::vector<std::string> loser_tree_merge<std::string>(const std::vector<std::vector<std::string>>& arrays, const std::less<std::string>& comp);
+
+template std::vector<int> parallel_loser_tree_merge<int>(const std::vector<std::vector<int>>& arrays, size_t num_threads, const std::less<int>& comp);
+template std::vector<double> parallel_loser_tree_merge<double>(const std::vector<std::vector<double>>& arrays, size_t num_threads, const std::less<double>& comp);
+
 } // namespace data_structures
 } // namespace leetcode_study_guide
\ No newline at end of file
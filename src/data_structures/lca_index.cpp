@@ -0,0 +1,22 @@
+/**
+ * @file lca_index.cpp
+ * @brief Explicit instantiations for LcaIndex
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/lca_index.h"
+#include <string>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit template instantiations for common types
+
+template class LcaIndex<int>;
+template class LcaIndex<double>;
+template class LcaIndex<std::string>;
+template class LcaIndex<char>;
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
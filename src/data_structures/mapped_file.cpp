@@ -0,0 +1,81 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Implementation file for MappedFile
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/mapped_file.h"
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LEETCODE_STUDY_GUIDE_HAS_MMAP 1
+#endif
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+MappedFile::MappedFile(const std::string& path) : data_(nullptr), size_(0) {
+#ifdef LEETCODE_STUDY_GUIDE_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+    
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Cannot stat file: " + path);
+    }
+    
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ > 0) {
+        void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Cannot map file: " + path);
+        }
+        data_ = mapping;
+    }
+    ::close(fd);  // The mapping stays valid after the descriptor is closed
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("Cannot open file: " + path);
+    }
+    
+    size_ = static_cast<size_t>(in.tellg());
+    fallback_.resize((size_ + sizeof(unsigned long long) - 1) / sizeof(unsigned long long));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(fallback_.data()), static_cast<std::streamsize>(size_));
+    data_ = fallback_.data();
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef LEETCODE_STUDY_GUIDE_HAS_MMAP
+    if (data_ && size_ > 0) {
+        ::munmap(const_cast<void*>(data_), size_);
+    }
+#endif
+}
+
+void MappedFile::write(const std::string& path, const void* data, size_t size) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open file for writing: " + path);
+    }
+    
+    out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    if (!out) {
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
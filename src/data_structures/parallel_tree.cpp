@@ -0,0 +1,45 @@
+/**
+ * @file parallel_tree.cpp
+ * @brief Explicit instantiations for the parallel tree algorithms
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/parallel_tree.h"
+#include <string>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit instantiations for standalone functions
+
+template int parallel_height<int>(const BinaryTree<int>& tree, WorkStealingPool& pool, int fork_depth);
+template int parallel_height<double>(const BinaryTree<double>& tree, WorkStealingPool& pool, int fork_depth);
+template int parallel_height<std::string>(const BinaryTree<std::string>& tree, WorkStealingPool& pool, int fork_depth);
+
+template size_t parallel_count_nodes<int>(const BinaryTree<int>& tree, WorkStealingPool& pool, int fork_depth);
+template size_t parallel_count_nodes<double>(const BinaryTree<double>& tree, WorkStealingPool& pool, int fork_depth);
+template size_t parallel_count_nodes<std::string>(const BinaryTree<std::string>& tree, WorkStealingPool& pool, int fork_depth);
+
+template bool parallel_is_balanced<int>(const BinaryTree<int>& tree, WorkStealingPool& pool, int fork_depth);
+template bool parallel_is_balanced<double>(const BinaryTree<double>& tree, WorkStealingPool& pool, int fork_depth);
+template bool parallel_is_balanced<std::string>(const BinaryTree<std::string>& tree, WorkStealingPool& pool, int fork_depth);
+
+template bool parallel_is_symmetric<int>(const BinaryTree<int>& tree, WorkStealingPool& pool, int fork_depth);
+template bool parallel_is_symmetric<double>(const BinaryTree<double>& tree, WorkStealingPool& pool, int fork_depth);
+template bool parallel_is_symmetric<std::string>(const BinaryTree<std::string>& tree, WorkStealingPool& pool, int fork_depth);
+
+template int parallel_tree_diameter<int>(const BinaryTree<int>& tree, WorkStealingPool& pool, int fork_depth);
+template int parallel_tree_diameter<double>(const BinaryTree<double>& tree, WorkStealingPool& pool, int fork_depth);
+template int parallel_tree_diameter<std::string>(const BinaryTree<std::string>& tree, WorkStealingPool& pool, int fork_depth);
+
+template bool parallel_are_identical<int>(const BinaryTree<int>& tree1, const BinaryTree<int>& tree2,
+                                          WorkStealingPool& pool, int fork_depth);
+template bool parallel_are_identical<double>(const BinaryTree<double>& tree1, const BinaryTree<double>& tree2,
+                                             WorkStealingPool& pool, int fork_depth);
+template bool parallel_are_identical<std::string>(const BinaryTree<std::string>& tree1,
+                                                  const BinaryTree<std::string>& tree2,
+                                                  WorkStealingPool& pool, int fork_depth);
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
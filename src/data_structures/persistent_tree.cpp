@@ -0,0 +1,27 @@
+/**
+ * @file persistent_tree.cpp
+ * @brief Explicit instantiations for PersistentBinarySearchTree and VersionedBinarySearchTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/persistent_tree.h"
+#include <string>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit template instantiations for common types
+
+template class PersistentBinarySearchTree<int>;
+template class PersistentBinarySearchTree<double>;
+template class PersistentBinarySearchTree<std::string>;
+template class PersistentBinarySearchTree<char>;
+
+template class VersionedBinarySearchTree<int>;
+template class VersionedBinarySearchTree<double>;
+template class VersionedBinarySearchTree<std::string>;
+template class VersionedBinarySearchTree<char>;
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
@@ -0,0 +1,26 @@
+/**
+ * @file pooled_tree.cpp
+ * @brief Explicit instantiations for PooledBinaryTree and PooledBinarySearchTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/pooled_tree.h"
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit template instantiations for common types
+
+template class PooledBinaryTree<int>;
+template class PooledBinaryTree<double>;
+template class PooledBinaryTree<std::string>;
+template class PooledBinaryTree<char>;
+
+template class PooledBinarySearchTree<int>;
+template class PooledBinarySearchTree<double>;
+template class PooledBinarySearchTree<std::string>;
+template class PooledBinarySearchTree<char>;
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
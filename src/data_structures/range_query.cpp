@@ -0,0 +1,31 @@
+/**
+ * @file range_query.cpp
+ * @brief Explicit instantiations for FenwickTree and SegmentTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/range_query.h"
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit template instantiations for common types
+
+template class FenwickTree<int>;
+template class FenwickTree<long long>;
+template class FenwickTree<double>;
+
+template class SegmentTree<int>;
+template class SegmentTree<int, MinMonoid<int>, AddUpdate<int>>;
+template class SegmentTree<int, MaxMonoid<int>, AddUpdate<int>>;
+template class SegmentTree<int, SumMonoid<int>, AssignUpdate<int>>;
+template class SegmentTree<int, MinMonoid<int>, AssignUpdate<int>>;
+template class SegmentTree<int, MaxMonoid<int>, AssignUpdate<int>>;
+template class SegmentTree<long long>;
+template class SegmentTree<double>;
+template class SegmentTree<double, MinMonoid<double>, AddUpdate<double>>;
+template class SegmentTree<double, MaxMonoid<double>, AddUpdate<double>>;
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
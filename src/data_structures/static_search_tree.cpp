@@ -0,0 +1,21 @@
+/**
+ * @file static_search_tree.cpp
+ * @brief Explicit instantiations for StaticSearchTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/static_search_tree.h"
+#include <string>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit template instantiations for common types
+
+template class StaticSearchTree<int>;
+template class StaticSearchTree<double>;
+template class StaticSearchTree<std::string>;
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
@@ -25,12 +25,24 @@ template class BinarySearchTree<int>;
 template class BinarySearchTree<double>;
 template class BinarySearchTree<std::string>;
 template class BinarySearchTree<char>;
+template class BinarySearchTree<int, AvlBalance>;
+template class BinarySearchTree<double, AvlBalance>;
+template class BinarySearchTree<std::string, AvlBalance>;
+template class BinarySearchTree<char, AvlBalance>;
+template class BinarySearchTree<int, RedBlackBalance>;
+template class BinarySearchTree<double, RedBlackBalance>;
+template class BinarySearchTree<std::string, RedBlackBalance>;
+template class BinarySearchTree<char, RedBlackBalance>;
 
 // TreeNode instantiations
 template struct TreeNode<int>;
 template struct TreeNode<double>;
 template struct TreeNode<std::string>;
 template struct TreeNode<char>;
+template struct SearchTreeNode<int>;
+template struct SearchTreeNode<double>;
+template struct SearchTreeNode<std::string>;
+template struct SearchTreeNode<char>;
 
 // Standalone utility function instantiations
 template bool are_identical<int>(const BinaryTree<int>& tree1, const BinaryTree<int>& tree2);
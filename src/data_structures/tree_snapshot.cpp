@@ -0,0 +1,22 @@
+/**
+ * @file tree_snapshot.cpp
+ * @brief Explicit instantiations for TreeSnapshot
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/tree_snapshot.h"
+#include <string>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit template instantiations for common types
+
+template class TreeSnapshot<int>;
+template class TreeSnapshot<double>;
+template class TreeSnapshot<std::string>;
+template class TreeSnapshot<char>;
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
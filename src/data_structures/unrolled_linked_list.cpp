@@ -0,0 +1,20 @@
+/**
+ * @file unrolled_linked_list.cpp
+ * @brief Explicit instantiations for UnrolledLinkedList
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/unrolled_linked_list.h"
+#include <string>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+// Explicit template instantiations for common types
+template class UnrolledLinkedList<int>;
+template class UnrolledLinkedList<double>;
+template class UnrolledLinkedList<std::string>;
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
@@ -0,0 +1,154 @@
+/**
+ * @file work_stealing_pool.cpp
+ * @brief Implementation file for WorkStealingPool
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/work_stealing_pool.h"
+#include <algorithm>
+#include <limits>
+
+namespace leetcode_study_guide {
+namespace data_structures {
+
+namespace {
+
+// Identifies the pool and deque of the current worker thread
+struct WorkerIdentity {
+    const WorkStealingPool* pool = nullptr;
+    size_t index = 0;
+};
+
+thread_local WorkerIdentity current_worker;
+
+const size_t kNoQueue = std::numeric_limits<size_t>::max();
+
+} // namespace
+
+// TaskGroup Implementation
+
+void WorkStealingPool::TaskGroup::spawn(std::function<void()> task) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.push([this, task = std::move(task)] {
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            if (!error_) error_ = std::current_exception();
+        }
+        pending_.fetch_sub(1, std::memory_order_release);
+    });
+}
+
+void WorkStealingPool::TaskGroup::wait() {
+    drain();
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        std::swap(error, error_);
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+void WorkStealingPool::TaskGroup::drain() {
+    // Help instead of blocking: the tasks we wait for may be queued behind us
+    while (pending_.load(std::memory_order_acquire) > 0) {
+        if (!pool_.run_one(pool_.current_queue())) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// WorkStealingPool Implementation
+
+WorkStealingPool::WorkStealingPool(unsigned threads) : queued_(0), next_queue_(0), stopping_(false) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (unsigned i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    workers_.reserve(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+        workers_.emplace_back([this, i] { worker_loop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::push(std::function<void()> task) {
+    size_t index = current_queue();
+    if (index == kNoQueue) {
+        index = next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    }
+
+    // Count first, so a thief never sees a task that is not yet counted
+    queued_.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+
+    // Taking the sleep mutex orders this wake-up after a sleeper's check
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    wake_.notify_one();
+}
+
+bool WorkStealingPool::run_one(size_t home) {
+    std::function<void()> task;
+
+    // Own deque from the back, then other deques from the front
+    if (home != kNoQueue) {
+        std::lock_guard<std::mutex> lock(queues_[home]->mutex);
+        if (!queues_[home]->tasks.empty()) {
+            task = std::move(queues_[home]->tasks.back());
+            queues_[home]->tasks.pop_back();
+        }
+    }
+    size_t count = queues_.size();
+    size_t start = home == kNoQueue ? 0 : home + 1;
+    for (size_t i = 0; !task && i < count; ++i) {
+        Queue& victim = *queues_[(start + i) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+    if (!task) return false;
+
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    task();
+    return true;
+}
+
+void WorkStealingPool::worker_loop(size_t index) {
+    current_worker.pool = this;
+    current_worker.index = index;
+
+    while (true) {
+        if (run_one(index)) continue;
+
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this] { return stopping_ || queued_.load(std::memory_order_acquire) > 0; });
+        if (stopping_ && queued_.load(std::memory_order_acquire) == 0) return;
+    }
+}
+
+size_t WorkStealingPool::current_queue() const {
+    return current_worker.pool == this ? current_worker.index : kNoQueue;
+}
+
+} // namespace data_structures
+} // namespace leetcode_study_guide
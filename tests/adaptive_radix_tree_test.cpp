@@ -0,0 +1,98 @@
+/**
+ * @file adaptive_radix_tree_test.cpp
+ * @brief Unit tests for AdaptiveRadixTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/adaptive_radix_tree.h"
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+using Entries = std::vector<std::pair<std::string, int>>;
+
+TEST(AdaptiveRadixTreeTest, InsertFindErase) {
+    AdaptiveRadixTree<int> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_TRUE(tree.insert("romane", 1));
+    EXPECT_TRUE(tree.insert("romanus", 2));
+    EXPECT_TRUE(tree.insert("roman", 3));
+    EXPECT_TRUE(tree.insert("", 4));
+    EXPECT_FALSE(tree.insert("roman", 30));
+    EXPECT_EQ(tree.size(), 4);
+    
+    ASSERT_NE(tree.find("roman"), nullptr);
+    EXPECT_EQ(*tree.find("roman"), 30);
+    EXPECT_EQ(*tree.find(""), 4);
+    EXPECT_EQ(tree.find("rom"), nullptr);
+    EXPECT_EQ(tree.find("romanes"), nullptr);
+    
+    EXPECT_TRUE(tree.erase("roman"));
+    EXPECT_FALSE(tree.erase("roman"));
+    EXPECT_FALSE(tree.contains("roman"));
+    EXPECT_TRUE(tree.contains("romane"));
+    EXPECT_TRUE(tree.contains("romanus"));
+    EXPECT_EQ(tree.size(), 3);
+}
+
+TEST(AdaptiveRadixTreeTest, ArbitraryBytesAndNodeGrowth) {
+    AdaptiveRadixTree<std::string> tree;
+    std::vector<std::string> keys;
+    for (int b = 0; b < 256; ++b) {
+        keys.push_back(std::string("k") + static_cast<char>(b) + "v");
+        EXPECT_TRUE(tree.insert(keys.back(), keys.back()));
+    }
+    keys.push_back(std::string("k\0", 2));
+    tree.insert(keys.back(), "nul");
+    
+    for (const auto& key : keys) {
+        ASSERT_TRUE(tree.contains(key));
+    }
+    EXPECT_EQ(*tree.find(std::string("k\0", 2)), "nul");
+    
+    // Shrink back through Node256 -> Node48 -> Node16 -> Node4
+    for (int b = 255; b >= 1; --b) {
+        EXPECT_TRUE(tree.erase(keys[b]));
+    }
+    EXPECT_EQ(tree.size(), 2);
+    EXPECT_TRUE(tree.contains(keys[0]));
+    EXPECT_TRUE(tree.contains(std::string("k\0", 2)));
+}
+
+TEST(AdaptiveRadixTreeTest, OrderedIterationMatchesStdMap) {
+    AdaptiveRadixTree<int> tree;
+    std::map<std::string, int> reference;
+    std::mt19937 rng(42);
+    for (int i = 0; i < 5000; ++i) {
+        std::string key;
+        int length = static_cast<int>(rng() % 6);
+        for (int j = 0; j < length; ++j) key += static_cast<char>("ab\xff\x01"[rng() % 4]);
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(tree.erase(key), reference.erase(key) == 1);
+        } else {
+            EXPECT_EQ(tree.insert(key, i), reference.insert_or_assign(key, i).second);
+        }
+    }
+    ASSERT_EQ(tree.size(), reference.size());
+    
+    Entries visited;
+    tree.for_each([&](const std::string& key, int value) { visited.emplace_back(key, value); });
+    EXPECT_EQ(visited, Entries(reference.begin(), reference.end()));
+    
+    std::vector<std::string> expected;
+    for (const auto& entry : reference) {
+        if (entry.first.compare(0, 2, "ab") == 0) expected.push_back(entry.first);
+    }
+    EXPECT_EQ(tree.keys_with_prefix("ab"), expected);
+    
+    visited.clear();
+    tree.for_each_range("a\xff", "b\x01", [&](const std::string& key, int value) {
+        visited.emplace_back(key, value);
+    });
+    EXPECT_EQ(visited, Entries(reference.lower_bound("a\xff"), reference.lower_bound("b\x01")));
+}
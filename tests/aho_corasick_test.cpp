@@ -0,0 +1,78 @@
+/**
+ * @file aho_corasick_test.cpp
+ * @brief Unit tests for AhoCorasick
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/aho_corasick.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+using Match = AhoCorasick::Match;
+
+TEST(AhoCorasickTest, OverlappingPatterns) {
+    AhoCorasick matcher({"he", "she", "his", "hers"});
+    std::vector<Match> expected = {{1, 1}, {0, 2}, {3, 2}};
+    EXPECT_EQ(matcher.find_all("ushers"), expected);
+    EXPECT_TRUE(matcher.contains_any("this"));
+    EXPECT_FALSE(matcher.contains_any("hxsx"));
+    EXPECT_EQ(matcher.pattern(3), "hers");
+}
+
+TEST(AhoCorasickTest, StreamingAcrossChunks) {
+    AhoCorasick matcher({"needle", "dle", "x"});
+    EXPECT_TRUE(matcher.scan("hay nee").empty());
+    std::vector<Match> expected = {{0, 4}, {1, 7}};
+    EXPECT_EQ(matcher.scan("dle hay"), expected);
+    
+    std::vector<Match> callback_matches;
+    std::string tail = "x";
+    matcher.scan(tail.data(), tail.size(), [&](const Match& m) { callback_matches.push_back(m); });
+    EXPECT_EQ(callback_matches, std::vector<Match>({{2, 14}}));
+    
+    matcher.reset();
+    EXPECT_EQ(matcher.scan("x"), std::vector<Match>({{2, 0}}));
+}
+
+TEST(AhoCorasickTest, BuiltFromTrieMatchesBruteForce) {
+    Trie trie;
+    for (const std::string word : {"a", "ab", "bab", "bc", "bca", "c", "caa"}) {
+        trie.insert(word);
+    }
+    AhoCorasick matcher(trie);
+    ASSERT_EQ(matcher.pattern_count(), 7);
+    
+    std::mt19937 rng(3);
+    std::string text;
+    for (int i = 0; i < 2000; ++i) text += static_cast<char>('a' + rng() % 4);
+    
+    std::vector<Match> expected;
+    for (size_t end = 1; end <= text.size(); ++end) {
+        for (size_t id = 0; id < matcher.pattern_count(); ++id) {
+            const std::string& p = matcher.pattern(id);
+            if (p.size() <= end && text.compare(end - p.size(), p.size(), p) == 0) {
+                expected.push_back({id, end - p.size()});
+            }
+        }
+    }
+    
+    std::vector<Match> streamed;
+    for (size_t pos = 0; pos < text.size(); pos += 37) {
+        auto part = matcher.scan(text.substr(pos, 37));
+        streamed.insert(streamed.end(), part.begin(), part.end());
+    }
+    EXPECT_EQ(matcher.find_all(text), streamed);
+    
+    auto by_position = [](const Match& a, const Match& b) {
+        return a.offset != b.offset ? a.offset < b.offset : a.pattern_id < b.pattern_id;
+    };
+    std::sort(streamed.begin(), streamed.end(), by_position);
+    std::sort(expected.begin(), expected.end(), by_position);
+    EXPECT_EQ(streamed, expected);
+}
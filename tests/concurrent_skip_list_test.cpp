@@ -0,0 +1,182 @@
+/**
+ * @file concurrent_skip_list_test.cpp
+ * @brief Unit tests for ConcurrentSkipList
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/concurrent_skip_list.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+TEST(ConcurrentSkipListTest, BasicOperations) {
+    ConcurrentSkipList<int, std::string> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.insert(5, "five"));
+    EXPECT_TRUE(map.insert(1, "one"));
+    EXPECT_TRUE(map.insert(9, "nine"));
+    EXPECT_FALSE(map.insert(5, "FIVE"));
+    EXPECT_EQ(map.size(), 3u);
+
+    EXPECT_TRUE(map.contains(1));
+    EXPECT_FALSE(map.contains(2));
+    EXPECT_EQ(map.find(5), std::optional<std::string>("five"));
+    EXPECT_EQ(map.find(6), std::nullopt);
+
+    EXPECT_EQ(map.lower_bound(2)->first, 5);
+    EXPECT_EQ(map.lower_bound(9)->second, "nine");
+    EXPECT_FALSE(map.lower_bound(10).has_value());
+
+    EXPECT_TRUE(map.erase(5));
+    EXPECT_FALSE(map.erase(5));
+    EXPECT_FALSE(map.contains(5));
+    EXPECT_EQ(map.lower_bound(2)->first, 9);
+    EXPECT_EQ(map.size(), 2u);
+}
+
+TEST(ConcurrentSkipListTest, RangeScan) {
+    ConcurrentSkipList<int, int> map;
+    for (int i = 0; i < 100; i += 3) {
+        map.insert(i, i * i);
+    }
+
+    auto entries = map.range(10, 20);
+    std::vector<std::pair<int, int>> expected = {{12, 144}, {15, 225}, {18, 324}};
+    EXPECT_EQ(entries, expected);
+    EXPECT_TRUE(map.range(50, 40).empty());
+
+    int count = 0;
+    map.for_each_in_range(0, 99, [&count](int, int) { ++count; });
+    EXPECT_EQ(count, 34);
+}
+
+TEST(ConcurrentSkipListTest, MatchesStdMapSingleThreaded) {
+    ConcurrentSkipList<std::string, int> map;
+    std::map<std::string, int> reference;
+    std::mt19937 rng(48);
+
+    for (int step = 0; step < 5000; ++step) {
+        std::string key = std::to_string(rng() % 300);
+        if (rng() % 3 == 0) {
+            ASSERT_EQ(map.erase(key), reference.erase(key) == 1);
+        } else {
+            ASSERT_EQ(map.insert(key, step), reference.emplace(key, step).second);
+        }
+    }
+
+    EXPECT_EQ(map.size(), reference.size());
+    std::vector<std::pair<std::string, int>> expected(reference.begin(), reference.end());
+    EXPECT_EQ(map.range("", "~"), expected);
+}
+
+TEST(ConcurrentSkipListTest, ConcurrentDisjointInserts) {
+    ConcurrentSkipList<int, int> map;
+    const int threads = 4;
+    const int per_thread = 5000;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&map, t] {
+            for (int i = 0; i < per_thread; ++i) {
+                map.insert(i * threads + t, t);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    EXPECT_EQ(map.size(), static_cast<size_t>(threads * per_thread));
+    auto entries = map.range(0, threads * per_thread);
+    ASSERT_EQ(entries.size(), static_cast<size_t>(threads * per_thread));
+    for (int i = 0; i < threads * per_thread; ++i) {
+        EXPECT_EQ(entries[i].first, i);
+        EXPECT_EQ(entries[i].second, i % threads);
+    }
+}
+
+TEST(ConcurrentSkipListTest, ConcurrentMixedWorkload) {
+    // Threads race on a small key range; each key's net insert count must
+    // end up 0 or 1 and match presence in the map
+    ConcurrentSkipList<int, int> map;
+    const int keys = 64;
+    std::vector<std::atomic<int>> balance(keys);
+    for (auto& b : balance) b = 0;
+    std::atomic<bool> reader_failed(false);
+    std::atomic<bool> stop(false);
+
+    std::thread reader([&] {
+        while (!stop) {
+            int previous = -1;
+            map.for_each_in_range(0, keys, [&](int key, int value) {
+                if (key <= previous || value != key * 2) reader_failed = true;
+                previous = key;
+            });
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&, t] {
+            std::mt19937 rng(t);
+            for (int step = 0; step < 20000; ++step) {
+                int key = static_cast<int>(rng() % keys);
+                if (rng() % 2 == 0) {
+                    if (map.insert(key, key * 2)) ++balance[key];
+                } else {
+                    if (map.erase(key)) --balance[key];
+                }
+            }
+        });
+    }
+    for (auto& writer : writers) writer.join();
+    stop = true;
+    reader.join();
+
+    EXPECT_FALSE(reader_failed);
+    size_t present = 0;
+    for (int key = 0; key < keys; ++key) {
+        ASSERT_TRUE(balance[key] == 0 || balance[key] == 1);
+        EXPECT_EQ(map.contains(key), balance[key] == 1);
+        present += balance[key];
+    }
+    EXPECT_EQ(map.size(), present);
+}
+
+TEST(ConcurrentSkipListTest, ManyLiveReaderThreads) {
+    // More live threads than one chunk of reclaimer slots, all pinned at
+    // once, while a writer keeps retiring towers
+    ConcurrentSkipList<int, int> map;
+    for (int key = 0; key < 100; ++key) map.insert(key, key);
+    const int readers = 300;
+    std::atomic<int> pinned(0);
+    std::atomic<int> found(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < readers; ++t) {
+        threads.emplace_back([&, t] {
+            EpochReclaimer::Guard guard;
+            if (map.contains(t % 100)) ++found;
+            ++pinned;
+            while (pinned < readers) std::this_thread::yield();
+        });
+    }
+    for (int step = 1; step <= 1000; ++step) {
+        map.insert(100 + step, step);
+        map.erase(100 + step - 1);
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(found.load(), readers);
+    EXPECT_EQ(map.size(), 101u);
+
+    // Slots in the grown chunks must not hold the epoch back once released
+    uint64_t before = EpochReclaimer::instance().epoch();
+    EpochReclaimer::instance().collect();
+    EXPECT_GT(EpochReclaimer::instance().epoch(), before);
+}
@@ -0,0 +1,82 @@
+/**
+ * @file concurrent_trie_test.cpp
+ * @brief Unit tests for ConcurrentTrie and EpochReclaimer
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/concurrent_trie.h"
+#include "leetcode_study_guide/data_structures/heap.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+TEST(ConcurrentTrieTest, MatchesTrieSingleThreaded) {
+    ConcurrentTrie concurrent;
+    Trie reference;
+    std::mt19937 rng(11);
+    for (int i = 0; i < 4000; ++i) {
+        std::string word;
+        int length = static_cast<int>(rng() % 6);
+        for (int j = 0; j < length; ++j) word += static_cast<char>('a' + rng() % 3);
+        
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(concurrent.remove(word), reference.remove(word)) << word;
+        } else {
+            EXPECT_EQ(concurrent.insert(word), !reference.search(word)) << word;
+            reference.insert(word);
+        }
+        
+        std::string prefix = word.substr(0, rng() % 3);
+        ASSERT_EQ(concurrent.count_words_with_prefix(prefix), reference.count_words_with_prefix(prefix));
+        ASSERT_EQ(concurrent.auto_complete(prefix, 4), reference.auto_complete(prefix, 4));
+        ASSERT_EQ(concurrent.search(word), reference.search(word));
+    }
+    EXPECT_EQ(concurrent.size(), reference.size());
+    
+    concurrent.clear();
+    EXPECT_TRUE(concurrent.empty());
+    EXPECT_FALSE(concurrent.starts_with("a"));
+}
+
+TEST(ConcurrentTrieTest, ReadersSeeConsistentSnapshotsDuringWrites) {
+    ConcurrentTrie trie;
+    std::vector<std::string> stable = {"apple", "apply", "banana", "band", "can"};
+    for (const auto& word : stable) trie.insert(word);
+    
+    std::atomic<bool> done(false);
+    std::atomic<int> failures(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&]() {
+            while (!done.load()) {
+                for (const auto& word : stable) {
+                    if (!trie.search(word)) failures++;
+                }
+                // Churned words share prefixes with the stable ones
+                if (trie.count_words_with_prefix("app") < 2) failures++;
+                if (trie.auto_complete("ban", 2).size() != 2) failures++;
+            }
+        });
+    }
+    
+    std::mt19937 rng(5);
+    for (int i = 0; i < 20000; ++i) {
+        std::string word = (rng() % 2 ? "app" : "ban") + std::to_string(rng() % 50);
+        if (rng() % 2) {
+            trie.insert(word);
+        } else {
+            trie.remove(word);
+        }
+    }
+    done = true;
+    for (auto& reader : readers) reader.join();
+    
+    EXPECT_EQ(failures.load(), 0);
+    EpochReclaimer::instance().collect();
+}
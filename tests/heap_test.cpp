@@ -6,9 +6,12 @@
  */
 
 #include "leetcode_study_guide/data_structures/heap.h"
+#include "leetcode_study_guide/data_structures/frozen_trie.h"
 #include <gtest/gtest.h>
 #include <vector>
 #include <algorithm>
+#include <cstdio>
+#include <stdexcept>
 
 using namespace leetcode_study_guide::data_structures;
 
@@ -349,6 +352,36 @@ TEST(TrieEdgeCasesTest, SingleCharacterWords) {
     EXPECT_FALSE(single_char_trie.starts_with("d"));
 }
 
+TEST(TrieEdgeCasesTest, LabelsSurviveMergesAndClear) {
+    Trie trie;
+    // Wide fan-out moves the root's children into pooled blocks
+    for (int c = 0; c < 64; ++c) trie.insert(std::string(1, static_cast<char>('0' + c)) + "tail");
+    trie.insert("romane");
+    trie.insert("romanus");
+    trie.insert("romulus");
+    
+    // Removing a branch merges the split edges back together
+    EXPECT_TRUE(trie.remove("romulus"));
+    EXPECT_TRUE(trie.remove("romane"));
+    EXPECT_TRUE(trie.search("romanus"));
+    EXPECT_EQ(trie.get_words_with_prefix("rom"), std::vector<std::string>{"romanus"});
+    trie.insert("rubens");
+    EXPECT_TRUE(trie.search("romanus"));
+    EXPECT_TRUE(trie.search("rubens"));
+    EXPECT_EQ(trie.size(), 66);
+    
+    trie.clear();
+    EXPECT_TRUE(trie.empty());
+    EXPECT_EQ(trie.node_count(), 1);
+    EXPECT_FALSE(trie.starts_with("0"));
+    
+    // The released arenas are usable again
+    for (int c = 0; c < 64; ++c) trie.insert(std::string(1, static_cast<char>('0' + c)));
+    EXPECT_EQ(trie.size(), 64);
+    EXPECT_TRUE(trie.search("o"));
+    EXPECT_FALSE(trie.search("otail"));
+}
+
 TEST(HeapUtilityEdgeCasesTest, EmptyArrayOperations) {
     std::vector<int> empty_arr;
     
@@ -369,4 +402,660 @@ TEST(HeapUtilityEdgeCasesTest, MergeEmptyArrays) {
     result = merge_k_sorted_arrays(arrays_with_empty);
     std::vector<int> expected = {1, 2, 3, 4};
     EXPECT_EQ(result, expected);
+}
+// Loser Tree Merge Tests
+
+TEST(LoserTreeMergeTest, MatchesHeapMerge) {
+    std::vector<std::vector<int>> arrays = {
+        {1, 4, 5, 9},
+        {},
+        {1, 3, 4},
+        {2, 6},
+        {0, 7, 8, 10, 11}
+    };
+    
+    EXPECT_EQ(loser_tree_merge(arrays), merge_k_sorted_arrays(arrays));
+    EXPECT_TRUE(loser_tree_merge(std::vector<std::vector<int>>{}).empty());
+    EXPECT_EQ(loser_tree_merge(std::vector<std::vector<int>>{{3, 5}}), (std::vector<int>{3, 5}));
+}
+
+TEST(LoserTreeMergeTest, CustomComparator) {
+    std::vector<std::vector<int>> arrays = {{9, 4, 1}, {8, 7, 2}, {5}};
+    std::vector<int> merged = loser_tree_merge(arrays, std::greater<int>());
+    std::vector<int> expected = {9, 8, 7, 5, 4, 2, 1};
+    EXPECT_EQ(merged, expected);
+}
+
+TEST(LoserTreeMergeTest, StableWithOneComparisonPerLevel) {
+    // 8 runs of (key, run) pairs with many equal keys, compared by key only
+    const size_t runs = 8;
+    const size_t per_run = 100;
+    std::vector<std::vector<std::pair<int, int>>> arrays(runs);
+    for (size_t run = 0; run < runs; ++run) {
+        for (size_t i = 0; i < per_run; ++i) {
+            arrays[run].emplace_back(static_cast<int>(i / 4), static_cast<int>(run));
+        }
+    }
+    
+    size_t comparisons = 0;
+    auto by_key = [&comparisons](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        ++comparisons;
+        return a.first < b.first;
+    };
+    std::vector<std::pair<int, int>> merged = loser_tree_merge(arrays, by_key);
+    
+    ASSERT_EQ(merged.size(), runs * per_run);
+    EXPECT_TRUE(std::is_sorted(merged.begin(), merged.end()));  // Equal keys keep run order
+    // log2(8) = 3 comparisons per element, plus k - 1 to build the tree
+    EXPECT_LE(comparisons, runs * per_run * 3 + runs - 1);
+}
+
+TEST(LoserTreeMergeTest, MultisequenceSelectSplitsByRank) {
+    std::vector<std::vector<int>> arrays = {{1, 2, 2, 2, 5}, {2, 2, 3}, {0, 2, 9}};
+    
+    for (size_t rank = 0; rank <= 11; ++rank) {
+        std::vector<size_t> split = multisequence_select(arrays, rank);
+        size_t sum = 0;
+        for (size_t i = 0; i < arrays.size(); ++i) {
+            sum += split[i];
+            for (size_t j = 0; j < arrays.size(); ++j) {
+                // Everything left of a split must not exceed anything right of another
+                if (split[i] > 0 && split[j] < arrays[j].size()) {
+                    EXPECT_LE(arrays[i][split[i] - 1], arrays[j][split[j]]);
+                }
+            }
+        }
+        EXPECT_EQ(sum, rank);
+    }
+    
+    EXPECT_THROW(multisequence_select(arrays, 12), std::out_of_range);
+}
+
+TEST(LoserTreeMergeTest, ParallelMatchesSequential) {
+    std::vector<std::vector<int>> arrays(37);
+    unsigned seed = 12345;
+    for (size_t i = 0; i < arrays.size(); ++i) {
+        size_t length = (i * 7919) % 20000;
+        for (size_t j = 0; j < length; ++j) {
+            seed = seed * 1103515245 + 12345;
+            arrays[i].push_back(static_cast<int>((seed >> 16) % 1000));
+        }
+        std::sort(arrays[i].begin(), arrays[i].end());
+    }
+    
+    std::vector<int> expected = loser_tree_merge(arrays);
+    EXPECT_TRUE(std::is_sorted(expected.begin(), expected.end()));
+    EXPECT_EQ(parallel_loser_tree_merge(arrays, 4), expected);
+    EXPECT_EQ(parallel_loser_tree_merge(arrays, 1), expected);
+}
+
+TEST(LoserTreeMergeTest, ParallelRethrowsComparatorErrors) {
+    // Every input ends in the poison value, so the slices that reach it
+    // throw from worker threads and from the calling thread alike
+    const int poison = 1 << 30;
+    std::vector<std::vector<int>> arrays(8);
+    for (size_t i = 0; i < arrays.size(); ++i) {
+        for (int j = 0; j < 50000; ++j) {
+            arrays[i].push_back(j);
+        }
+        arrays[i].push_back(poison);
+    }
+    auto comp = [poison](int a, int b) {
+        if (a == poison || b == poison) {
+            throw std::runtime_error("poisoned comparison");
+        }
+        return a < b;
+    };
+    
+    EXPECT_THROW(parallel_loser_tree_merge(arrays, 4, comp), std::runtime_error);
+}
+
+// Top-K Accumulator Tests
+
+TEST(TopKAccumulatorTest, StreamingLargest) {
+    TopKAccumulator<int> top_k(3);
+    EXPECT_TRUE(top_k.empty());
+    EXPECT_THROW(top_k.threshold(), std::runtime_error);
+    
+    for (int value : {5, 1, 9, 3, 7}) {
+        top_k.push(value);
+    }
+    EXPECT_TRUE(top_k.full());
+    EXPECT_EQ(top_k.threshold(), 5);
+    
+    // Values not beating the threshold are rejected
+    EXPECT_FALSE(top_k.push(4));
+    EXPECT_FALSE(top_k.push(5));
+    EXPECT_TRUE(top_k.push(8));
+    
+    std::vector<int> expected = {9, 8, 7};
+    EXPECT_EQ(top_k.result(), expected);
+}
+
+TEST(TopKAccumulatorTest, BatchesAndSmallest) {
+    TopKAccumulator<int, std::less<int>> top_k(4);
+    std::vector<int> batch1 = {10, 4, 8};
+    std::vector<int> batch2 = {6, 2, 12, 1, 9};
+    top_k.push_range(batch1.begin(), batch1.end());
+    top_k.push_range(batch2.begin(), batch2.end());
+    
+    std::vector<int> expected = {1, 2, 4, 6};
+    EXPECT_EQ(top_k.result(), expected);
+    EXPECT_EQ(top_k.size(), 4);
+    
+    TopKAccumulator<int> none(0);
+    EXPECT_FALSE(none.push(1));
+    none.push_range(batch2.begin(), batch2.end());
+    TopKAccumulator<int> other(0);
+    other.push(5);
+    none.merge(other);
+    EXPECT_TRUE(none.result().empty());
+    EXPECT_EQ(none.size(), 0u);
+}
+
+TEST(TopKAccumulatorTest, MergeAndParallelReduction) {
+    std::vector<int> values(300000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>((i * 2654435761u) % 1000003);
+    }
+    
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+    std::vector<int> expected(sorted.begin(), sorted.begin() + 25);
+    
+    TopKAccumulator<int> left(25), right(25);
+    left.push_range(values.begin(), values.begin() + 1000);
+    right.push_range(values.begin() + 1000, values.end());
+    left.merge(right);
+    EXPECT_EQ(left.result(), expected);
+    
+    EXPECT_EQ(parallel_top_k(values.begin(), values.end(), 25, 4).result(), expected);
+    EXPECT_TRUE(parallel_top_k(values.begin(), values.end(), 0, 4).result().empty());
+}
+
+TEST(TopKAccumulatorTest, ParallelRethrowsComparatorErrors) {
+    std::vector<int> values(300000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i);
+    }
+    auto comp = [](int a, int b) {
+        if (a < 0 || b < 0) {
+            throw std::runtime_error("negative value");
+        }
+        return a > b;
+    };
+    
+    // Poison the first slice (calling thread) and the last one (a worker)
+    values.front() = -1;
+    values.back() = -1;
+    EXPECT_THROW(parallel_top_k(values.begin(), values.end(), 10, 4, comp), std::runtime_error);
+}
+
+// Min-Max Heap Tests
+
+TEST(MinMaxHeapTest, BasicOperations) {
+    MinMaxHeap<int> heap({4, 1, 3, 2, 16, 9, 10, 14, 8, 7});
+    EXPECT_TRUE(heap.is_heap());
+    EXPECT_EQ(heap.size(), 10);
+    EXPECT_EQ(heap.min(), 1);
+    EXPECT_EQ(heap.max(), 16);
+    
+    EXPECT_EQ(heap.pop_max(), 16);
+    EXPECT_EQ(heap.pop_min(), 1);
+    EXPECT_EQ(heap.max(), 14);
+    EXPECT_EQ(heap.min(), 2);
+    EXPECT_TRUE(heap.is_heap());
+    
+    heap.push(0);
+    heap.push(20);
+    EXPECT_EQ(heap.min(), 0);
+    EXPECT_EQ(heap.max(), 20);
+    EXPECT_TRUE(heap.is_heap());
+}
+
+TEST(MinMaxHeapTest, MatchesSortedOrderFromBothEnds) {
+    std::vector<int> values;
+    for (int i = 0; i < 500; ++i) {
+        values.push_back((i * 7919) % 263);
+    }
+    
+    MinMaxHeap<int> heap;
+    for (int value : values) {
+        heap.push(value);
+    }
+    EXPECT_TRUE(heap.is_heap());
+    
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    size_t lo = 0, hi = sorted.size();
+    while (!heap.empty()) {
+        if ((lo + hi) % 3 == 0) {
+            EXPECT_EQ(heap.pop_max(), sorted[--hi]);
+        } else {
+            EXPECT_EQ(heap.pop_min(), sorted[lo++]);
+        }
+    }
+    EXPECT_EQ(lo, hi);
+}
+
+TEST(MinMaxHeapTest, BoundedBufferKeepsBest) {
+    MinMaxHeap<int> best;
+    for (int value : {50, 10, 40, 70, 20, 60, 30, 5}) {
+        best.push_bounded(value, 4);
+    }
+    
+    EXPECT_EQ(best.size(), 4);
+    EXPECT_EQ(best.min(), 5);
+    EXPECT_EQ(best.max(), 30);
+    EXPECT_FALSE(best.push_bounded(100, 4));
+    EXPECT_TRUE(best.push_bounded(1, 4));
+    EXPECT_EQ(best.max(), 20);
+    EXPECT_TRUE(best.is_heap());
+    
+    EXPECT_EQ(best.replace_min(25), 1);
+    EXPECT_EQ(best.min(), 5);
+    EXPECT_EQ(best.max(), 25);
+    EXPECT_TRUE(best.is_heap());
+}
+
+TEST(MinMaxHeapTest, EmptyHeap) {
+    MinMaxHeap<int> heap;
+    EXPECT_TRUE(heap.is_heap());
+    EXPECT_THROW(heap.min(), std::runtime_error);
+    EXPECT_THROW(heap.max(), std::runtime_error);
+    EXPECT_THROW(heap.pop_min(), std::runtime_error);
+    EXPECT_THROW(heap.pop_max(), std::runtime_error);
+    EXPECT_FALSE(heap.push_bounded(1, 0));
+}
+
+namespace {
+// Counts move-assignments of an element onto itself.
+struct SelfMoveProbe {
+    static int self_moves;
+    int value = 0;
+
+    explicit SelfMoveProbe(int v = 0) : value(v) {}
+    SelfMoveProbe(const SelfMoveProbe&) = default;
+    SelfMoveProbe(SelfMoveProbe&&) = default;
+    SelfMoveProbe& operator=(const SelfMoveProbe&) = default;
+    SelfMoveProbe& operator=(SelfMoveProbe&& other) {
+        if (this == &other) ++self_moves;
+        value = other.value;
+        return *this;
+    }
+    bool operator<(const SelfMoveProbe& other) const { return value < other.value; }
+};
+int SelfMoveProbe::self_moves = 0;
+}  // namespace
+
+TEST(MinMaxHeapTest, PopLastSlotDoesNotSelfMove) {
+    SelfMoveProbe::self_moves = 0;
+
+    MinMaxHeap<SelfMoveProbe> single;
+    single.push(SelfMoveProbe(7));
+    EXPECT_EQ(single.pop_min().value, 7);
+    EXPECT_TRUE(single.empty());
+
+    // With two elements the max sits in the last slot.
+    MinMaxHeap<SelfMoveProbe> pair;
+    pair.push(SelfMoveProbe(1));
+    pair.push(SelfMoveProbe(2));
+    EXPECT_EQ(pair.pop_max().value, 2);
+    EXPECT_EQ(pair.pop_max().value, 1);
+    EXPECT_TRUE(pair.empty());
+
+    EXPECT_EQ(SelfMoveProbe::self_moves, 0);
+}
+
+// Move-Aware Heap API Tests
+
+TEST(HeapMoveTest, EmplaceMoveAndPopInto) {
+    MinHeap<std::string> heap;
+    heap.reserve(8);
+    
+    std::string word = "pear";
+    heap.push(std::move(word));
+    heap.emplace(3, 'z');
+    heap.emplace("apple");
+    heap.push(std::string("fig"));
+    
+    std::string out;
+    heap.pop(out);
+    EXPECT_EQ(out, "apple");
+    EXPECT_EQ(heap.replace_top(std::string("kiwi")), "fig");
+    EXPECT_EQ(heap.top(), "kiwi");
+    EXPECT_TRUE(heap.is_heap());
+    EXPECT_THROW(MinHeap<std::string>().pop(out), std::runtime_error);
+}
+
+TEST(HeapMoveTest, PushRangeHeapifiesOnce) {
+    MinHeap<int> heap({5, 3});
+    std::vector<int> batch = {9, 1, 7, 2, 8};
+    heap.push_range(batch.begin(), batch.end());
+    EXPECT_EQ(heap.size(), 7);
+    EXPECT_EQ(heap.top(), 1);
+    EXPECT_TRUE(heap.is_heap());
+    
+    std::vector<int> small = {0};
+    heap.push_range(small.begin(), small.end());
+    EXPECT_EQ(heap.top(), 0);
+    EXPECT_TRUE(heap.is_heap());
+}
+
+TEST(HeapMoveTest, DrainSortedEmptiesHeap) {
+    MaxHeap<int> heap(std::vector<int>{4, 1, 3, 2, 16, 9, 10});
+    std::vector<int> copy_sorted = heap.heap_sort();
+    EXPECT_EQ(heap.size(), 7);
+    
+    std::vector<int> sorted = heap.drain_sorted();
+    std::vector<int> expected = {16, 10, 9, 4, 3, 2, 1};
+    EXPECT_EQ(sorted, expected);
+    EXPECT_EQ(copy_sorted, expected);
+    EXPECT_TRUE(heap.empty());
+    
+    std::vector<int> arr = {5, 2, 8, 1, 9};
+    MinHeap<int>::heap_sort_array(arr);
+    EXPECT_TRUE(std::is_sorted(arr.begin(), arr.end()));
+}
+
+// Radix Trie Tests
+
+TEST(RadixTrieTest, PathCompressionAndSplits) {
+    Trie trie;
+    trie.insert("international");
+    EXPECT_EQ(trie.node_count(), 2); // Root plus one compressed edge
+    
+    trie.insert("internet");
+    trie.insert("inter");
+    EXPECT_EQ(trie.node_count(), 5); // "inter" split off, then "national" and "net"
+    EXPECT_TRUE(trie.search("inter"));
+    EXPECT_FALSE(trie.search("intern"));
+    EXPECT_TRUE(trie.starts_with("intern"));
+    EXPECT_EQ(trie.count_words_with_prefix("int"), 3);
+    EXPECT_EQ(trie.count_words_with_prefix("interna"), 1);
+    
+    std::vector<std::string> expected = {"inter", "international", "internet"};
+    EXPECT_EQ(trie.get_words_with_prefix("in"), expected);
+    EXPECT_EQ(trie.get_words_with_prefix("internat"), std::vector<std::string>{"international"});
+}
+
+TEST(RadixTrieTest, RemoveRecompressesPaths) {
+    Trie trie;
+    trie.insert("test");
+    trie.insert("team");
+    trie.insert("tea");
+    size_t nodes = trie.node_count();
+    
+    EXPECT_TRUE(trie.remove("tea"));
+    EXPECT_FALSE(trie.remove("tea"));
+    EXPECT_LT(trie.node_count(), nodes);
+    EXPECT_TRUE(trie.search("team"));
+    EXPECT_EQ(trie.count_words_with_prefix("te"), 2);
+    
+    EXPECT_TRUE(trie.remove("test"));
+    EXPECT_EQ(trie.node_count(), 2); // Only "team" remains as a single edge
+    EXPECT_EQ(trie.get_all_words(), std::vector<std::string>{"team"});
+    
+    trie.insert("team");
+    EXPECT_EQ(trie.size(), 1);
+    EXPECT_EQ(trie.count_words_with_prefix("t"), 1);
+}
+
+TEST(RadixTrieTest, ArbitraryBytesAndWideFanOut) {
+    Trie trie;
+    std::vector<std::string> words;
+    for (int c = 1; c < 256; c += 3) {
+        words.push_back(std::string("k") + static_cast<char>(c) + "/path");
+    }
+    for (const auto& word : words) {
+        trie.insert(word);
+    }
+    
+    EXPECT_EQ(trie.size(), static_cast<int>(words.size()));
+    for (const auto& word : words) {
+        EXPECT_TRUE(trie.search(word));
+    }
+    EXPECT_EQ(trie.count_words_with_prefix("k"), static_cast<int>(words.size()));
+    
+    // Shrink back through the smaller child representations
+    for (size_t i = 0; i + 2 < words.size(); ++i) {
+        EXPECT_TRUE(trie.remove(words[i]));
+    }
+    EXPECT_EQ(trie.size(), 2);
+    EXPECT_TRUE(trie.search(words.back()));
+    EXPECT_EQ(trie.auto_complete("k", 5).size(), 2);
+}
+
+TEST(FrozenTrieTest, MatchesSourceTrie) {
+    Trie trie;
+    std::vector<std::string> words = {"app", "apple", "application", "apply", "banana",
+                                      "band", "bandana", "can", "candy", "a", ""};
+    for (const auto& word : words) trie.insert(word);
+    
+    FrozenTrie frozen = trie.freeze();
+    EXPECT_EQ(frozen.size(), trie.size());
+    for (const std::string prefix : {"", "a", "ap", "app", "appl", "apple", "b", "band", "c", "x", "bandanas"}) {
+        EXPECT_EQ(frozen.search(prefix), trie.search(prefix)) << prefix;
+        EXPECT_EQ(frozen.starts_with(prefix), trie.starts_with(prefix)) << prefix;
+        EXPECT_EQ(frozen.count_words_with_prefix(prefix), trie.count_words_with_prefix(prefix)) << prefix;
+        EXPECT_EQ(frozen.auto_complete(prefix, 3), trie.auto_complete(prefix, 3)) << prefix;
+    }
+    
+    FrozenTrie empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_FALSE(empty.search("a"));
+    EXPECT_EQ(empty.count_words_with_prefix(""), 0);
+}
+
+TEST(FrozenTrieTest, SaveAndLoadRoundTrip) {
+    Trie trie;
+    std::vector<std::string> words;
+    for (int i = 0; i < 2000; ++i) {
+        words.push_back("word" + std::to_string(i * 7919 % 10007));
+        trie.insert(words.back());
+    }
+    FrozenTrie frozen(trie);
+    EXPECT_LT(frozen.memory_usage(), trie.node_count() * sizeof(Trie::TrieNode));
+    
+    std::string path = ::testing::TempDir() + "frozen_trie_test.bin";
+    frozen.save(path);
+    FrozenTrie loaded = FrozenTrie::load(path, true);  // A well-formed file passes the deep checks
+    std::remove(path.c_str());
+    
+    EXPECT_EQ(loaded.size(), 2000);
+    EXPECT_EQ(loaded.node_count(), frozen.node_count());
+    for (const auto& word : words) {
+        EXPECT_TRUE(loaded.search(word));
+    }
+    EXPECT_FALSE(loaded.search("word"));
+    EXPECT_EQ(loaded.count_words_with_prefix("word1"), trie.count_words_with_prefix("word1"));
+    EXPECT_EQ(loaded.auto_complete("word99", 4), trie.auto_complete("word99", 4));
+    
+    std::vector<unsigned char> garbage(64, 0xAB);
+    EXPECT_THROW(FrozenTrie::from_buffer(garbage.data(), garbage.size()), std::runtime_error);
+    EXPECT_THROW(FrozenTrie::load(path), std::runtime_error);
+}
+
+TEST(FrozenTrieTest, RejectsMalformedBuffers) {
+    Trie trie;
+    for (const std::string word : {"tea", "ten", "to", "inn", "in", "a"}) trie.insert(word);
+    FrozenTrie frozen(trie);
+    
+    std::string path = ::testing::TempDir() + "frozen_trie_malformed.bin";
+    frozen.save(path);
+    std::vector<uint64_t> image(frozen.memory_usage() / sizeof(uint64_t));
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(std::fread(image.data(), sizeof(uint64_t), image.size(), file), image.size());
+    std::fclose(file);
+    std::remove(path.c_str());
+    
+    const size_t bytes = image.size() * sizeof(uint64_t);
+    EXPECT_EQ(FrozenTrie::from_buffer(image.data(), bytes).size(), 6);
+    EXPECT_EQ(FrozenTrie::from_buffer(image.data(), bytes, true).size(), 6);
+    
+    // Header words: magic, node count, word count, LOUDS bit count.
+    // Header and size problems are caught without verify
+    auto rejects = [&](size_t index, uint64_t value, bool verify) {
+        std::vector<uint64_t> broken = image;
+        broken[index] = value;
+        EXPECT_THROW(FrozenTrie::from_buffer(broken.data(), bytes, verify), std::runtime_error)
+            << index << " " << value;
+    };
+    rejects(1, ~uint64_t(0), false);      // Node count no buffer could hold
+    rejects(1, uint64_t(1) << 62, false); // Layout would overflow
+    rejects(1, image[1] - 1, false);      // LOUDS length no longer 2n - 1
+    rejects(2, image[1] + 1, false);      // More words than nodes
+    rejects(3, image[3] + 2, false);
+    rejects(3, ~uint64_t(0), false);
+    EXPECT_THROW(FrozenTrie::from_buffer(image.data(), bytes - sizeof(uint64_t)), std::runtime_error);
+    
+    rejects(2, image[2] - 1, true);       // Terminal bits disagree with the count
+    rejects(4, image[4] ^ 1, true);       // LOUDS bits disagree with the directory
+    rejects(4, ~uint64_t(0) << 1, true);  // Padding bits set
+    
+    // Shifting in a leading zero (and dropping the final one) keeps every
+    // count and the directory intact, but makes node 1 its own child
+    ASSERT_LT(image[3], 64u);
+    rejects(4, (image[4] << 1) & ((uint64_t(1) << image[3]) - 1), true);
+}
+
+TEST(TrieTopKTest, RankedCompletionsWithAndWithoutCache) {
+    Trie trie;
+    trie.insert("car", 5);
+    trie.insert("card", 9);
+    trie.insert("care", 9);
+    trie.insert("cart", 1);
+    trie.insert("cat", 7);
+    trie.insert("dog", 100);
+    
+    auto expect_words = [](const std::vector<Trie::Completion>& got, std::vector<std::string> want) {
+        std::vector<std::string> words;
+        for (const auto& c : got) words.push_back(c.word);
+        EXPECT_EQ(words, want);
+    };
+    
+    expect_words(trie.top_completions("ca", 3), {"card", "care", "cat"});
+    trie.enable_top_k_cache(3);
+    EXPECT_EQ(trie.top_k_cache_size(), 3);
+    expect_words(trie.top_completions("ca", 3), {"card", "care", "cat"});
+    expect_words(trie.top_completions("", 2), {"dog", "card"});
+    
+    // Promotion, demotion and removal keep every cached list exact
+    trie.insert("cart", 50);
+    expect_words(trie.top_completions("car", 2), {"cart", "card"});
+    trie.insert("card", 0);
+    expect_words(trie.top_completions("c", 3), {"cart", "care", "cat"});
+    EXPECT_TRUE(trie.remove("cart"));
+    expect_words(trie.top_completions("ca", 3), {"care", "cat", "car"});
+    
+    // Requests deeper than the cache fall back to a subtree scan
+    expect_words(trie.top_completions("ca", 4), {"care", "cat", "car", "card"});
+    EXPECT_EQ(trie.top_completions("ca", 1)[0].score, 9);
+    EXPECT_TRUE(trie.top_completions("x").empty());
+    
+    trie.enable_top_k_cache(0);
+    expect_words(trie.top_completions("ca", 2), {"care", "cat"});
+}
+
+TEST(TrieTopKTest, RemovedWordLosesItsScore) {
+    for (int cache : {0, 2}) {
+        // "ab" keeps its node after removal because it has two children
+        Trie trie;
+        trie.enable_top_k_cache(cache);
+        trie.insert("ab", 100);
+        trie.insert("abc", 3);
+        trie.insert("abd", 2);
+        EXPECT_TRUE(trie.remove("ab"));
+        
+        std::vector<Trie::Completion> top = trie.top_completions("a", 2);
+        ASSERT_EQ(top.size(), 2u);
+        EXPECT_EQ(top[0].word, "abc");
+        EXPECT_EQ(top[1].word, "abd");
+        
+        trie.insert("ab");
+        top = trie.top_completions("a", 2);
+        ASSERT_EQ(top.size(), 2u);
+        EXPECT_EQ(top[0].word, "abc");
+        EXPECT_EQ(top[0].score, 3);
+        EXPECT_EQ(top[1].word, "abd");
+        EXPECT_EQ(trie.top_completions("ab", 3).back().word, "ab");
+        EXPECT_EQ(trie.top_completions("ab", 3).back().score, 0);
+    }
+}
+
+TEST(TrieFuzzyTest, MatchesBruteForceEditDistance) {
+    auto edit_distance = [](const std::string& a, const std::string& b) {
+        std::vector<int> row(b.size() + 1);
+        for (size_t j = 0; j <= b.size(); ++j) row[j] = static_cast<int>(j);
+        for (size_t i = 1; i <= a.size(); ++i) {
+            int diagonal = row[0];
+            row[0] = static_cast<int>(i);
+            for (size_t j = 1; j <= b.size(); ++j) {
+                int above = row[j];
+                row[j] = std::min({above + 1, row[j - 1] + 1, diagonal + (a[i - 1] != b[j - 1] ? 1 : 0)});
+                diagonal = above;
+            }
+        }
+        return row[b.size()];
+    };
+    
+    Trie trie;
+    std::vector<std::string> words = {"kitten", "sitting", "mitten", "bitten", "kitchen", "kit",
+                                      "smitten", "written", "knitting", "", "k", "kitte"};
+    for (const auto& word : words) trie.insert(word);
+    
+    for (const std::string query : {"kitten", "sittin", "", "kiten", "xyz", "kitchens"}) {
+        for (int k = 0; k <= 3; ++k) {
+            std::vector<std::pair<int, std::string>> expected;
+            for (const auto& word : words) {
+                int d = edit_distance(word, query);
+                if (d <= k) expected.emplace_back(d, word);
+            }
+            std::sort(expected.begin(), expected.end());
+            
+            auto matches = trie.fuzzy_search(query, k, 100);
+            ASSERT_EQ(matches.size(), expected.size()) << query << " k=" << k;
+            for (size_t i = 0; i < matches.size(); ++i) {
+                EXPECT_EQ(matches[i].distance, expected[i].first);
+                EXPECT_EQ(matches[i].word, expected[i].second);
+            }
+        }
+    }
+    
+    auto top = trie.fuzzy_search("kitten", 2, 3);
+    ASSERT_EQ(top.size(), 3);
+    EXPECT_EQ(top[0].word, "kitten");
+    EXPECT_EQ(top[1].distance, 1);
+}
+
+TEST(TrieBulkBuildTest, FromSortedMatchesIncrementalInsert) {
+    std::vector<std::string> words = {"", "a", "a", "ab", "abc", "abd", "b", "ba", "banana", "band",
+                                      "bandana", "can", "candy", "candy", "cane"};
+    Trie built = Trie::from_sorted(words.begin(), words.end());
+    Trie inserted;
+    for (const auto& word : words) inserted.insert(word);
+    
+    EXPECT_EQ(built.size(), inserted.size());
+    EXPECT_EQ(built.node_count(), inserted.node_count());
+    EXPECT_EQ(built.get_all_words(), inserted.get_all_words());
+    for (const std::string prefix : {"", "a", "ab", "ban", "band", "c", "cand", "d"}) {
+        EXPECT_EQ(built.count_words_with_prefix(prefix), inserted.count_words_with_prefix(prefix)) << prefix;
+    }
+    
+    // The bulk-built trie stays fully mutable
+    EXPECT_TRUE(built.remove("band"));
+    built.insert("bandit");
+    EXPECT_TRUE(built.search("bandana"));
+    EXPECT_TRUE(built.search("bandit"));
+    EXPECT_FALSE(built.search("band"));
+    
+    built.clear();
+    EXPECT_TRUE(built.empty());
+    EXPECT_EQ(built.node_count(), 1);
+    built.insert("again");
+    EXPECT_TRUE(built.search("again"));
+    
+    std::vector<std::string> unsorted = {"b", "a"};
+    EXPECT_THROW(Trie::from_sorted(unsorted.begin(), unsorted.end()), std::invalid_argument);
 }
\ No newline at end of file
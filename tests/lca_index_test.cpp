@@ -0,0 +1,157 @@
+/**
+ * @file lca_index_test.cpp
+ * @brief Unit tests for LcaIndex
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/lca_index.h"
+#include "tree_test_helpers.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+using leetcode_study_guide::test_helpers::random_tree;
+using leetcode_study_guide::test_helpers::release_tree;
+
+namespace {
+
+// Key whose hash throws for negative values, to fail queries mid-batch
+struct FragileKey {
+    int value;
+    bool operator==(const FragileKey& other) const { return value == other.value; }
+};
+
+} // namespace
+
+namespace std {
+template<>
+struct hash<FragileKey> {
+    size_t operator()(const FragileKey& key) const {
+        if (key.value < 0) throw std::invalid_argument("negative key");
+        return std::hash<int>()(key.value);
+    }
+};
+} // namespace std
+
+TEST(LcaIndexTest, SmallTree) {
+    // Level order [3, 5, 1, 6, 2, 0, 8, _, _, 7, 4]
+    BinaryTree<int> tree;
+    tree.build_from_array({3, 5, 1, 6, 2, 0, 8, -1, -1, 7, 4}, -1);
+    LcaIndex<int> index(tree);
+    EXPECT_EQ(index.size(), 9);
+
+    EXPECT_EQ(index.lowest_common_ancestor(5, 1)->data, 3);
+    EXPECT_EQ(index.lowest_common_ancestor(5, 4)->data, 5);
+    EXPECT_EQ(index.lowest_common_ancestor(7, 4)->data, 2);
+    EXPECT_EQ(index.lowest_common_ancestor(6, 4)->data, 5);
+    EXPECT_EQ(index.lowest_common_ancestor(8, 8)->data, 8);
+    EXPECT_EQ(index.lowest_common_ancestor(7, 42), nullptr);
+
+    EXPECT_EQ(index.find_path(4), std::vector<int>({3, 5, 2, 4}));
+    EXPECT_TRUE(index.find_path(42).empty());
+    EXPECT_EQ(index.depth(index.id_of(7)), 3);
+    EXPECT_EQ(index.distance(index.id_of(6), index.id_of(4)), 3);
+    EXPECT_EQ(index.id_of(42), LcaIndex<int>::kNoNode);
+    EXPECT_THROW(index.lca(0, 9), std::out_of_range);
+}
+
+TEST(LcaIndexTest, IndexesBinarySearchTrees) {
+    BinarySearchTree<int> bst;
+    for (int value : {5, 3, 7, 2, 4, 6, 8}) bst.insert(value);
+    LcaIndex<int, SearchTreeNode<int>> index(bst);
+    EXPECT_EQ(index.size(), 7);
+    EXPECT_EQ(index.lowest_common_ancestor(2, 4)->data, 3);
+    EXPECT_EQ(index.lowest_common_ancestor(4, 6)->data, 5);
+    EXPECT_EQ(index.lowest_common_ancestor(6, 8)->subtree_size, 3u);
+    EXPECT_EQ(index.find_path(6), std::vector<int>({5, 7, 6}));
+}
+
+TEST(LcaIndexTest, MatchesRecursiveLca) {
+    std::mt19937 rng(43);
+    for (int n : {1, 2, 5, 64, 1000}) {
+        BinaryTree<int> tree = random_tree(n, rng);
+        LcaIndex<int> index(tree);
+        ASSERT_EQ(index.size(), static_cast<size_t>(n));
+
+        for (int q = 0; q < 500; ++q) {
+            int a = static_cast<int>(rng() % n);
+            int b = static_cast<int>(rng() % n);
+            ASSERT_EQ(index.lowest_common_ancestor(a, b), tree.lowest_common_ancestor(a, b)) << n;
+        }
+        for (int v = 0; v < n; v += 7) {
+            EXPECT_EQ(index.find_path(v), tree.find_path(v));
+        }
+    }
+}
+
+TEST(LcaIndexTest, DeepChainAndRebuild) {
+    BinaryTree<int> chain;
+    chain.set_root(0);
+    auto current = chain.get_root();
+    for (int i = 1; i < 100000; ++i) {
+        current = chain.insert_left(current, i);
+    }
+    LcaIndex<int> index(chain);
+    EXPECT_EQ(index.lowest_common_ancestor(99999, 500)->data, 500);
+    EXPECT_EQ(index.find_path(99999).size(), 100000);
+
+    BinaryTree<int> small;
+    small.build_from_array({1, 2, 3}, -1);
+    index.rebuild(small);
+    EXPECT_EQ(index.size(), 3);
+    EXPECT_EQ(index.lowest_common_ancestor(2, 3)->data, 1);
+    EXPECT_EQ(index.lowest_common_ancestor(99999, 500), nullptr);
+
+    index.rebuild(BinaryTree<int>());
+    EXPECT_TRUE(index.empty());
+    release_tree(chain);
+}
+
+TEST(LcaIndexTest, ParallelBatches) {
+    std::mt19937 rng(4343);
+    BinaryTree<int> tree = random_tree(20000, rng);
+    LcaIndex<int> index(tree);
+
+    std::vector<std::pair<int, int>> value_queries(50000);
+    std::vector<std::pair<LcaIndex<int>::NodeId, LcaIndex<int>::NodeId>> id_queries;
+    for (auto& query : value_queries) {
+        query = {static_cast<int>(rng() % 20000), static_cast<int>(rng() % 20000)};
+        id_queries.emplace_back(index.id_of(query.first), index.id_of(query.second));
+    }
+
+    auto nodes = index.lowest_common_ancestors(value_queries, 4);
+    auto ids = index.lca_batch(id_queries, 4);
+    auto serial = index.lca_batch(id_queries, 1);
+    ASSERT_EQ(nodes.size(), value_queries.size());
+    EXPECT_EQ(ids, serial);
+    for (size_t i = 0; i < value_queries.size(); i += 97) {
+        EXPECT_EQ(nodes[i], tree.lowest_common_ancestor(value_queries[i].first, value_queries[i].second));
+        EXPECT_EQ(index.node(ids[i]), nodes[i]);
+    }
+
+    id_queries.emplace_back(0, 20000);
+    EXPECT_THROW(index.lca_batch(id_queries), std::out_of_range);
+}
+
+TEST(LcaIndexTest, ParallelBatchRethrowsAfterJoining) {
+    BinaryTree<FragileKey> tree;
+    tree.set_root(FragileKey{1});
+    tree.insert_left(tree.get_root(), FragileKey{2});
+    tree.insert_right(tree.get_root(), FragileKey{3});
+    LcaIndex<FragileKey> index(tree);
+
+    // Bad keys at both ends fail the calling thread's chunk and a worker's
+    std::vector<std::pair<FragileKey, FragileKey>> queries(50000, {FragileKey{2}, FragileKey{3}});
+    queries.front().first = FragileKey{-1};
+    queries.back().second = FragileKey{-1};
+    EXPECT_THROW(index.lowest_common_ancestors(queries, 4), std::invalid_argument);
+
+    queries.front().first = FragileKey{2};
+    queries.back().second = FragileKey{3};
+    auto results = index.lowest_common_ancestors(queries, 4);
+    EXPECT_EQ(results.back()->data.value, 1);
+}
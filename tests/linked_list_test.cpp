@@ -0,0 +1,90 @@
+/**
+ * @file linked_list_test.cpp
+ * @brief Unit tests for iterative list teardown
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/linked_list.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+TEST(LinkedListTeardownTest, LongListsDestroyWithoutRecursion) {
+    // Millions of nodes would overflow the stack with recursive shared_ptr release
+    const int n = 2000000;
+    {
+        SinglyLinkedList<int> list;
+        for (int i = 0; i < n; ++i) list.push_front(i);
+        EXPECT_EQ(list.size(), static_cast<size_t>(n));
+    }
+    {
+        DoublyLinkedList<std::string> list;
+        for (int i = 0; i < n / 4; ++i) list.push_back("node");
+        list.clear();
+        EXPECT_TRUE(list.empty());
+        EXPECT_EQ(list.tail(), nullptr);
+    }
+}
+
+TEST(LinkedListTeardownTest, CopiesKeepSharedNodesAlive) {
+    SinglyLinkedList<int> copy;
+    {
+        SinglyLinkedList<int> list;
+        for (int i = 0; i < 1000; ++i) list.push_front(i);
+        copy = list;  // Shares the nodes with list
+    }
+    EXPECT_EQ(copy.size(), 1000u);
+    EXPECT_EQ(copy.to_vector().front(), 999);
+    EXPECT_EQ(copy.to_vector().back(), 0);
+
+    DoublyLinkedList<int> doubly_copy;
+    {
+        DoublyLinkedList<int> list;
+        for (int i = 0; i < 1000; ++i) list.push_back(i);
+        doubly_copy = list;
+        list.clear();
+    }
+    EXPECT_EQ(doubly_copy.to_vector().size(), 1000u);
+    EXPECT_EQ(doubly_copy.tail()->data, 999);
+}
+
+TEST(LinkedListTeardownTest, HandlesOutliveClearAndTheList) {
+    std::shared_ptr<ListNode<int>> head;
+    std::shared_ptr<ListNode<int>> middle;
+    {
+        SinglyLinkedList<int> list;
+        for (int i = 0; i < 100; ++i) list.push_front(i);
+        head = list.head();
+        list.clear();
+        EXPECT_EQ(head->data, 99);
+        EXPECT_EQ(head->next->data, 98);
+
+        for (int i = 0; i < 5; ++i) list.push_back(i);
+        middle = list.find_middle();
+    }
+    EXPECT_EQ(middle->data, 2);
+    EXPECT_EQ(middle->next->next->data, 4);
+
+    std::shared_ptr<DoublyListNode<std::string>> tail;
+    {
+        DoublyLinkedList<std::string> list;
+        list.push_back("first");
+        list.push_back("last");
+        tail = list.tail();
+    }
+    EXPECT_EQ(tail->data, "last");
+}
+
+TEST(LinkedListTeardownTest, CircularListsReleaseTheirCycle) {
+    // Under LeakSanitizer, a cycle left behind would be reported as a leak
+    CircularLinkedList<std::string> list;
+    list.push_back("only");
+    list.clear();
+    EXPECT_TRUE(list.empty());
+
+    for (int i = 0; i < 100; ++i) list.push_back(std::to_string(i));
+    EXPECT_EQ(list.size(), 100u);
+}
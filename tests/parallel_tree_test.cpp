@@ -0,0 +1,123 @@
+/**
+ * @file parallel_tree_test.cpp
+ * @brief Unit tests for the parallel tree algorithms
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/parallel_tree.h"
+#include "tree_test_helpers.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+using leetcode_study_guide::test_helpers::random_tree;
+using leetcode_study_guide::test_helpers::release_tree;
+
+namespace {
+
+// Complete tree of the given height whose values are mirror symmetric
+BinaryTree<int> symmetric_tree(int height) {
+    BinaryTree<int> tree;
+    tree.set_root(0);
+    std::vector<BinaryTree<int>::NodePtr> level = {tree.get_root()};
+    for (int depth = 1; depth < height; ++depth) {
+        std::vector<BinaryTree<int>::NodePtr> next;
+        for (size_t i = 0; i < level.size(); ++i) {
+            int mirror = static_cast<int>(std::min(i, level.size() - 1 - i));
+            next.push_back(tree.insert_left(level[i], 2 * mirror + depth));
+            next.push_back(tree.insert_right(level[i], 2 * mirror + depth + 1));
+        }
+        // Children of mirrored parents must mirror each other too
+        for (size_t i = 0; i < next.size() / 2; ++i) {
+            next[next.size() - 1 - i]->data = next[i]->data;
+        }
+        level = next;
+    }
+    return tree;
+}
+
+} // namespace
+
+class ParallelTreeTest : public ::testing::Test {
+protected:
+    WorkStealingPool pool{4};
+};
+
+TEST_F(ParallelTreeTest, MatchesSequentialOnRandomTrees) {
+    std::mt19937 rng(47);
+    for (int n : {0, 1, 2, 3, 100, 5000}) {
+        BinaryTree<int> tree = random_tree(n, rng);
+        for (int fork_depth : {-1, 0, 3, 20}) {
+            EXPECT_EQ(parallel_height(tree, pool, fork_depth), tree.height());
+            EXPECT_EQ(parallel_count_nodes(tree, pool, fork_depth), tree.count_nodes());
+            EXPECT_EQ(parallel_is_balanced(tree, pool, fork_depth), tree.is_balanced());
+            EXPECT_EQ(parallel_is_symmetric(tree, pool, fork_depth), tree.is_symmetric());
+            EXPECT_EQ(parallel_tree_diameter(tree, pool, fork_depth), tree_diameter(tree));
+            EXPECT_TRUE(parallel_are_identical(tree, tree, pool, fork_depth));
+        }
+    }
+}
+
+TEST_F(ParallelTreeTest, BalancedAndSymmetricTrees) {
+    BinaryTree<int> tree = symmetric_tree(12);
+    EXPECT_EQ(parallel_count_nodes(tree, pool), 4095u);
+    EXPECT_EQ(parallel_height(tree, pool), 12);
+    EXPECT_EQ(parallel_tree_diameter(tree, pool), 22);
+    EXPECT_TRUE(parallel_is_balanced(tree, pool));
+    EXPECT_TRUE(tree.is_symmetric());
+    EXPECT_TRUE(parallel_is_symmetric(tree, pool));
+
+    // Break symmetry deep in one subtree
+    auto node = tree.get_root();
+    while (node->left) node = node->left;
+    node->data = -1;
+    EXPECT_FALSE(parallel_is_symmetric(tree, pool));
+}
+
+TEST_F(ParallelTreeTest, IdenticalTrees) {
+    std::mt19937 rng(7);
+    BinaryTree<int> first = random_tree(3000, rng);
+    std::mt19937 same_rng(7);
+    BinaryTree<int> second = random_tree(3000, same_rng);
+    EXPECT_TRUE(parallel_are_identical(first, second, pool));
+
+    auto node = second.get_root();
+    while (node->right) node = node->right;
+    node->data = -1;
+    EXPECT_FALSE(parallel_are_identical(first, second, pool));
+    EXPECT_FALSE(parallel_are_identical(first, BinaryTree<int>(), pool));
+}
+
+TEST_F(ParallelTreeTest, BinarySearchTrees) {
+    BinarySearchTree<int, AvlBalance> bst;
+    for (int i = 0; i < 1000; ++i) bst.insert(i);
+    EXPECT_EQ(parallel_count_nodes(bst, pool), 1000u);
+    EXPECT_EQ(parallel_height(bst, pool), bst.height());
+    EXPECT_TRUE(parallel_is_balanced(bst, pool));
+    EXPECT_EQ(parallel_tree_diameter(bst, pool), tree_diameter(bst));
+
+    BinarySearchTree<int> plain_order;
+    for (int i = 0; i < 1000; ++i) plain_order.insert(i);
+    EXPECT_TRUE(parallel_are_identical(bst, bst, pool));
+    EXPECT_FALSE(parallel_are_identical(bst, plain_order, pool));
+}
+
+TEST_F(ParallelTreeTest, DegenerateTreeDoesNotOverflowStack) {
+    BinaryTree<int> chain;
+    chain.set_root(0);
+    auto node = chain.get_root();
+    for (int i = 1; i < 1000000; ++i) {
+        node = chain.insert_right(node, i);
+    }
+    node.reset();
+
+    EXPECT_EQ(parallel_height(chain, pool), 1000000);
+    EXPECT_EQ(parallel_count_nodes(chain, pool), 1000000u);
+    EXPECT_FALSE(parallel_is_balanced(chain, pool));
+    EXPECT_FALSE(parallel_is_symmetric(chain, pool));
+    EXPECT_EQ(parallel_tree_diameter(chain, pool), 999999);
+    EXPECT_TRUE(parallel_are_identical(chain, chain, pool));
+    release_tree(chain);
+}
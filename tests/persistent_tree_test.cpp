@@ -0,0 +1,205 @@
+/**
+ * @file persistent_tree_test.cpp
+ * @brief Unit tests for PersistentBinarySearchTree and VersionedBinarySearchTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/persistent_tree.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+namespace {
+
+// Checks ordering, AVL heights and subtree sizes; returns the height
+template<typename T>
+int check_node(const SearchTreeNode<T>* node, const T* lo, const T* hi) {
+    if (!node) return 0;
+    EXPECT_TRUE(!lo || *lo < node->data);
+    EXPECT_TRUE(!hi || node->data < *hi);
+    int left = check_node(node->left.get(), lo, &node->data);
+    int right = check_node(node->right.get(), &node->data, hi);
+    EXPECT_LE(std::abs(left - right), 1);
+    EXPECT_EQ(node->rank, 1 + std::max(left, right));
+    size_t expected_size = 1 + (node->left ? node->left->subtree_size : 0) +
+                           (node->right ? node->right->subtree_size : 0);
+    EXPECT_EQ(node->subtree_size, expected_size);
+    return node->rank;
+}
+
+template<typename T>
+void expect_valid(const PersistentBinarySearchTree<T>& tree) {
+    check_node<T>(tree.get_root().get(), nullptr, nullptr);
+}
+
+} // namespace
+
+TEST(PersistentBinarySearchTreeTest, OldVersionsAreUnchanged) {
+    PersistentBinarySearchTree<int> empty;
+    PersistentBinarySearchTree<int> v1 = empty.insert(5).insert(3).insert(8);
+    PersistentBinarySearchTree<int> v2 = v1.insert(4);
+    PersistentBinarySearchTree<int> v3 = v2.remove(5);
+
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(v1.to_sorted_array(), std::vector<int>({3, 5, 8}));
+    EXPECT_EQ(v2.to_sorted_array(), std::vector<int>({3, 4, 5, 8}));
+    EXPECT_EQ(v3.to_sorted_array(), std::vector<int>({3, 4, 8}));
+    EXPECT_FALSE(v1.search(4));
+    EXPECT_TRUE(v2.search(4));
+    EXPECT_FALSE(v3.search(5));
+    expect_valid(v3);
+}
+
+TEST(PersistentBinarySearchTreeTest, SharesUntouchedNodes) {
+    std::vector<int> values(1023);
+    for (int i = 0; i < 1023; ++i) values[i] = 2 * i;
+    PersistentBinarySearchTree<int> base(values);
+    EXPECT_EQ(base.height(), 10);
+
+    PersistentBinarySearchTree<int> next = base.insert(1);
+    EXPECT_NE(next.get_root(), base.get_root());
+    EXPECT_EQ(next.get_root()->right, base.get_root()->right);  // Right half shared
+
+    // Duplicates and missing values return the same version
+    EXPECT_EQ(base.insert(10).get_root(), base.get_root());
+    EXPECT_EQ(base.remove(11).get_root(), base.get_root());
+}
+
+TEST(PersistentBinarySearchTreeTest, StaysBalancedForSortedInput) {
+    PersistentBinarySearchTree<int> tree;
+    for (int i = 0; i < 4096; ++i) {
+        tree = tree.insert(i);
+    }
+    EXPECT_EQ(tree.size(), 4096u);
+    EXPECT_LE(tree.height(), 13);
+    expect_valid(tree);
+
+    for (int i = 0; i < 4096; i += 2) {
+        tree = tree.remove(i);
+    }
+    EXPECT_EQ(tree.size(), 2048u);
+    EXPECT_LE(tree.height(), 12);
+    expect_valid(tree);
+}
+
+TEST(PersistentBinarySearchTreeTest, Queries) {
+    PersistentBinarySearchTree<int> tree(std::vector<int>{1, 3, 5, 7, 9, 11});
+    EXPECT_EQ(tree.find_min(), 1);
+    EXPECT_EQ(tree.find_max(), 11);
+    EXPECT_EQ(tree.kth_smallest(1), 1);
+    EXPECT_EQ(tree.kth_smallest(4), 7);
+    EXPECT_EQ(tree.rank(7), 3u);
+    EXPECT_EQ(tree.rank(8), 4u);
+
+    std::vector<int> in_range(tree.range(3, 8).begin(), tree.range(3, 8).end());
+    EXPECT_EQ(in_range, std::vector<int>({3, 5, 7}));
+
+    EXPECT_THROW(tree.kth_smallest(7), std::out_of_range);
+    EXPECT_THROW(PersistentBinarySearchTree<int>().find_min(), std::runtime_error);
+    EXPECT_THROW(PersistentBinarySearchTree<int>(std::vector<int>{2, 1}), std::invalid_argument);
+}
+
+TEST(PersistentBinarySearchTreeTest, SortedInputDuplicatesAreIgnored) {
+    PersistentBinarySearchTree<int> tree(std::vector<int>{1, 1, 2, 3, 3, 3});
+    EXPECT_EQ(tree.size(), 3u);
+    EXPECT_EQ(tree.to_sorted_array(), std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(tree.rank(3), 2u);
+    EXPECT_EQ(tree.insert(2).size(), 3u);
+
+    EXPECT_EQ(PersistentBinarySearchTree<int>(std::vector<int>{4, 4}).size(), 1u);
+    EXPECT_THROW(PersistentBinarySearchTree<int>(std::vector<int>{1, 1, 0}), std::invalid_argument);
+}
+
+TEST(PersistentBinarySearchTreeTest, FromBinarySearchTree) {
+    BinarySearchTree<std::string> source;
+    for (const char* word : {"pear", "apple", "fig", "kiwi"}) source.insert(word);
+
+    PersistentBinarySearchTree<std::string> tree(source);
+    source.insert("banana");
+    EXPECT_EQ(tree.to_sorted_array(), std::vector<std::string>({"apple", "fig", "kiwi", "pear"}));
+}
+
+TEST(PersistentBinarySearchTreeTest, MatchesStdSet) {
+    std::mt19937 rng(46);
+    PersistentBinarySearchTree<int> tree;
+    std::set<int> expected;
+    std::vector<std::pair<PersistentBinarySearchTree<int>, std::set<int>>> history;
+
+    for (int step = 0; step < 3000; ++step) {
+        int value = static_cast<int>(rng() % 500);
+        if (rng() % 3 == 0) {
+            tree = tree.remove(value);
+            expected.erase(value);
+        } else {
+            tree = tree.insert(value);
+            expected.insert(value);
+        }
+        if (step % 300 == 0) history.emplace_back(tree, expected);
+    }
+    expect_valid(tree);
+
+    // Every retained version still matches its own point in time
+    for (const auto& entry : history) {
+        EXPECT_EQ(entry.first.to_sorted_array(), std::vector<int>(entry.second.begin(), entry.second.end()));
+    }
+}
+
+TEST(VersionedBinarySearchTreeTest, InsertRemoveAndSnapshot) {
+    VersionedBinarySearchTree<int> tree;
+    EXPECT_TRUE(tree.insert(2));
+    EXPECT_TRUE(tree.insert(1));
+    EXPECT_FALSE(tree.insert(2));
+
+    PersistentBinarySearchTree<int> before = tree.snapshot();
+    EXPECT_TRUE(tree.remove(2));
+    EXPECT_FALSE(tree.remove(2));
+
+    EXPECT_EQ(before.to_sorted_array(), std::vector<int>({1, 2}));
+    EXPECT_EQ(tree.snapshot().to_sorted_array(), std::vector<int>({1}));
+    EXPECT_EQ(tree.size(), 1u);
+
+    tree.publish(before);
+    EXPECT_EQ(tree.size(), 2u);
+}
+
+TEST(VersionedBinarySearchTreeTest, ReadersSeeConsistentVersions) {
+    // The writer inserts 0, 1, 2, ... in order, so every consistent
+    // snapshot holds exactly the values 0..size-1
+    VersionedBinarySearchTree<int> tree;
+    const int total = 20000;
+    std::atomic<bool> failed(false);
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            size_t last_size = 0;
+            while (last_size < static_cast<size_t>(total)) {
+                PersistentBinarySearchTree<int> view = tree.snapshot();
+                size_t n = view.size();
+                if (n < last_size || (n > 0 && (view.find_min() != 0 || view.find_max() != static_cast<int>(n) - 1))) {
+                    failed = true;
+                }
+                last_size = n;
+            }
+        });
+    }
+
+    for (int i = 0; i < total; ++i) {
+        tree.insert(i);
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_FALSE(failed);
+    expect_valid(tree.snapshot());
+}
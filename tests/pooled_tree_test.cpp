@@ -0,0 +1,172 @@
+/**
+ * @file pooled_tree_test.cpp
+ * @brief Unit tests for PooledBinaryTree and PooledBinarySearchTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/pooled_tree.h"
+#include "leetcode_study_guide/data_structures/tree.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+class PooledBinaryTreeTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Level order [1, 2, 3, 4, 5]: 4 and 5 hang below 2
+        tree.build_from_array({1, 2, 3, 4, 5}, -1);
+    }
+
+    PooledBinaryTree<int> tree;
+};
+
+TEST_F(PooledBinaryTreeTest, Traversals) {
+    EXPECT_EQ(tree.inorder_traversal(), std::vector<int>({4, 2, 5, 1, 3}));
+    EXPECT_EQ(tree.preorder_traversal(), std::vector<int>({1, 2, 4, 5, 3}));
+    EXPECT_EQ(tree.postorder_traversal(), std::vector<int>({4, 5, 2, 3, 1}));
+    EXPECT_EQ(tree.level_order_traversal(), std::vector<int>({1, 2, 3, 4, 5}));
+    EXPECT_EQ(tree.inorder_iterative(), tree.inorder_traversal());
+}
+
+TEST_F(PooledBinaryTreeTest, PropertiesAndSearch) {
+    EXPECT_EQ(tree.size(), 5);
+    EXPECT_EQ(tree.count_nodes(), 5);
+    EXPECT_EQ(tree.height(), 3);
+    EXPECT_EQ(tree.min_depth(), 2);
+    EXPECT_TRUE(tree.is_balanced());
+    EXPECT_FALSE(tree.is_symmetric());
+
+    auto found = tree.find(5);
+    ASSERT_NE(found, PooledBinaryTree<int>::kNullNode);
+    EXPECT_EQ(tree.node(found).data, 5);
+    EXPECT_EQ(tree.find(42), PooledBinaryTree<int>::kNullNode);
+
+    EXPECT_EQ(tree.find_path(5), std::vector<int>({1, 2, 5}));
+    EXPECT_TRUE(tree.find_path(42).empty());
+
+    EXPECT_EQ(tree.node(tree.lowest_common_ancestor(4, 5)).data, 2);
+    EXPECT_EQ(tree.node(tree.lowest_common_ancestor(4, 3)).data, 1);
+    EXPECT_EQ(tree.node(tree.lowest_common_ancestor(2, 4)).data, 2);
+}
+
+TEST_F(PooledBinaryTreeTest, ManualConstruction) {
+    PooledBinaryTree<int> manual(1);
+    auto left = manual.insert_left(manual.get_root(), 2);
+    manual.insert_right(manual.get_root(), 2);
+    manual.insert_left(left, 3);
+    EXPECT_EQ(manual.size(), 4);
+    EXPECT_FALSE(manual.is_symmetric());
+
+    // Replacing a child frees the old subtree
+    manual.insert_left(manual.get_root(), 2);
+    EXPECT_EQ(manual.size(), 3);
+    EXPECT_TRUE(manual.is_symmetric());
+
+    EXPECT_THROW(manual.insert_left(PooledBinaryTree<int>::kNullNode, 1), std::invalid_argument);
+}
+
+TEST_F(PooledBinaryTreeTest, DeepDegenerateTree) {
+    // Far deeper than a recursive traversal could handle
+    const int depth = 200000;
+    PooledBinaryTree<int> chain(0);
+    auto current = chain.get_root();
+    for (int i = 1; i < depth; ++i) {
+        current = chain.insert_right(current, i);
+    }
+
+    EXPECT_EQ(chain.height(), depth);
+    EXPECT_EQ(chain.min_depth(), depth);
+    EXPECT_EQ(chain.count_nodes(), static_cast<size_t>(depth));
+    EXPECT_FALSE(chain.is_balanced());
+    EXPECT_EQ(chain.inorder_traversal().back(), depth - 1);
+    EXPECT_EQ(chain.postorder_traversal().front(), depth - 1);
+    EXPECT_EQ(chain.find_path(depth - 1).size(), static_cast<size_t>(depth));
+    EXPECT_EQ(chain.node(chain.lowest_common_ancestor(depth - 2, depth - 1)).data, depth - 2);
+}
+
+TEST_F(PooledBinaryTreeTest, ClearAndReuse) {
+    EXPECT_GT(tree.memory_usage(), 0);
+    tree.clear();
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(tree.size(), 0);
+    EXPECT_EQ(tree.memory_usage(), 0);
+
+    tree.set_root(7);
+    tree.insert_left(tree.get_root(), 8);
+    EXPECT_EQ(tree.preorder_traversal(), std::vector<int>({7, 8}));
+}
+
+TEST(PooledBinarySearchTreeTest, BasicOperations) {
+    PooledBinarySearchTree<int> bst;
+    for (int value : {50, 30, 70, 20, 40, 60, 80}) {
+        EXPECT_TRUE(bst.insert(value));
+    }
+    EXPECT_FALSE(bst.insert(50));
+    EXPECT_EQ(bst.size(), 7);
+    EXPECT_TRUE(bst.is_valid_bst());
+
+    EXPECT_TRUE(bst.search(60));
+    EXPECT_FALSE(bst.search(65));
+    EXPECT_EQ(bst.find_min(), 20);
+    EXPECT_EQ(bst.find_max(), 80);
+    EXPECT_EQ(bst.find_successor(40), 50);
+    EXPECT_EQ(bst.find_predecessor(60), 50);
+    EXPECT_THROW(bst.find_successor(80), std::runtime_error);
+    EXPECT_THROW(bst.find_predecessor(20), std::runtime_error);
+    EXPECT_THROW(bst.find_successor(45), std::runtime_error);
+    EXPECT_EQ(bst.kth_smallest(3), 40);
+    EXPECT_EQ(bst.kth_largest(2), 70);
+    EXPECT_THROW(bst.kth_smallest(0), std::out_of_range);
+    EXPECT_THROW(bst.kth_largest(8), std::out_of_range);
+
+    EXPECT_TRUE(bst.remove(30));   // Two children
+    EXPECT_TRUE(bst.remove(80));   // Leaf
+    EXPECT_TRUE(bst.remove(50));   // Root
+    EXPECT_FALSE(bst.remove(50));
+    EXPECT_EQ(bst.to_sorted_array(), std::vector<int>({20, 40, 60, 70}));
+    EXPECT_TRUE(bst.is_valid_bst());
+
+    PooledBinarySearchTree<int> empty;
+    EXPECT_THROW(empty.find_min(), std::runtime_error);
+    EXPECT_THROW(empty.find_max(), std::runtime_error);
+}
+
+TEST(PooledBinarySearchTreeTest, BalancedBuildFromSortedArray) {
+    std::vector<std::string> words = {"ant", "bee", "cat", "dog", "eel", "fox", "gnu"};
+    PooledBinarySearchTree<std::string> bst(words);
+    EXPECT_EQ(bst.size(), words.size());
+    EXPECT_EQ(bst.height(), 3);
+    EXPECT_TRUE(bst.is_balanced());
+    EXPECT_EQ(bst.to_sorted_array(), words);
+    EXPECT_EQ(bst.node(bst.get_root()).data, "dog");
+}
+
+TEST(PooledBinarySearchTreeTest, MatchesSharedPointerTree) {
+    std::mt19937 rng(38);
+    std::uniform_int_distribution<int> value(0, 500);
+    PooledBinarySearchTree<int> pooled;
+    BinarySearchTree<int> reference;
+
+    for (int step = 0; step < 4000; ++step) {
+        int v = value(rng);
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(pooled.remove(v), reference.remove(v));
+        } else {
+            EXPECT_EQ(pooled.insert(v), reference.insert(v));
+        }
+        ASSERT_EQ(pooled.size(), reference.size());
+    }
+
+    EXPECT_EQ(pooled.inorder_traversal(), reference.inorder_traversal());
+    EXPECT_EQ(pooled.preorder_traversal(), reference.preorder_traversal());
+    EXPECT_EQ(pooled.height(), reference.height());
+    EXPECT_EQ(pooled.is_balanced(), reference.is_balanced());
+    EXPECT_TRUE(pooled.is_valid_bst());
+    for (int k = 1; k <= static_cast<int>(pooled.size()); k += 17) {
+        EXPECT_EQ(pooled.kth_smallest(k), reference.kth_smallest(k));
+    }
+}
@@ -0,0 +1,230 @@
+/**
+ * @file range_query_test.cpp
+ * @brief Unit tests for FenwickTree and SegmentTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/range_query.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+// FenwickTree Tests
+
+TEST(FenwickTreeTest, PrefixAndRangeSums) {
+    FenwickTree<int> tree(std::vector<int>{3, 2, -1, 6, 5, 4, -3, 3, 7, 2, 3});
+    EXPECT_EQ(tree.size(), 11u);
+    EXPECT_EQ(tree.prefix_sum(0), 0);
+    EXPECT_EQ(tree.prefix_sum(5), 15);
+    EXPECT_EQ(tree.prefix_sum(11), 31);
+    EXPECT_EQ(tree.range_sum(1, 4), 12);
+    EXPECT_EQ(tree.range_sum(6, 6), -3);
+    EXPECT_EQ(tree.get(3), 6);
+}
+
+TEST(FenwickTreeTest, PointUpdates) {
+    FenwickTree<int> tree(Array<int>{1, 3, 5});
+    EXPECT_EQ(tree.range_sum(0, 2), 9);
+    tree.set(1, 2);
+    EXPECT_EQ(tree.range_sum(0, 2), 8);
+    tree.add(2, 10);
+    EXPECT_EQ(tree.get(2), 15);
+    EXPECT_EQ(tree.range_sum(1, 2), 17);
+
+    FenwickTree<long long> zeros(4);
+    zeros.add(3, 1LL << 40);
+    EXPECT_EQ(zeros.prefix_sum(4), 1LL << 40);
+    EXPECT_EQ(zeros.prefix_sum(3), 0);
+}
+
+TEST(FenwickTreeTest, LowerBound) {
+    FenwickTree<int> tree(std::vector<int>{2, 0, 3, 1, 4});
+    EXPECT_EQ(tree.lower_bound(0), 0u);
+    EXPECT_EQ(tree.lower_bound(2), 0u);
+    EXPECT_EQ(tree.lower_bound(3), 2u);
+    EXPECT_EQ(tree.lower_bound(6), 3u);
+    EXPECT_EQ(tree.lower_bound(10), 4u);
+    EXPECT_EQ(tree.lower_bound(11), 5u);
+    EXPECT_EQ(FenwickTree<int>().lower_bound(1), 0u);
+}
+
+TEST(FenwickTreeTest, InvalidIndices) {
+    FenwickTree<int> tree(3);
+    EXPECT_THROW(tree.add(3, 1), std::out_of_range);
+    EXPECT_THROW(tree.prefix_sum(4), std::out_of_range);
+    EXPECT_THROW(tree.range_sum(2, 1), std::out_of_range);
+    EXPECT_THROW(tree.range_sum(0, 3), std::out_of_range);
+    EXPECT_TRUE(FenwickTree<int>().empty());
+}
+
+TEST(FenwickTreeTest, MatchesBruteForce) {
+    std::mt19937 rng(45);
+    std::vector<int> values(257);
+    for (int& value : values) value = static_cast<int>(rng() % 201) - 100;
+    FenwickTree<int> tree(values);
+
+    for (int step = 0; step < 2000; ++step) {
+        size_t a = rng() % values.size();
+        size_t b = rng() % values.size();
+        if (step % 2 == 0) {
+            int delta = static_cast<int>(rng() % 21) - 10;
+            values[a] += delta;
+            tree.add(a, delta);
+        } else {
+            size_t left = std::min(a, b);
+            size_t right = std::max(a, b);
+            int expected = std::accumulate(values.begin() + left, values.begin() + right + 1, 0);
+            ASSERT_EQ(tree.range_sum(left, right), expected);
+        }
+    }
+}
+
+// SegmentTree Tests
+
+TEST(SegmentTreeTest, SumWithRangeAdd) {
+    SegmentTree<int> tree(std::vector<int>{1, 2, 3, 4, 5});
+    EXPECT_EQ(tree.query_all(), 15);
+    EXPECT_EQ(tree.query(1, 3), 9);
+
+    tree.update(1, 3, 10);
+    EXPECT_EQ(tree.query(1, 3), 39);
+    EXPECT_EQ(tree.query(0, 1), 13);
+    EXPECT_EQ(tree.get(3), 14);
+    EXPECT_EQ(tree.query_all(), 45);
+
+    tree.set(2, 0);
+    EXPECT_EQ(tree.query(2, 4), 19);
+}
+
+TEST(SegmentTreeTest, MinAndMaxMonoids) {
+    std::vector<int> values = {5, 1, 4, 2, 3, 9};
+    SegmentTree<int, MinMonoid<int>, AddUpdate<int>> min_tree(values);
+    SegmentTree<int, MaxMonoid<int>, AddUpdate<int>> max_tree{Array<int>(values)};
+
+    EXPECT_EQ(min_tree.query(0, 5), 1);
+    EXPECT_EQ(min_tree.query(2, 4), 2);
+    EXPECT_EQ(max_tree.query(0, 4), 5);
+
+    min_tree.update(0, 2, 3);   // 8 4 7 2 3 9
+    max_tree.update(3, 5, -4);  // 5 1 4 -2 -1 5
+    EXPECT_EQ(min_tree.query(0, 2), 4);
+    EXPECT_EQ(min_tree.query(1, 5), 2);
+    EXPECT_EQ(max_tree.query(3, 5), 5);
+    EXPECT_EQ(max_tree.query(3, 4), -1);
+}
+
+TEST(SegmentTreeTest, RangeAssign) {
+    SegmentTree<int, SumMonoid<int>, AssignUpdate<int>> tree(std::vector<int>{1, 2, 3, 4, 5, 6, 7});
+    tree.update(1, 5, 0);
+    EXPECT_EQ(tree.query_all(), 8);
+    tree.update(3, 6, 2);
+    EXPECT_EQ(tree.query(0, 6), 1 + 0 + 0 + 2 * 4);
+    EXPECT_EQ(tree.get(2), 0);
+    EXPECT_EQ(tree.get(6), 2);
+}
+
+TEST(SegmentTreeTest, EmptyAndInvalid) {
+    SegmentTree<int> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.query_all(), 0);
+    EXPECT_THROW(empty.query(0, 0), std::out_of_range);
+
+    SegmentTree<int, MinMonoid<int>, AddUpdate<int>> tree(3);
+    EXPECT_EQ(tree.query_all(), 0);
+    EXPECT_THROW(tree.update(1, 3, 1), std::out_of_range);
+    EXPECT_THROW(tree.query(2, 1), std::out_of_range);
+    EXPECT_THROW(tree.set(3, 1), std::out_of_range);
+}
+
+TEST(SegmentTreeTest, SizedConstructorStartsFromValues) {
+    // Starting from MinMonoid's identity (INT_MAX) would overflow on the add
+    SegmentTree<int, MinMonoid<int>, AddUpdate<int>> zeros(4);
+    zeros.update(0, 3, 1);
+    EXPECT_EQ(zeros.query(0, 3), 1);
+
+    SegmentTree<int, MaxMonoid<int>, AddUpdate<int>> fives(4, 5);
+    fives.update(1, 2, -1);
+    EXPECT_EQ(fives.query(1, 2), 4);
+    EXPECT_EQ(fives.query_all(), 5);
+}
+
+TEST(SegmentTreeTest, ConcurrentQueriesOnConstTree) {
+    std::vector<long long> values(1000);
+    std::iota(values.begin(), values.end(), 0LL);
+    SegmentTree<long long> tree(values);
+    // Leave pending tags along many root paths
+    for (size_t i = 0; i + 10 < values.size(); i += 37) {
+        tree.update(i, i + 10, 3);
+        for (size_t j = i; j <= i + 10; ++j) values[j] += 3;
+    }
+
+    const SegmentTree<long long>& shared = tree;
+    std::vector<int> mismatches(4, 0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&, t] {
+            for (size_t left = t; left < values.size(); left += 7) {
+                size_t right = std::min(values.size() - 1, left + 3 * left % 97);
+                long long expected = std::accumulate(values.begin() + left, values.begin() + right + 1, 0LL);
+                if (shared.query(left, right) != expected) ++mismatches[t];
+            }
+        });
+    }
+    for (auto& reader : readers) reader.join();
+    EXPECT_EQ(std::accumulate(mismatches.begin(), mismatches.end(), 0), 0);
+}
+
+// Random operations against a plain vector, for every monoid/update pair
+template<typename Tree, typename Aggregate, typename Apply>
+void check_against_brute_force(unsigned seed, Aggregate aggregate, Apply apply) {
+    std::mt19937 rng(seed);
+    for (size_t n : {1u, 2u, 7u, 64u, 100u}) {
+        std::vector<long long> values(n);
+        for (auto& value : values) value = static_cast<long long>(rng() % 101) - 50;
+        Tree tree(values);
+
+        for (int step = 0; step < 1500; ++step) {
+            size_t a = rng() % n;
+            size_t b = rng() % n;
+            size_t left = std::min(a, b);
+            size_t right = std::max(a, b);
+            long long amount = static_cast<long long>(rng() % 21) - 10;
+            switch (rng() % 3) {
+            case 0:
+                tree.update(left, right, amount);
+                for (size_t i = left; i <= right; ++i) values[i] = apply(values[i], amount);
+                break;
+            case 1:
+                tree.set(a, amount);
+                values[a] = amount;
+                break;
+            default:
+                ASSERT_EQ(tree.query(left, right),
+                          aggregate(values.begin() + left, values.begin() + right + 1));
+            }
+        }
+    }
+}
+
+TEST(SegmentTreeTest, MatchesBruteForce) {
+    auto sum = [](auto first, auto last) { return std::accumulate(first, last, 0LL); };
+    auto min = [](auto first, auto last) { return *std::min_element(first, last); };
+    auto max = [](auto first, auto last) { return *std::max_element(first, last); };
+    auto add = [](long long value, long long amount) { return value + amount; };
+    auto assign = [](long long, long long amount) { return amount; };
+
+    check_against_brute_force<SegmentTree<long long>>(1, sum, add);
+    check_against_brute_force<SegmentTree<long long, MinMonoid<long long>, AddUpdate<long long>>>(2, min, add);
+    check_against_brute_force<SegmentTree<long long, MaxMonoid<long long>, AddUpdate<long long>>>(3, max, add);
+    check_against_brute_force<SegmentTree<long long, SumMonoid<long long>, AssignUpdate<long long>>>(4, sum, assign);
+    check_against_brute_force<SegmentTree<long long, MinMonoid<long long>, AssignUpdate<long long>>>(5, min, assign);
+    check_against_brute_force<SegmentTree<long long, MaxMonoid<long long>, AssignUpdate<long long>>>(6, max, assign);
+}
@@ -0,0 +1,102 @@
+/**
+ * @file static_search_tree_test.cpp
+ * @brief Unit tests for StaticSearchTree
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/static_search_tree.h"
+#include "leetcode_study_guide/data_structures/tree.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+TEST(StaticSearchTreeTest, EmptyTree) {
+    StaticSearchTree<int> tree(std::vector<int>{});
+    EXPECT_TRUE(tree.empty());
+    EXPECT_FALSE(tree.contains(1));
+    EXPECT_EQ(tree.lower_bound(1), nullptr);
+    EXPECT_THROW(tree.find_successor(1), std::runtime_error);
+    EXPECT_THROW(tree.find_predecessor(1), std::runtime_error);
+    EXPECT_TRUE(tree.to_sorted_array().empty());
+}
+
+TEST(StaticSearchTreeTest, BasicQueries) {
+    std::vector<int> values = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29};
+    StaticSearchTree<int> tree(values);
+    EXPECT_EQ(tree.size(), values.size());
+    EXPECT_EQ(tree.to_sorted_array(), values);
+
+    EXPECT_TRUE(tree.contains(2));
+    EXPECT_TRUE(tree.contains(29));
+    EXPECT_FALSE(tree.contains(4));
+    EXPECT_FALSE(tree.contains(100));
+
+    ASSERT_NE(tree.lower_bound(12), nullptr);
+    EXPECT_EQ(*tree.lower_bound(12), 13);
+    EXPECT_EQ(*tree.lower_bound(13), 13);
+    EXPECT_EQ(*tree.upper_bound(13), 17);
+    EXPECT_EQ(*tree.lower_bound(-5), 2);
+    EXPECT_EQ(tree.lower_bound(30), nullptr);
+    EXPECT_EQ(tree.upper_bound(29), nullptr);
+
+    EXPECT_EQ(tree.find_successor(7), 11);
+    EXPECT_EQ(tree.find_successor(8), 11);
+    EXPECT_EQ(tree.find_predecessor(7), 5);
+    EXPECT_EQ(tree.find_predecessor(100), 29);
+    EXPECT_THROW(tree.find_successor(29), std::runtime_error);
+    EXPECT_THROW(tree.find_predecessor(2), std::runtime_error);
+}
+
+TEST(StaticSearchTreeTest, RejectsUnsortedInput) {
+    EXPECT_THROW(StaticSearchTree<int>(std::vector<int>{1, 3, 2}), std::invalid_argument);
+}
+
+TEST(StaticSearchTreeTest, MatchesStdAlgorithms) {
+    std::mt19937 rng(41);
+    for (size_t n : {1u, 2u, 3u, 15u, 16u, 17u, 1000u, 4097u}) {
+        std::vector<int> values(n);
+        for (auto& v : values) v = static_cast<int>(rng() % (3 * n));
+        std::sort(values.begin(), values.end());  // Duplicates included
+        StaticSearchTree<int> tree(values);
+        ASSERT_EQ(tree.to_sorted_array(), values);
+
+        for (int probe = -1; probe <= static_cast<int>(3 * n); ++probe) {
+            auto lower = std::lower_bound(values.begin(), values.end(), probe);
+            auto upper = std::upper_bound(values.begin(), values.end(), probe);
+            const int* found = tree.lower_bound(probe);
+            ASSERT_EQ(found == nullptr, lower == values.end()) << n << " " << probe;
+            if (found) {
+                EXPECT_EQ(*found, *lower);
+            }
+            const int* next = tree.upper_bound(probe);
+            ASSERT_EQ(next == nullptr, upper == values.end());
+            if (next) {
+                EXPECT_EQ(*next, *upper);
+            }
+            EXPECT_EQ(tree.contains(probe), std::binary_search(values.begin(), values.end(), probe));
+            if (lower != values.begin()) {
+                EXPECT_EQ(tree.find_predecessor(probe), *std::prev(lower));
+            } else {
+                EXPECT_THROW(tree.find_predecessor(probe), std::runtime_error);
+            }
+        }
+    }
+}
+
+TEST(StaticSearchTreeTest, FreezeBinarySearchTree) {
+    BinarySearchTree<std::string, AvlBalance> bst;
+    for (const char* word : {"pear", "apple", "fig", "kiwi", "banana", "cherry"}) {
+        bst.insert(word);
+    }
+    StaticSearchTree<std::string> frozen = bst.freeze();
+    EXPECT_EQ(frozen.to_sorted_array(), bst.to_sorted_array());
+    EXPECT_TRUE(frozen.contains("kiwi"));
+    EXPECT_FALSE(frozen.contains("grape"));
+    EXPECT_EQ(frozen.find_successor("cherry"), "fig");
+    EXPECT_EQ(*frozen.lower_bound("grape"), "kiwi");
+}
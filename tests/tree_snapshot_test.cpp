@@ -0,0 +1,179 @@
+/**
+ * @file tree_snapshot_test.cpp
+ * @brief Unit tests for TreeSnapshot
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/tree_snapshot.h"
+#include "tree_test_helpers.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+using leetcode_study_guide::test_helpers::random_tree;
+using leetcode_study_guide::test_helpers::release_tree;
+
+class TreeSnapshotTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Tree: 1 with children 2 and 3; 2 has children 4 and 5; 3 has right child 6
+        tree.set_root(1);
+        auto root = tree.get_root();
+        auto left = tree.insert_left(root, 2);
+        auto right = tree.insert_right(root, 3);
+        tree.insert_left(left, 4);
+        tree.insert_right(left, 5);
+        tree.insert_right(right, 6);
+    }
+
+    BinaryTree<int> tree;
+};
+
+TEST_F(TreeSnapshotTest, EncodesPreorderShapeAndValues) {
+    TreeSnapshot<int> snapshot(tree);
+    ASSERT_EQ(snapshot.size(), 6u);
+
+    std::vector<int> values;
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+        values.push_back(snapshot.value(i));
+    }
+    EXPECT_EQ(values, std::vector<int>({1, 2, 4, 5, 3, 6}));
+
+    EXPECT_TRUE(snapshot.has_left(0) && snapshot.has_right(0));
+    EXPECT_TRUE(snapshot.has_left(1) && snapshot.has_right(1));
+    EXPECT_FALSE(snapshot.has_left(2) || snapshot.has_right(2));
+    EXPECT_FALSE(snapshot.has_left(4));
+    EXPECT_TRUE(snapshot.has_right(4));
+}
+
+TEST_F(TreeSnapshotTest, RoundTripPreservesTree) {
+    BinaryTree<int> restored = TreeSnapshot<int>(tree).to_tree();
+    EXPECT_EQ(serialize_tree(restored), serialize_tree(tree));
+    EXPECT_EQ(restored.size(), tree.size());
+}
+
+TEST_F(TreeSnapshotTest, EncodesBinarySearchTrees) {
+    BinarySearchTree<int> bst;
+    for (int value : {5, 3, 7, 2, 4, 6, 8}) bst.insert(value);
+    BinaryTree<int> restored = TreeSnapshot<int>(bst).to_tree();
+    EXPECT_EQ(serialize_tree(restored), serialize_tree(bst));
+    EXPECT_TRUE(are_identical(restored, bst));
+}
+
+TEST_F(TreeSnapshotTest, EmptyTree) {
+    TreeSnapshot<int> snapshot{BinaryTree<int>()};
+    EXPECT_TRUE(snapshot.empty());
+    EXPECT_TRUE(snapshot.to_tree().empty());
+    EXPECT_TRUE(TreeSnapshot<int>().empty());
+}
+
+TEST_F(TreeSnapshotTest, StringValues) {
+    BinaryTree<std::string> words;
+    words.set_root("root");
+    auto left = words.insert_left(words.get_root(), "");
+    words.insert_right(left, "a longer value that needs more than one word");
+    words.insert_right(words.get_root(), "x");
+
+    TreeSnapshot<std::string> snapshot(words);
+    EXPECT_EQ(snapshot.value(0), "root");
+    EXPECT_EQ(snapshot.value(1), "");
+    EXPECT_EQ(snapshot.value(2), "a longer value that needs more than one word");
+    EXPECT_EQ(snapshot.value(3), "x");
+    EXPECT_EQ(serialize_tree(snapshot.to_tree()), serialize_tree(words));
+}
+
+TEST_F(TreeSnapshotTest, SaveAndLoad) {
+    std::string path = ::testing::TempDir() + "tree_snapshot_test.bin";
+    TreeSnapshot<int> snapshot(tree);
+    snapshot.save(path);
+
+    TreeSnapshot<int> loaded = TreeSnapshot<int>::load(path);
+    std::remove(path.c_str());  // The mapping stays valid after unlink
+    EXPECT_EQ(loaded.memory_usage(), snapshot.memory_usage());
+    EXPECT_EQ(serialize_tree(loaded.to_tree()), serialize_tree(tree));
+}
+
+TEST_F(TreeSnapshotTest, FromBufferReadsInPlace) {
+    TreeSnapshot<int> snapshot(tree);
+    std::vector<uint64_t> buffer(snapshot.memory_usage() / sizeof(uint64_t));
+    std::string path = ::testing::TempDir() + "tree_snapshot_buffer.bin";
+    snapshot.save(path);
+    MappedFile file(path);
+    std::remove(path.c_str());
+    std::memcpy(buffer.data(), file.data(), file.size());
+
+    TreeSnapshot<int> view = TreeSnapshot<int>::from_buffer(buffer.data(), buffer.size() * sizeof(uint64_t));
+    EXPECT_EQ(view.value(5), 6);
+    buffer[4] = 0;  // Clear the first shape word: the view sees the change
+    EXPECT_FALSE(view.has_left(0));
+    EXPECT_THROW(view.to_tree(), std::runtime_error);
+}
+
+TEST_F(TreeSnapshotTest, RejectsMalformedBuffers) {
+    TreeSnapshot<int> snapshot(tree);
+    std::vector<uint64_t> buffer(snapshot.memory_usage() / sizeof(uint64_t));
+    std::string path = ::testing::TempDir() + "tree_snapshot_malformed.bin";
+    snapshot.save(path);
+    {
+        MappedFile file(path);
+        std::memcpy(buffer.data(), file.data(), file.size());
+    }
+    std::remove(path.c_str());
+    size_t bytes = buffer.size() * sizeof(uint64_t);
+
+    EXPECT_THROW(TreeSnapshot<int>::from_buffer(buffer.data(), 16), std::runtime_error);
+    EXPECT_THROW(TreeSnapshot<int>::from_buffer(buffer.data(), bytes - 8), std::runtime_error);
+    EXPECT_THROW(TreeSnapshot<double>::from_buffer(buffer.data(), bytes), std::runtime_error);
+
+    std::vector<uint64_t> huge = buffer;
+    huge[1] = ~uint64_t(0);  // Node count
+    EXPECT_THROW(TreeSnapshot<int>::from_buffer(huge.data(), bytes), std::runtime_error);
+
+    std::vector<uint64_t> bad_magic = buffer;
+    bad_magic[0] = 0;
+    EXPECT_THROW(TreeSnapshot<int>::from_buffer(bad_magic.data(), bytes), std::runtime_error);
+
+    EXPECT_THROW(TreeSnapshot<int>::load(::testing::TempDir() + "missing_tree_snapshot.bin"),
+                 std::runtime_error);
+}
+
+TEST_F(TreeSnapshotTest, DegenerateTreeDoesNotRecurse) {
+    BinaryTree<int> chain;
+    chain.set_root(0);
+    auto node = chain.get_root();
+    for (int i = 1; i < 200000; ++i) {
+        node = chain.insert_right(node, i);
+    }
+
+    TreeSnapshot<int> snapshot(chain);
+    EXPECT_EQ(snapshot.size(), 200000u);
+    BinaryTree<int> restored = snapshot.to_tree();
+    EXPECT_EQ(restored.size(), 200000u);
+
+    // Walk the right spine iteratively
+    int expected = 0;
+    for (auto current = restored.get_root(); current; current = current->right) {
+        EXPECT_EQ(current->data, expected++);
+    }
+    EXPECT_EQ(expected, 200000);
+
+    // Release the chains without deep recursive destruction
+    release_tree(chain);
+    release_tree(restored);
+}
+
+TEST_F(TreeSnapshotTest, RandomTreesRoundTrip) {
+    std::mt19937 rng(44);
+    for (int n : {1, 2, 31, 32, 33, 1000}) {
+        BinaryTree<int> random = random_tree(n, rng);
+        TreeSnapshot<int> snapshot(random);
+        EXPECT_EQ(snapshot.size(), static_cast<size_t>(n));
+        EXPECT_EQ(serialize_tree(snapshot.to_tree()), serialize_tree(random));
+    }
+}
@@ -9,9 +9,40 @@
 #include <gtest/gtest.h>
 #include <vector>
 #include <algorithm>
+#include <random>
+#include <set>
+#include <type_traits>
+#include <utility>
 
 using namespace leetcode_study_guide::data_structures;
 
+namespace {
+
+// Detects whether morris_inorder() can be called on Tree
+template<typename Tree, typename = void>
+struct HasMorrisInorder : std::false_type {};
+
+template<typename Tree>
+struct HasMorrisInorder<Tree, std::void_t<decltype(std::declval<Tree&>().morris_inorder())>> : std::true_type {};
+
+// Detects whether Tree exposes a public rotate_right
+template<typename Tree, typename = void>
+struct HasRotateRight : std::false_type {};
+
+template<typename Tree>
+struct HasRotateRight<Tree, std::void_t<decltype(std::declval<Tree&>().rotate_right(
+    std::declval<typename Tree::NodePtr>()))>> : std::true_type {};
+
+// Detects whether Tree exposes BinaryTree's unchecked insert_left
+template<typename Tree, typename = void>
+struct HasInsertLeft : std::false_type {};
+
+template<typename Tree>
+struct HasInsertLeft<Tree, std::void_t<decltype(std::declval<Tree&>().insert_left(
+    std::declval<typename Tree::NodePtr>(), std::declval<int>()))>> : std::true_type {};
+
+} // namespace
+
 class BinaryTreeTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -149,6 +180,77 @@ TEST_F(BinaryTreeTest, BuildFromArray) {
 
 // Binary Search Tree Tests
 
+TEST_F(BinaryTreeTest, LazyTraversals) {
+    auto collect = [](const TraversalRange<int>& range) {
+        return std::vector<int>(range.begin(), range.end());
+    };
+    
+    EXPECT_EQ(collect(tree.inorder()), tree.inorder_traversal());
+    EXPECT_EQ(collect(tree.preorder()), tree.preorder_traversal());
+    EXPECT_EQ(collect(tree.postorder()), tree.postorder_traversal());
+    EXPECT_EQ(collect(tree.level_order()), tree.level_order_traversal());
+    
+    std::vector<int> for_loop;
+    for (int value : tree) {
+        for_loop.push_back(value);
+    }
+    EXPECT_EQ(for_loop, tree.inorder_traversal());
+    
+    // Stopping early and multipass use of the forward iterators
+    auto pre = tree.preorder();
+    auto it = std::find(pre.begin(), pre.end(), 4);
+    ASSERT_NE(it, pre.end());
+    EXPECT_EQ(*++it, 5);
+    EXPECT_EQ(std::distance(pre.begin(), pre.end()), 5);
+    
+    BinaryTree<int> empty;
+    EXPECT_EQ(empty.begin(), empty.end());
+    EXPECT_TRUE(collect(empty.postorder()).empty());
+}
+
+TEST_F(BinaryTreeTest, MorrisInorder) {
+    std::vector<int> values;
+    for (int value : tree.morris_inorder()) {
+        values.push_back(value);
+    }
+    EXPECT_EQ(values, tree.inorder_traversal());
+    
+    // Leaving early still restores every right pointer
+    {
+        auto range = tree.morris_inorder();
+        auto it = range.begin();
+        EXPECT_EQ(*it, 4);
+        ++it;
+        EXPECT_EQ(*it, 2);
+    }
+    EXPECT_EQ(tree.inorder_traversal(), std::vector<int>({4, 2, 5, 1, 3}));
+    EXPECT_EQ(tree.preorder_traversal(), std::vector<int>({1, 2, 4, 5, 3}));
+    
+    // Threading rewrites nodes, so the walk is not part of the const API
+    static_assert(HasMorrisInorder<BinaryTree<int>>::value, "mutable trees offer morris_inorder");
+    static_assert(!HasMorrisInorder<const BinaryTree<int>>::value, "const trees must not thread nodes");
+}
+
+TEST_F(BinarySearchTreeTest, RangeIteration) {
+    // Values: 2, 3, 4, 5, 6, 7, 8
+    auto in_range = [this](int lo, int hi) {
+        auto range = bst.range(lo, hi);
+        return std::vector<int>(range.begin(), range.end());
+    };
+    
+    EXPECT_EQ(in_range(3, 6), std::vector<int>({3, 4, 5, 6}));
+    EXPECT_EQ(in_range(0, 100), bst.to_sorted_array());
+    EXPECT_EQ(in_range(5, 5), std::vector<int>({5}));
+    EXPECT_TRUE(in_range(9, 20).empty());
+    EXPECT_TRUE(in_range(6, 3).empty());
+    
+    BinarySearchTree<int, RedBlackBalance> large;
+    for (int i = 0; i < 100000; ++i) large.insert(i);
+    auto window = large.range(41000, 41004);
+    EXPECT_EQ(std::vector<int>(window.begin(), window.end()),
+              std::vector<int>({41000, 41001, 41002, 41003, 41004}));
+}
+
 TEST_F(BinarySearchTreeTest, BasicOperations) {
     EXPECT_FALSE(bst.empty());
     EXPECT_EQ(bst.size(), 7);
@@ -162,6 +264,10 @@ TEST_F(BinarySearchTreeTest, BasicOperations) {
     // Test insert duplicate
     EXPECT_FALSE(bst.insert(5)); // Should not insert duplicate
     EXPECT_EQ(bst.size(), 7);
+    
+    // Raw child edits would skip subtree sizes, so only plain trees have them
+    static_assert(HasInsertLeft<BinaryTree<int>>::value, "plain trees expose insert_left");
+    static_assert(!HasInsertLeft<BinarySearchTree<int>>::value, "BSTs must hide insert_left");
 }
 
 TEST_F(BinarySearchTreeTest, MinMaxOperations) {
@@ -223,6 +329,54 @@ TEST_F(BinarySearchTreeTest, ValidationAndProperties) {
     EXPECT_THROW(bst.kth_smallest(10), std::out_of_range);
 }
 
+TEST_F(BinarySearchTreeTest, OrderStatistics) {
+    // Values: 2, 3, 4, 5, 6, 7, 8
+    EXPECT_EQ(bst.get_root()->subtree_size, 7);
+    EXPECT_EQ(bst.rank(2), 0);
+    EXPECT_EQ(bst.rank(5), 3);
+    EXPECT_EQ(bst.rank(100), 7);
+    EXPECT_EQ(bst.count_in_range(3, 6), 4);
+    EXPECT_EQ(bst.count_in_range(0, 100), 7);
+    EXPECT_EQ(bst.count_in_range(6, 3), 0);
+    
+    bst.remove(5);
+    bst.insert(10);
+    EXPECT_EQ(bst.rank(10), 6);
+    EXPECT_EQ(bst.kth_smallest(4), 6);
+    EXPECT_EQ(bst.kth_largest(1), 10);
+    EXPECT_EQ(bst.count_in_range(4, 7), 3);
+}
+
+TEST_F(BinarySearchTreeTest, OrderStatisticsRejectStaleSizes) {
+    // The base class still allows raw edits that skip subtree sizes
+    BinaryTree<int, SearchTreeNode<int>>& base = bst;
+    auto smallest = bst.get_root()->left->left;
+    base.insert_left(smallest, 1);
+    EXPECT_EQ(bst.size(), 8);
+    EXPECT_THROW(bst.kth_largest(1), std::logic_error);
+    EXPECT_THROW(bst.kth_smallest(8), std::logic_error);
+}
+
+TEST_F(BinarySearchTreeTest, WorksWithBinaryTreeFunctions) {
+    static_assert(std::is_convertible<BinarySearchTree<int>&, BinaryTree<int, SearchTreeNode<int>>&>::value,
+                  "a BST is a BinaryTree over its own node type");
+    static_assert(!HasInsertLeft<BinarySearchTree<int, AvlBalance>>::value, "BSTs must hide insert_left");
+    
+    // Plain trees keep the small node type
+    static_assert(sizeof(TreeNode<int>) < sizeof(SearchTreeNode<int>), "plain nodes carry no order metadata");
+    
+    EXPECT_EQ(tree_diameter(bst), 4);
+    EXPECT_EQ(serialize_tree(bst), "5,3,2,null,null,4,null,null,7,6,null,null,8,null,null");
+    
+    BinarySearchTree<int> same;
+    for (int value : {5, 3, 7, 2, 4, 6, 8}) same.insert(value);
+    EXPECT_TRUE(are_identical(bst, same));
+    BinaryTree<int> plain(5);
+    plain.insert_left(plain.get_root(), 3);
+    EXPECT_FALSE(are_identical(bst, plain));
+    EXPECT_FALSE(are_identical(plain, bst));
+}
+
 TEST_F(BinarySearchTreeTest, BalancingConcepts) {
     // Test balance factor calculation
     auto root = bst.get_root();
@@ -238,6 +392,23 @@ TEST_F(BinarySearchTreeTest, BalancingConcepts) {
     EXPECT_NE(rotated_left, nullptr);
 }
 
+TEST_F(BinarySearchTreeTest, RotationsOnlyWithoutBalancePolicy) {
+    // Rotations would bypass the balance policy's ranks
+    static_assert(HasRotateRight<BinarySearchTree<int>>::value, "unbalanced trees rotate");
+    static_assert(!HasRotateRight<BinarySearchTree<int, AvlBalance>>::value, "AVL trees hide rotations");
+    static_assert(!HasRotateRight<BinarySearchTree<int, RedBlackBalance>>::value, "red-black trees hide rotations");
+    
+    auto rotated_right = bst.rotate_right(bst.get_root());
+    ASSERT_NE(rotated_right, nullptr);
+    EXPECT_EQ(rotated_right->data, 3);
+    EXPECT_EQ(rotated_right->subtree_size, 7u);
+    
+    auto rotated_left = bst.rotate_left(rotated_right);
+    ASSERT_NE(rotated_left, nullptr);
+    EXPECT_EQ(rotated_left->data, 5);
+    EXPECT_EQ(rotated_left->subtree_size, 7u);
+}
+
 TEST_F(BinarySearchTreeTest, ConstructFromSortedArray) {
     std::vector<int> sorted_array = {1, 2, 3, 4, 5, 6, 7};
     BinarySearchTree<int> balanced_bst(sorted_array);
@@ -358,4 +529,141 @@ TEST(BSTEdgeCasesTest, InvalidOperations) {
     EXPECT_EQ(bst.find_max(), 5);
     EXPECT_THROW(bst.find_successor(5), std::runtime_error);
     EXPECT_THROW(bst.find_predecessor(5), std::runtime_error);
-}
\ No newline at end of file
+}
+
+// Self-balancing BinarySearchTree Tests
+
+template<typename Policy>
+class BalancedBinarySearchTreeTest : public ::testing::Test {};
+
+using BalancePolicies = ::testing::Types<AvlBalance, RedBlackBalance>;
+TYPED_TEST_SUITE(BalancedBinarySearchTreeTest, BalancePolicies);
+
+// Red-black level rules: left children one level down, right children at
+// most one red link deep, leaves at level 1, inner nodes above it full
+template<typename T>
+bool is_valid_red_black(const std::shared_ptr<SearchTreeNode<T>>& node) {
+    if (!node) return true;
+    int level = node->rank;
+    int left_level = node->left ? node->left->rank : 0;
+    int right_level = node->right ? node->right->rank : 0;
+    if (left_level != level - 1) return false;
+    if (right_level != level && right_level != level - 1) return false;
+    if (node->right && node->right->right && node->right->right->rank >= level) return false;
+    return is_valid_red_black(node->left) && is_valid_red_black(node->right);
+}
+
+TYPED_TEST(BalancedBinarySearchTreeTest, SortedInsertionStaysLogarithmic) {
+    BinarySearchTree<int, TypeParam> bst;
+    const int n = 100000;
+    for (int i = 0; i < n; ++i) {
+        EXPECT_TRUE(bst.insert(i));
+    }
+    EXPECT_FALSE(bst.insert(n / 2));
+    
+    EXPECT_EQ(bst.size(), static_cast<size_t>(n));
+    EXPECT_LE(bst.height(), 2 * 17);  // 2 log2(n + 1)
+    EXPECT_TRUE(bst.is_valid_bst());
+    EXPECT_EQ(bst.find_min(), 0);
+    EXPECT_EQ(bst.find_max(), n - 1);
+    EXPECT_EQ(bst.find_successor(41), 42);
+    EXPECT_EQ(bst.find_predecessor(41), 40);
+    EXPECT_THROW(bst.find_successor(n - 1), std::runtime_error);
+    EXPECT_THROW(bst.find_successor(n + 5), std::runtime_error);
+    EXPECT_THROW(bst.find_predecessor(0), std::runtime_error);
+    
+    // Descending removal of the upper half keeps the bound too
+    for (int i = n - 1; i >= n / 2; --i) {
+        EXPECT_TRUE(bst.remove(i));
+    }
+    EXPECT_EQ(bst.size(), static_cast<size_t>(n / 2));
+    EXPECT_LE(bst.height(), 2 * 16);
+    EXPECT_EQ(bst.find_max(), n / 2 - 1);
+}
+
+TYPED_TEST(BalancedBinarySearchTreeTest, RandomOperationsMatchSet) {
+    BinarySearchTree<int, TypeParam> bst;
+    std::set<int> reference;
+    std::mt19937 rng(39);
+    std::uniform_int_distribution<int> value(0, 2000);
+    
+    for (int step = 0; step < 20000; ++step) {
+        int v = value(rng);
+        if (rng() % 2 == 0) {
+            EXPECT_EQ(bst.insert(v), reference.insert(v).second);
+        } else {
+            EXPECT_EQ(bst.remove(v), reference.erase(v) == 1);
+        }
+    }
+    
+    EXPECT_EQ(bst.size(), reference.size());
+    EXPECT_EQ(bst.to_sorted_array(), std::vector<int>(reference.begin(), reference.end()));
+    EXPECT_TRUE(bst.is_valid_bst());
+    if (std::is_same<TypeParam, AvlBalance>::value) {
+        EXPECT_TRUE(bst.is_balanced());
+    } else {
+        EXPECT_TRUE(is_valid_red_black(bst.get_root()));
+    }
+}
+
+TYPED_TEST(BalancedBinarySearchTreeTest, ConstructFromSortedArray) {
+    std::vector<int> sorted_array(1000);
+    for (int i = 0; i < 1000; ++i) sorted_array[i] = 2 * i;
+    BinarySearchTree<int, TypeParam> bst(sorted_array);
+    
+    EXPECT_EQ(bst.height(), 10);
+    if (std::is_same<TypeParam, RedBlackBalance>::value) {
+        EXPECT_TRUE(is_valid_red_black(bst.get_root()));
+    }
+    
+    // Ranks from the build must support later updates
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(bst.insert(2 * i + 1));
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        EXPECT_TRUE(bst.remove(2 * i));
+    }
+    EXPECT_TRUE(bst.is_valid_bst());
+    EXPECT_LE(bst.height(), 2 * 11);
+    if (std::is_same<TypeParam, AvlBalance>::value) {
+        EXPECT_TRUE(bst.is_balanced());
+    } else {
+        EXPECT_TRUE(is_valid_red_black(bst.get_root()));
+    }
+}
+
+TYPED_TEST(BalancedBinarySearchTreeTest, OrderStatisticsMatchSortedVector) {
+    BinarySearchTree<int, TypeParam> bst;
+    std::set<int> reference;
+    std::mt19937 rng(40);
+    std::uniform_int_distribution<int> value(0, 5000);
+    
+    for (int step = 0; step < 6000; ++step) {
+        int v = value(rng);
+        if (rng() % 4 == 0) {
+            bst.remove(v);
+            reference.erase(v);
+        } else {
+            bst.insert(v);
+            reference.insert(v);
+        }
+    }
+    ASSERT_EQ(bst.size(), reference.size());
+    EXPECT_EQ(bst.get_root()->subtree_size, reference.size());
+    
+    std::vector<int> sorted(reference.begin(), reference.end());
+    int n = static_cast<int>(sorted.size());
+    for (int k = 1; k <= n; k += 7) {
+        EXPECT_EQ(bst.kth_smallest(k), sorted[k - 1]);
+        EXPECT_EQ(bst.kth_largest(k), sorted[n - k]);
+    }
+    for (int probe = -1; probe <= 5001; probe += 13) {
+        size_t expected_rank = std::lower_bound(sorted.begin(), sorted.end(), probe) - sorted.begin();
+        EXPECT_EQ(bst.rank(probe), expected_rank);
+        
+        int hi = probe + 250;
+        size_t expected_count = std::upper_bound(sorted.begin(), sorted.end(), hi) -
+                                std::lower_bound(sorted.begin(), sorted.end(), probe);
+        EXPECT_EQ(bst.count_in_range(probe, hi), expected_count);
+    }
+}
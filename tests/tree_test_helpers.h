@@ -0,0 +1,63 @@
+/**
+ * @file tree_test_helpers.h
+ * @brief Tree factories and teardown helpers shared by the tree tests
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#ifndef LEETCODE_STUDY_GUIDE_TREE_TEST_HELPERS_H
+#define LEETCODE_STUDY_GUIDE_TREE_TEST_HELPERS_H
+
+#include "leetcode_study_guide/data_structures/tree.h"
+#include <random>
+#include <vector>
+
+namespace leetcode_study_guide {
+namespace test_helpers {
+
+using data_structures::BinaryTree;
+
+// Random tree with values 0..n-1 attached at random open slots
+inline BinaryTree<int> random_tree(int n, std::mt19937& rng) {
+    BinaryTree<int> tree;
+    if (n == 0) return tree;
+    tree.set_root(0);
+    std::vector<BinaryTree<int>::NodePtr> open = {tree.get_root()};
+    for (int value = 1; value < n; ++value) {
+        size_t pick = rng() % open.size();
+        auto parent = open[pick];
+        BinaryTree<int>::NodePtr child;
+        if (!parent->left && (parent->right || rng() % 2 == 0)) {
+            child = tree.insert_left(parent, value);
+        } else {
+            child = tree.insert_right(parent, value);
+        }
+        if (parent->left && parent->right) {
+            open[pick] = open.back();
+            open.pop_back();
+        }
+        open.push_back(child);
+    }
+    return tree;
+}
+
+// Unlink every node before clearing, so deep chains are not destroyed
+// through recursive shared_ptr destructors
+inline void release_tree(BinaryTree<int>& tree) {
+    std::vector<BinaryTree<int>::NodePtr> nodes;
+    if (tree.get_root()) nodes.push_back(tree.get_root());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i]->left) nodes.push_back(nodes[i]->left);
+        if (nodes[i]->right) nodes.push_back(nodes[i]->right);
+    }
+    for (auto& node : nodes) {
+        node->left.reset();
+        node->right.reset();
+    }
+    tree.clear();
+}
+
+} // namespace test_helpers
+} // namespace leetcode_study_guide
+
+#endif // LEETCODE_STUDY_GUIDE_TREE_TEST_HELPERS_H
@@ -0,0 +1,160 @@
+/**
+ * @file unrolled_linked_list_test.cpp
+ * @brief Unit tests for UnrolledLinkedList
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/unrolled_linked_list.h"
+#include <gtest/gtest.h>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace leetcode_study_guide::data_structures;
+
+TEST(UnrolledLinkedListTest, BasicOperations) {
+    UnrolledLinkedList<int> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.pop_front(), std::runtime_error);
+    EXPECT_THROW(list.pop_back(), std::runtime_error);
+
+    list.push_back(2);
+    list.push_back(3);
+    list.push_front(1);
+    list.insert(3, 5);
+    list.insert(3, 4);
+    EXPECT_EQ(list.to_vector(), std::vector<int>({1, 2, 3, 4, 5}));
+    EXPECT_EQ(list.size(), 5u);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 5);
+
+    EXPECT_EQ(list.find(4), 3);
+    EXPECT_EQ(list.find(9), -1);
+    list.at(1) = 20;
+    EXPECT_EQ(list.at(1), 20);
+    EXPECT_THROW(list.at(5), std::out_of_range);
+    EXPECT_THROW(list.insert(6, 0), std::out_of_range);
+    EXPECT_THROW(list.erase(5), std::out_of_range);
+
+    list.erase(1);
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(list.to_vector(), std::vector<int>({3, 4}));
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.chunk_count(), 0u);
+    list.push_back(7);
+    EXPECT_EQ(list.to_vector(), std::vector<int>({7}));
+}
+
+TEST(UnrolledLinkedListTest, ChunksStayDense) {
+    const size_t n = 100 * UnrolledLinkedList<int>::kChunkCapacity;
+    std::vector<int> values(n);
+    for (size_t i = 0; i < n; ++i) values[i] = static_cast<int>(i);
+
+    UnrolledLinkedList<int> list(values);
+    EXPECT_EQ(list.chunk_count(), 100u);
+
+    // Erasing every other element halves each chunk's fill; merging keeps
+    // the chunk count from growing
+    for (size_t i = 0; i < list.size(); ++i) {
+        list.erase(i);
+    }
+    EXPECT_EQ(list.size(), n / 2);
+    EXPECT_LE(list.chunk_count(), 100u);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), static_cast<int>(n) - 1);
+}
+
+TEST(UnrolledLinkedListTest, MatchesStdListUnderRandomEdits) {
+    UnrolledLinkedList<std::string> list;
+    std::list<std::string> reference;
+    std::mt19937 rng(49);
+
+    for (int step = 0; step < 20000; ++step) {
+        std::string value = std::to_string(rng() % 50);
+        size_t position = reference.empty() ? 0 : rng() % (reference.size() + 1);
+        switch (rng() % 7) {
+            case 0:
+                list.push_front(value);
+                reference.push_front(value);
+                break;
+            case 1:
+            case 2:
+                list.push_back(value);
+                reference.push_back(value);
+                break;
+            case 3:
+                list.insert(position, value);
+                reference.insert(std::next(reference.begin(), position), value);
+                break;
+            case 4:
+                if (position < reference.size()) {
+                    list.erase(position);
+                    reference.erase(std::next(reference.begin(), position));
+                }
+                break;
+            case 5:
+                if (!reference.empty()) {
+                    list.pop_front();
+                    reference.pop_front();
+                }
+                break;
+            default:
+                if (step % 500 == 0) {
+                    list.remove(value);
+                    reference.remove(value);
+                } else if (!reference.empty()) {
+                    list.pop_back();
+                    reference.pop_back();
+                }
+                break;
+        }
+        ASSERT_EQ(list.size(), reference.size());
+    }
+
+    EXPECT_EQ(list.to_vector(), std::vector<std::string>(reference.begin(), reference.end()));
+    list.reverse();
+    reference.reverse();
+    EXPECT_EQ(list.to_vector(), std::vector<std::string>(reference.begin(), reference.end()));
+}
+
+TEST(UnrolledLinkedListTest, IteratorsCopyAndMove) {
+    UnrolledLinkedList<int> list;
+    for (int i = 0; i < 1000; ++i) list.push_back(i);
+
+    int expected = 0;
+    for (int value : list) {
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 1000);
+    for (int& value : list) value *= 2;
+    EXPECT_EQ(list.at(999), 1998);
+
+    UnrolledLinkedList<int> copy(list);
+    copy.reverse();
+    EXPECT_EQ(copy.front(), 1998);
+    EXPECT_EQ(list.front(), 0);
+
+    UnrolledLinkedList<int> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 1000u);
+    copy = moved;
+    EXPECT_EQ(copy.to_vector(), moved.to_vector());
+    list = std::move(moved);
+    EXPECT_EQ(list.back(), 0);
+}
+
+TEST(UnrolledLinkedListTest, AliasedArguments) {
+    UnrolledLinkedList<std::string> list{"a", "b", "a", "c"};
+    list.push_back(list.front());
+    list.push_front(list.back());
+    list.insert(2, list.at(1));
+    EXPECT_EQ(list.to_vector(), std::vector<std::string>({"a", "a", "a", "b", "a", "c", "a"}));
+    list.remove(list.front());
+    EXPECT_EQ(list.to_vector(), std::vector<std::string>({"b", "c"}));
+}
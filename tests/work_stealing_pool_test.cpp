@@ -0,0 +1,91 @@
+/**
+ * @file work_stealing_pool_test.cpp
+ * @brief Unit tests for WorkStealingPool
+ * @author LeetCode Study Guide Team
+ * @version 1.0.0
+ */
+
+#include "leetcode_study_guide/data_structures/work_stealing_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+using namespace leetcode_study_guide::data_structures;
+
+namespace {
+
+// Naive recursive Fibonacci with every call forked: many tiny nested tasks
+long fib(WorkStealingPool& pool, int n) {
+    if (n < 2) return n;
+    long a = 0;
+    WorkStealingPool::TaskGroup group(pool);
+    group.spawn([&] { a = fib(pool, n - 1); });
+    long b = fib(pool, n - 2);
+    group.wait();
+    return a + b;
+}
+
+} // namespace
+
+TEST(WorkStealingPoolTest, RunsAllTasks) {
+    WorkStealingPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+
+    std::atomic<int> sum(0);
+    WorkStealingPool::TaskGroup group(pool);
+    for (int i = 1; i <= 1000; ++i) {
+        group.spawn([&sum, i] { sum += i; });
+    }
+    group.wait();
+    EXPECT_EQ(sum.load(), 500500);
+}
+
+TEST(WorkStealingPoolTest, NestedForkJoin) {
+    WorkStealingPool pool(3);
+    EXPECT_EQ(fib(pool, 20), 6765);
+}
+
+TEST(WorkStealingPoolTest, SingleWorkerDoesNotDeadlock) {
+    WorkStealingPool pool(1);
+    EXPECT_EQ(fib(pool, 15), 610);
+}
+
+TEST(WorkStealingPoolTest, PropagatesExceptions) {
+    WorkStealingPool pool(2);
+    std::atomic<int> finished(0);
+    WorkStealingPool::TaskGroup group(pool);
+    group.spawn([] { throw std::runtime_error("task failed"); });
+    group.spawn([&finished] { ++finished; });
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(finished.load(), 1);
+
+    group.wait();  // The error is reported once
+}
+
+TEST(WorkStealingPoolTest, DefaultSizeAndIdleShutdown) {
+    WorkStealingPool pool;
+    EXPECT_GE(pool.size(), 1u);
+}
+
+TEST(WorkStealingPoolTest, UnwindingGroupWaitsForItsTasks) {
+    // The inline half of a fork throws before wait(); the spawned half
+    // still writes into the unwinding frame and must finish first
+    WorkStealingPool pool(1);
+    std::atomic<int> finished(0);
+    for (int round = 0; round < 100; ++round) {
+        try {
+            int result = 0;
+            WorkStealingPool::TaskGroup group(pool);
+            group.spawn([&] {
+                std::this_thread::yield();
+                result = round;
+                ++finished;
+            });
+            group.spawn([] { throw std::logic_error("dropped"); });
+            throw std::runtime_error("inline half failed");
+        } catch (const std::runtime_error&) {
+        }
+    }
+    EXPECT_EQ(finished.load(), 100);
+}